@@ -17,6 +17,7 @@
 #include "UserInterface.h"
 #include "ModelLoader.h"
 #include "ECS/Actor.h"
+#include "ECS/World.h"
 #include "SamplerState.h"
 
 /**
@@ -30,8 +31,10 @@ BaseApp {
 public:
   /**
    * @brief Constructs a new BaseApp instance.
+   * @param frameArenaCapacity Capacity in bytes of each of the two per-frame scratch buffers.
    */
-  BaseApp() = default;
+  explicit BaseApp(size_t frameArenaCapacity = 1024 * 1024)
+    : m_frameArena(frameArenaCapacity) {}
 
   /**
    * @brief Destroys the BaseApp instance and releases any held resources.
@@ -63,6 +66,13 @@ public:
   void
   destroy();
 
+  /**
+   * @brief Creates a new actor in g_actors; the actor identifies itself by its g_world entity.
+   * @return Handle of the new actor. Pointers into g_actors are invalidated by this call.
+   */
+  EngineUtilities::SlotHandle
+  createActor();
+
   /**
    * @brief Runs the application from the main entry point.
    * @param hInstance Handle to the current instance of the application.
@@ -157,6 +167,15 @@ public:
    */
   SamplerState g_samplerState;
 
+  /**
+   * @brief Double-buffered arena for per-frame scratch data; run() starts a new frame before every update().
+   *
+   * It is the active frame arena while the app runs, so update()/render() code can use
+   * EngineUtilities::FrameAlloc<T>(n) or containers with EngineUtilities::TFrameAllocator.
+   * Data stays valid until the end of the following frame.
+   */
+  EngineUtilities::TFrameArena m_frameArena;
+
   // --- Camera Buffers ---
 
   /**
@@ -185,12 +204,12 @@ public:
   /**
    * @brief View matrix.
    */
-  XMMATRIX g_View;
+  EngineUtilities::Matrix4x4 g_View;
 
   /**
    * @brief Projection matrix.
    */
-  XMMATRIX g_Projection;
+  EngineUtilities::Matrix4x4 g_Projection;
 
   // --- Plane and Shadow Variables ---
 
@@ -235,14 +254,15 @@ public:
    */
   CBChangeOnResize cbChangesOnResize;
 
-  EngineUtilities::TSharedPointer<Actor> g_AKoro; ///< Shared pointer to the Koro actor in the scene.
-  EngineUtilities::TSharedPointer<Actor> g_APlane; ///< Shared pointer to the plane actor in the scene.
-  EngineUtilities::TSharedPointer<Actor> g_AShiba; ///< Shared pointer to the Shiba actor in the scene.
-  EngineUtilities::TSharedPointer<Actor> g_ARei; ///< Shared pointer to therei actor in the scene.
-  std::vector<EngineUtilities::TSharedPointer<Actor>> g_actors; ///< Vector of actors in the scene.
+  EngineUtilities::SlotHandle g_AKoro; ///< Handle of the Koro actor in g_actors.
+  EngineUtilities::SlotHandle g_APlane; ///< Handle of the plane actor in g_actors.
+  EngineUtilities::SlotHandle g_AShiba; ///< Handle of the Shiba actor in g_actors.
+  EngineUtilities::SlotHandle g_ARei; ///< Handle of the Rei actor in g_actors.
+  World g_world; ///< Entity data of the scene; declared before g_actors so it outlives them.
+  EngineUtilities::TSlotMap<Actor> g_actors; ///< Actors in the scene, stored contiguously.
 
   // --- Selected Actor for UI ---
-  EngineUtilities::TSharedPointer<Actor> m_selectedActor; ///< Currently selected actor for transform editing.
+  EngineUtilities::SlotHandle m_selectedActor; ///< Currently selected actor for transform editing.
 
   XMFLOAT4 g_LightPos; ///< Posicin de la luz(2.0f, 4.0f, -2.0f, 1.0f)
 };
@@ -60,5 +60,5 @@ private:
   /**
    * @brief Pointer to the underlying Direct3D blend state object.
    */
-  ID3D11BlendState* m_blendState = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11BlendState> m_blendState;
 };
@@ -104,7 +104,7 @@ private:
   /**
    * @brief Pointer to the underlying Direct3D buffer resource.
    */
-  ID3D11Buffer* m_buffer = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11Buffer> m_buffer;
 
   /**
    * @brief Stride (in bytes) of the buffer elements (used for vertex buffers).
@@ -61,5 +61,5 @@ private:
   /**
    * @brief Pointer to the underlying Direct3D depth-stencil state object.
    */
-  ID3D11DepthStencilState* m_depthStencilState = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11DepthStencilState> m_depthStencilState;
 };
@@ -61,7 +61,7 @@ public:
   /**
    * @brief Pointer to the underlying Direct3D depth stencil view.
    */
-  ID3D11DepthStencilView* m_depthStencilView = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11DepthStencilView> m_depthStencilView;
 
 };
 
@@ -4,6 +4,7 @@
 #include "Buffer.h"
 #include "Texture.h"
 #include "Transform.h"
+#include "World.h"
 #include "SamplerState.h"
 #include "Rasterizer.h"
 #include "BlendState.h"
@@ -19,7 +20,8 @@ class MeshComponent;
  *
  * The Actor class extends Entity and encapsulates all the resources and logic required
  * to represent a renderable object in the scene. It manages mesh components, textures,
- * rendering states, and supports shadow casting.
+ * rendering states, and supports shadow casting. Its spatial data lives in a World entity
+ * (Position, Rotation, Scale, LocalToWorld); the Actor is a convenience facade over it.
  */
 class Actor : public Entity {
 public:
@@ -31,8 +33,9 @@ public:
   /**
    * @brief Constructs an Actor initialized with a device.
    * @param device The device used to initialize the actor's resources.
+   * @param world The world that stores the actor's entity and transform data.
    */
-  Actor(Device& device);
+  Actor(Device& device, World& world);
 
   /**
    * @brief Virtual destructor.
@@ -58,10 +61,39 @@ public:
   void render(DeviceContext& deviceContext) override;
 
   /**
-   * @brief Destroys the actor and releases associated resources.
+   * @brief Destroys the actor, its world entity, and releases associated resources.
    */
   void destroy();
 
+  /**
+   * @brief Gets a data component of the actor's entity.
+   * @return The component, or nullptr if the entity has none. Valid until the next
+   * structural change in the world.
+   */
+  template <typename T>
+  T* getData() {
+    return m_world ? m_world->getComponent<T>(m_id) : nullptr;
+  }
+
+  /**
+   * @brief Adds (or replaces) a data component on the actor's entity.
+   * @param args Arguments forwarded to T's constructor.
+   * @return Reference to the component, valid until the next structural change.
+   */
+  template <typename T, typename... Args>
+  T& addData(Args&&... args) {
+    return m_world->addComponent<T>(m_id, std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Removes a data component from the actor's entity.
+   * @return False if the entity had none.
+   */
+  template <typename T>
+  bool removeData() {
+    return m_world && m_world->removeComponent<T>(m_id);
+  }
+
   /**
    * @brief Sets the mesh components for the actor.
    * @param device The device used to initialize the meshes.
@@ -71,9 +103,9 @@ public:
 
   /**
    * @brief Gets the name of the actor.
-   * @return The actor's name.
+   * @return The actor's interned name.
    */
-  std::string getName() {
+  const EngineUtilities::Name& getName() const {
     return m_name;
   }
 
@@ -81,7 +113,7 @@ public:
    * @brief Sets the name of the actor.
    * @param name The new name for the actor.
    */
-  void setName(const std::string& name) {
+  void setName(const EngineUtilities::Name& name) {
     m_name = name;
   }
 
@@ -89,8 +121,12 @@ public:
    * @brief Sets the textures for the actor.
    * @param textures Vector of textures to assign.
    */
-  void setTextures(std::vector<Texture> textures) {
-    m_textures = textures;
+  void setTextures(const std::vector<Texture>& textures) {
+    m_textures.Empty();
+    m_textures.Reserve(textures.size());
+    for (const Texture& texture : textures) {
+      m_textures.Add(texture);
+    }
   }
 
   /**
@@ -117,9 +153,9 @@ public:
 
 private:
   std::vector<MeshComponent> m_meshes;  ///< Mesh components associated with the actor.
-  std::vector<Texture> m_textures;      ///< Textures applied to the actor.
-  std::vector<Buffer> m_vertexBuffers;  ///< Vertex buffers for the actor's meshes.
-  std::vector<Buffer> m_indexBuffers;   ///< Index buffers for the actor's meshes.
+  EngineUtilities::TInlineArray<Texture, 4> m_textures;     ///< Textures applied to the actor (inline up to 4).
+  EngineUtilities::TInlineArray<Buffer, 4> m_vertexBuffers;  ///< Vertex buffers for the actor's meshes (inline up to 4).
+  EngineUtilities::TInlineArray<Buffer, 4> m_indexBuffers;   ///< Index buffers for the actor's meshes (inline up to 4).
   BlendState m_blendstate;              ///< Blend state for rendering.
   Rasterizer m_rasterizer;              ///< Rasterizer state for rendering.
   SamplerState m_sampler;               ///< Sampler state for textures.
@@ -134,6 +170,7 @@ private:
   CBChangesEveryFrame m_cbShadow;       ///< Constant buffer for shadow rendering.
 
   XMFLOAT4 m_LightPos;                  ///< Light position for shadow calculations.
-  std::string m_name = "Actor";         ///< Name of the actor.
+  EngineUtilities::Name m_name = "Actor"; ///< Interned name of the actor.
   bool castShadow = true;               ///< Indicates if the actor casts shadows.
+  World* m_world = nullptr;             ///< World that stores the actor's entity (m_id).
 };
@@ -1,8 +1,19 @@
 #pragma once
 
-#include "Prerequisites.h"
 class DeviceContext;
 
+/**
+ * @enum ComponentType
+ * @brief Identifies the concrete type of a Component.
+ */
+enum
+ComponentType {
+  NONE = 0,     ///< Unspecified component type.
+  TRANSFORM = 1,///< Transform component.
+  MESH = 2,     ///< Mesh component.
+  MATERIAL = 3  ///< Material component.
+};
+
 /**
  * @class Component
  * @brief Abstract base class for all components in the ECS (Entity-Component-System) architecture.
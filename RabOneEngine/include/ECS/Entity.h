@@ -68,7 +68,7 @@ public:
   void addComponent(EngineUtilities::TSharedPointer<T> component) {
     static_assert(std::is_base_of<Component, T>::value,
       "T must be derived from Component");
-    m_components.push_back(component.template dynamic_pointer_cast<Component>());
+    m_components.Add(component.template dynamic_pointer_cast<Component>());
   }
 
   /**
@@ -90,8 +90,16 @@ public:
     return EngineUtilities::TSharedPointer<T>(); ///< Return nullptr if not found.
   }
 
+  /**
+   * @brief Gets the id of the entity's data in its World.
+   * @return The id; invalid until the derived class creates the World entity, stale once it is destroyed.
+   */
+  EngineUtilities::SlotHandle getId() const {
+    return m_id;
+  }
+
 protected:
-  bool m_isActive; ///< Indicates whether the entity is active.
-  int m_id; ///< Unique identifier for the entity.
-  std::vector<EngineUtilities::TSharedPointer<Component>> m_components; ///< Components associated with the entity.
+  bool m_isActive = true; ///< Indicates whether the entity is active.
+  EngineUtilities::SlotHandle m_id; ///< The entity's EntityId in its World; its only identity.
+  EngineUtilities::TInlineArray<EngineUtilities::TSharedPointer<Component>, 4> m_components; ///< Components associated with the entity (inline up to 4).
 };
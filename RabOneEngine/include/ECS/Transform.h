@@ -1,37 +1,37 @@
 ﻿#pragma once
-#include "Prerequisites.h"
 #include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
 #include "Component.h"
+#include "TransformComponents.h"
 
 /**
  * @class Transform
  * @brief Component that manages position, rotation, scale, and transformation matrix for an entity.
  *
  * The Transform component encapsulates the spatial properties of an entity, including its position,
- * rotation, and scale in 3D space. It also maintains a transformation matrix that can be used for
- * rendering or physics calculations. This component is fundamental for any object that requires
- * spatial manipulation in a scene.
+ * rotation, and scale in 3D space. The data itself lives in the World as the Position, Rotation,
+ * Scale and LocalToWorld components of one entity; this class is a facade that reads and writes
+ * them, so existing code keeps working while updateTransforms composes all matrices in one pass.
  */
 class Transform : public Component {
 public:
   /**
-   * @brief Default constructor.
+   * @brief Constructs a facade over an entity's transform components.
+   * @param world The world that stores the entity.
+   * @param entity An entity with Position, Rotation, Scale and LocalToWorld.
    *
-   * Initializes position, rotation, and scale to their default values (usually zero vectors),
-   * and sets the component type to TRANSFORM.
+   * Sets the component type to TRANSFORM.
    */
-  Transform() : position(),
-    rotation(),
-    scale(),
-    matrix(),
-    Component(ComponentType::TRANSFORM) {
+  Transform(World& world, EntityId entity)
+    : Component(ComponentType::TRANSFORM),
+      m_world(&world),
+      m_entity(entity) {
   }
 
   /**
    * @brief Initializes the Transform component.
    *
-   * This method should be called before using the component to ensure all internal data
-   * is set up correctly.
+   * Resets the scale to one and the matrix to identity.
    */
   void init();
 
@@ -39,9 +39,9 @@ public:
    * @brief Updates the state of the Transform component based on elapsed time.
    * @param deltaTime Time elapsed since the last update (in seconds).
    *
-   * This method can be used to animate or otherwise modify the transform over time.
+   * Does nothing: the matrix is composed for all entities at once by updateTransforms.
    */
-  void update(float deltaTime) override;
+  void update(float /*deltaTime*/) override {}
 
   /**
    * @brief Renders the Transform component.
@@ -49,7 +49,7 @@ public:
    *
    * The default implementation does nothing, as Transform is typically not directly rendered.
    */
-  void render(DeviceContext& deviceContext) override {}
+  void render(DeviceContext& /*deviceContext*/) override {}
 
   /**
    * @brief Destroys the Transform component and releases resources.
@@ -62,37 +62,37 @@ public:
    * @brief Gets the current position.
    * @return Reference to the current position vector.
    */
-  const EngineUtilities::Vector3& getPosition() const { return position; }
+  const EngineUtilities::Vector3& getPosition() const { return data<Position>().value; }
 
   /**
    * @brief Sets a new position.
    * @param newPos The new position vector.
    */
-  void setPosition(const EngineUtilities::Vector3& newPos) { position = newPos; }
+  void setPosition(const EngineUtilities::Vector3& newPos) { data<Position>().value = newPos; }
 
   /**
    * @brief Gets the current rotation.
    * @return Reference to the current rotation vector (in degrees or radians, depending on convention).
    */
-  const EngineUtilities::Vector3& getRotation() const { return rotation; }
+  const EngineUtilities::Vector3& getRotation() const { return data<Rotation>().value; }
 
   /**
    * @brief Sets a new rotation.
    * @param newRot The new rotation vector.
    */
-  void setRotation(const EngineUtilities::Vector3& newRot) { rotation = newRot; }
+  void setRotation(const EngineUtilities::Vector3& newRot) { data<Rotation>().value = newRot; }
 
   /**
    * @brief Gets the current scale.
    * @return Reference to the current scale vector.
    */
-  const EngineUtilities::Vector3& getScale() const { return scale; }
+  const EngineUtilities::Vector3& getScale() const { return data<Scale>().value; }
 
   /**
    * @brief Sets a new scale.
    * @param newScale The new scale vector.
    */
-  void setScale(const EngineUtilities::Vector3& newScale) { scale = newScale; }
+  void setScale(const EngineUtilities::Vector3& newScale) { data<Scale>().value = newScale; }
 
   /**
    * @brief Sets position, rotation, and scale in a single call.
@@ -114,11 +114,23 @@ public:
    */
   void translate(const EngineUtilities::Vector3& translation);
 
+  /**
+   * @brief Gets the transformation matrix composed by the last updateTransforms.
+   * @return Reference to the combined position, rotation, and scale matrix.
+   */
+  const EngineUtilities::Matrix4x4& getMatrix() const { return data<LocalToWorld>().value; }
+
 private:
-  EngineUtilities::Vector3 position;  ///< Position of the object in world space.
-  EngineUtilities::Vector3 rotation;  ///< Rotation of the object (typically in degrees or radians).
-  EngineUtilities::Vector3 scale;     ///< Scale of the object.
+  /**
+   * @brief Returns one of the entity's transform components in the world.
+   */
+  template <typename T>
+  T& data() const {
+    T* component = m_world->getComponent<T>(m_entity);
+    assert(component && "Transform entity is missing a transform component");
+    return *component;
+  }
 
-public:
-  XMMATRIX matrix;    ///< Transformation matrix representing the combined position, rotation, and scale.
+  World* m_world;    ///< World that stores the transform data.
+  EntityId m_entity; ///< Entity whose Position, Rotation, Scale and LocalToWorld this facade edits.
 };
@@ -0,0 +1,58 @@
+#pragma once
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+#include "World.h"
+
+/**
+ * @struct Position
+ * @brief World-space position of an entity.
+ */
+struct Position {
+  EngineUtilities::Vector3 value; ///< The position.
+};
+
+/**
+ * @struct Rotation
+ * @brief Euler rotation of an entity in radians (x = pitch, y = yaw, z = roll).
+ */
+struct Rotation {
+  EngineUtilities::Vector3 value; ///< The Euler angles.
+};
+
+/**
+ * @struct Scale
+ * @brief Per-axis scale of an entity.
+ */
+struct Scale {
+  EngineUtilities::Vector3 value = EngineUtilities::Vector3(1.0f, 1.0f, 1.0f); ///< The scale.
+};
+
+/**
+ * @struct LocalToWorld
+ * @brief World matrix composed from Position, Rotation and Scale by updateTransforms.
+ */
+struct LocalToWorld {
+  EngineUtilities::Matrix4x4 value; ///< scale * rotation * translation.
+};
+
+/**
+ * @brief Composes LocalToWorld for every entity that has all four transform components.
+ *
+ * Walks the chunk arrays linearly, so one call replaces a virtual Transform::update
+ * per entity. Call it once per frame, after gameplay code has written the
+ * positions and before anything reads the matrices.
+ *
+ * @param world The world to update.
+ */
+inline void
+updateTransforms(World& world) {
+  world.eachChunk<const Position, const Rotation, const Scale, LocalToWorld>(
+    [](size_t count, EntityId*, const Position* position, const Rotation* rotation,
+       const Scale* scale, LocalToWorld* localToWorld) {
+      for (size_t i = 0; i < count; ++i) {
+        localToWorld[i].value = EngineUtilities::Matrix4x4::compose(position[i].value,
+                                                                    rotation[i].value,
+                                                                    scale[i].value);
+      }
+    });
+}
@@ -0,0 +1,420 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Engine Utilities/Memory/TAllocator.h"
+#include "Engine Utilities/Structures/TArray.h"
+#include "Engine Utilities/Structures/TMap.h"
+#include "Engine Utilities/Structures/TSlotMap.h"
+
+/**
+ * @brief Identifies an entity in a World; stale ids (destroyed entities) never resolve.
+ */
+using EntityId = EngineUtilities::SlotHandle;
+
+/**
+ * @brief Bit set of component type ids; one bit per registered component type.
+ */
+using ComponentMask = uint64_t;
+
+/**
+ * @brief Maximum number of distinct component types (one bit each in ComponentMask).
+ */
+constexpr uint32_t MaxComponentTypes = 64;
+
+/**
+ * @struct ComponentInfo
+ * @brief Type-erased description of a component type, used to move and destroy it in chunks.
+ */
+struct ComponentInfo {
+  size_t size;      ///< sizeof the component.
+  size_t alignment; ///< alignof the component.
+  void (*relocate)(void* destination, void* source); ///< Move-constructs at destination and destroys source.
+  void (*destroy)(void* object);                      ///< Runs the destructor.
+};
+
+/**
+ * @brief Returns the registered description of a component type id.
+ */
+inline ComponentInfo&
+componentInfo(uint32_t typeId) {
+  static ComponentInfo infos[MaxComponentTypes] = {};
+  return infos[typeId];
+}
+
+/**
+ * @brief Assigns the next component type id. Called once per type by componentTypeId.
+ *
+ * Aborts in every build when more than MaxComponentTypes types are registered:
+ * the extra ids would have no bit in ComponentMask and would write past the
+ * per-type tables.
+ */
+inline uint32_t
+registerComponentType(const ComponentInfo& info) {
+  static std::atomic<uint32_t> nextId(0);
+  uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+  if (id >= MaxComponentTypes) {
+    std::fputs("World: too many component types for ComponentMask (MaxComponentTypes is 64)\n", stderr);
+    std::abort();
+  }
+  componentInfo(id) = info;
+  return id;
+}
+
+/**
+ * @brief Returns the id of a component type, registering it on first use.
+ *
+ * Ids are assigned in first-use order, so they can differ between runs; never
+ * serialize them. Components are plain data: any type that is move-constructible
+ * works, and no base class or virtual functions are needed.
+ *
+ * @tparam T The component type (without const).
+ */
+template <typename T>
+uint32_t
+componentTypeId() {
+  static_assert(!std::is_const<T>::value && !std::is_reference<T>::value,
+    "Component types are plain, non-const value types");
+  static_assert(std::is_move_constructible<T>::value, "Components must be move-constructible");
+  static const uint32_t id = registerComponentType(ComponentInfo{
+    sizeof(T), alignof(T),
+    [](void* destination, void* source) {
+      T* from = static_cast<T*>(source);
+      new (destination) T(std::move(*from));
+      from->~T();
+    },
+    [](void* object) { static_cast<T*>(object)->~T(); } });
+  return id;
+}
+
+/**
+ * @brief Returns the mask with the bits of the given component types.
+ */
+template <typename... Ts>
+ComponentMask
+componentMask() {
+  ComponentMask mask = 0;
+  using Expand = int[];
+  (void)Expand{ 0, (mask |= ComponentMask(1) << componentTypeId<typename std::remove_const<Ts>::type>(), 0)... };
+  return mask;
+}
+
+/**
+ * @struct ArchetypeChunk
+ * @brief One fixed-size block of an archetype: an EntityId array followed by one array per component.
+ */
+struct ArchetypeChunk {
+  char* data = nullptr; ///< Start of the block (World::ChunkAlignment aligned).
+  uint32_t count = 0;   ///< Rows in use.
+};
+
+/**
+ * @class Archetype
+ * @brief All entities that have exactly one set of component types.
+ *
+ * Rows are dense across the chunks: row r lives in chunk r / capacity at index
+ * r % capacity, and every chunk but the last is full. Within a chunk each component
+ * type has its own contiguous array, so a query walks plain arrays.
+ */
+class Archetype {
+public:
+  ComponentMask mask = 0;                  ///< Component types of the entities in this archetype.
+  uint32_t capacity = 0;                   ///< Rows per chunk.
+  uint32_t entityCount = 0;                ///< Rows in use across all chunks.
+  uint32_t offsets[MaxComponentTypes];     ///< Byte offset of each present type's array in a chunk.
+  EngineUtilities::TArray<uint32_t> types; ///< Present type ids, ascending.
+  EngineUtilities::TArray<ArchetypeChunk> chunks; ///< The chunks; the last may be partly full.
+  Archetype* addEdges[MaxComponentTypes];    ///< Cached archetype with one more type, or nullptr.
+  Archetype* removeEdges[MaxComponentTypes]; ///< Cached archetype with one type fewer, or nullptr.
+
+  /**
+   * @brief Returns the EntityId array of a chunk.
+   */
+  EntityId* entities(const ArchetypeChunk& chunk) const {
+    return reinterpret_cast<EntityId*>(chunk.data);
+  }
+
+  /**
+   * @brief Returns the array of one component type in a chunk; the type must be present.
+   */
+  void* column(const ArchetypeChunk& chunk, uint32_t typeId) const {
+    return chunk.data + offsets[typeId];
+  }
+
+  /**
+   * @brief Returns the typed array of T (possibly const) in a chunk.
+   */
+  template <typename T>
+  T* column(const ArchetypeChunk& chunk) const {
+    return reinterpret_cast<T*>(column(chunk, componentTypeId<typename std::remove_const<T>::type>()));
+  }
+
+  /**
+   * @brief Returns a pointer to one component of a row.
+   */
+  void* component(uint32_t row, uint32_t typeId) const {
+    const ArchetypeChunk& chunk = chunks[row / capacity];
+    return static_cast<char*>(column(chunk, typeId)) + (row % capacity) * componentInfo(typeId).size;
+  }
+};
+
+/**
+ * @class World
+ * @brief Archetype-based entity storage: entities grouped by component signature into SoA chunks.
+ *
+ * Every entity belongs to the archetype of its exact component set. Adding or
+ * removing a component migrates the entity's row to the neighbouring archetype
+ * (found through a cached edge), moving the components it keeps. Destroying an
+ * entity, or migrating it away, moves the archetype's last row into the hole, so
+ * archetypes stay dense and queries never skip holes.
+ *
+ * Queries (each, eachChunk) visit every archetype whose signature contains the
+ * requested types and walk their chunk arrays linearly, with no virtual calls or
+ * per-entity pointer chasing. Structural changes (create, destroy, add, remove)
+ * must not happen inside a query; collect them and apply them afterwards.
+ *
+ * Component pointers and references stay valid only until the next structural change.
+ * The World is not thread-safe.
+ */
+class World {
+public:
+  static constexpr size_t ChunkBytes = 16 * 1024; ///< Size of every chunk.
+  static constexpr size_t ChunkAlignment = 64;    ///< Alignment of chunks and of each array in them.
+
+  /**
+   * @brief Creates an empty world.
+   */
+  World();
+
+  /**
+   * @brief Destroys all entities and frees all chunks.
+   */
+  ~World();
+
+  World(const World&) = delete;
+  World& operator=(const World&) = delete;
+
+  /**
+   * @brief Creates an entity with no components.
+   * @return The new entity's id.
+   */
+  EntityId createEntity();
+
+  /**
+   * @brief Creates an entity directly in the archetype of the given components.
+   * @param components The initial component values; each type at most once.
+   * @return The new entity's id.
+   */
+  template <typename... Ts>
+  EntityId createEntity(Ts&&... components) {
+    Archetype* archetype = getArchetype(componentMask<typename std::decay<Ts>::type...>());
+    EntityId entity = m_entities.Emplace(EntityRecord{ archetype, 0 });
+    uint32_t row = allocateRow(archetype, entity);
+    m_entities.Find(entity)->row = row;
+    using Expand = int[];
+    (void)Expand{ 0, (constructComponent<typename std::decay<Ts>::type>(archetype, row,
+                        std::forward<Ts>(components)), 0)... };
+    return entity;
+  }
+
+  /**
+   * @brief Destroys an entity and its components.
+   * @param entity The entity.
+   * @return False if the entity was already destroyed.
+   */
+  bool destroyEntity(EntityId entity);
+
+  /**
+   * @brief Checks whether an entity exists.
+   */
+  bool isAlive(EntityId entity) const {
+    return m_entities.Contains(entity);
+  }
+
+  /**
+   * @brief Returns the number of live entities.
+   */
+  size_t getEntityCount() const {
+    return m_entities.Num();
+  }
+
+  /**
+   * @brief Returns the number of archetypes created so far (including empty ones).
+   */
+  size_t getArchetypeCount() const {
+    return m_archetypes.Num();
+  }
+
+  /**
+   * @brief Adds a component, migrating the entity to the archetype that has it.
+   *
+   * If the entity already has a T, it is replaced instead.
+   *
+   * @param entity A live entity.
+   * @param args Arguments forwarded to T's constructor.
+   * @return Reference to the component, valid until the next structural change.
+   */
+  template <typename T, typename... Args>
+  T& addComponent(EntityId entity, Args&&... args) {
+    uint32_t typeId = componentTypeId<T>();
+    EntityRecord* record = m_entities.Find(entity);
+    assert(record && "addComponent on a destroyed entity");
+    if (record->archetype->mask & (ComponentMask(1) << typeId)) {
+      T* existing = static_cast<T*>(record->archetype->component(record->row, typeId));
+      *existing = T(std::forward<Args>(args)...);
+      return *existing;
+    }
+    migrate(entity, *record, getAddTarget(record->archetype, typeId));
+    return constructComponent<T>(record->archetype, record->row, std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Removes a component, migrating the entity to the archetype without it.
+   * @param entity The entity.
+   * @return False if the entity is dead or has no T.
+   */
+  template <typename T>
+  bool removeComponent(EntityId entity) {
+    uint32_t typeId = componentTypeId<T>();
+    EntityRecord* record = m_entities.Find(entity);
+    if (!record || !(record->archetype->mask & (ComponentMask(1) << typeId))) {
+      return false;
+    }
+    migrate(entity, *record, getRemoveTarget(record->archetype, typeId));
+    return true;
+  }
+
+  /**
+   * @brief Checks whether a live entity has a component.
+   */
+  template <typename T>
+  bool hasComponent(EntityId entity) const {
+    const EntityRecord* record = m_entities.Find(entity);
+    return record && (record->archetype->mask & (ComponentMask(1) << componentTypeId<T>()));
+  }
+
+  /**
+   * @brief Returns an entity's component.
+   * @return The component, or nullptr if the entity is dead or has no T. Valid until
+   * the next structural change.
+   */
+  template <typename T>
+  T* getComponent(EntityId entity) {
+    uint32_t typeId = componentTypeId<T>();
+    EntityRecord* record = m_entities.Find(entity);
+    if (!record || !(record->archetype->mask & (ComponentMask(1) << typeId))) {
+      return nullptr;
+    }
+    return static_cast<T*>(record->archetype->component(record->row, typeId));
+  }
+
+  /**
+   * @brief Calls fn(count, EntityId*, Ts*...) once per chunk that has all of Ts.
+   *
+   * This is the fast path: the arrays are contiguous and can be processed with
+   * SIMD. Declare read-only types as const (eachChunk<const Position, Velocity>).
+   *
+   * @param fn The chunk callback.
+   */
+  template <typename... Ts, typename Fn>
+  void eachChunk(Fn&& fn) {
+    const ComponentMask required = componentMask<Ts...>();
+    for (Archetype* archetype : m_archetypes) {
+      if ((archetype->mask & required) != required || archetype->entityCount == 0) {
+        continue;
+      }
+      for (const ArchetypeChunk& chunk : archetype->chunks) {
+        fn(static_cast<size_t>(chunk.count), archetype->entities(chunk), archetype->template column<Ts>(chunk)...);
+      }
+    }
+  }
+
+  /**
+   * @brief Calls fn(Ts&...) for every entity that has all of Ts.
+   * @param fn The per-entity callback.
+   */
+  template <typename... Ts, typename Fn>
+  void each(Fn&& fn) {
+    eachChunk<Ts...>([&fn](size_t count, EntityId*, Ts*... arrays) {
+      for (size_t i = 0; i < count; ++i) {
+        fn(arrays[i]...);
+      }
+    });
+  }
+
+  /**
+   * @brief Returns the number of entities that have all of Ts.
+   */
+  template <typename... Ts>
+  size_t count() const {
+    const ComponentMask required = componentMask<Ts...>();
+    size_t total = 0;
+    for (const Archetype* archetype : m_archetypes) {
+      if ((archetype->mask & required) == required) {
+        total += archetype->entityCount;
+      }
+    }
+    return total;
+  }
+
+  /**
+   * @brief Destroys every entity and frees all chunks; archetypes are kept for reuse.
+   */
+  void clear();
+
+private:
+  /**
+   * @brief Where an entity's components live.
+   */
+  struct EntityRecord {
+    Archetype* archetype; ///< The entity's archetype.
+    uint32_t row;         ///< The entity's row in that archetype.
+  };
+
+  template <typename T, typename... Args>
+  T& constructComponent(Archetype* archetype, uint32_t row, Args&&... args) {
+    return *new (archetype->component(row, componentTypeId<T>())) T(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Finds or creates the archetype for a component mask.
+   */
+  Archetype* getArchetype(ComponentMask mask);
+
+  /**
+   * @brief Archetype with typeId added, through the cached edge.
+   */
+  Archetype* getAddTarget(Archetype* archetype, uint32_t typeId);
+
+  /**
+   * @brief Archetype with typeId removed, through the cached edge.
+   */
+  Archetype* getRemoveTarget(Archetype* archetype, uint32_t typeId);
+
+  /**
+   * @brief Appends a row (allocating a chunk when needed) and stores the entity id in it.
+   * @return The new row; its components are uninitialized.
+   */
+  uint32_t allocateRow(Archetype* archetype, EntityId entity);
+
+  /**
+   * @brief Fills a row whose components were destroyed or moved out with the last row.
+   */
+  void removeRow(Archetype* archetype, uint32_t row);
+
+  /**
+   * @brief Moves an entity to another archetype: shared components are relocated,
+   * the ones the target lacks are destroyed, the ones it adds are left uninitialized.
+   */
+  void migrate(EntityId entity, EntityRecord& record, Archetype* target);
+
+  EngineUtilities::TSlotMap<EntityRecord> m_entities;           ///< Entity id to archetype row.
+  EngineUtilities::TArray<Archetype*> m_archetypes;             ///< All archetypes, in creation order.
+  EngineUtilities::TMap<ComponentMask, Archetype*> m_archetypeByMask; ///< Archetype lookup by signature.
+};
@@ -0,0 +1,261 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cfloat>
+#include <cstddef>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief An axis-aligned bounding box.
+   *
+   * The box is stored as its minimum and maximum corners (the names avoid the
+   * min/max macros from windows.h). A default-constructed box is empty: its
+   * minimum is +FLT_MAX and its maximum -FLT_MAX, so merging anything into it
+   * yields that thing. Empty boxes must not be passed to the frustum tests.
+   */
+  class AABB {
+  public:
+    Vector3 minimum; /**< The corner with the smallest coordinates. */
+    Vector3 maximum; /**< The corner with the largest coordinates. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty box.
+     */
+    constexpr AABB()
+      : minimum(FLT_MAX, FLT_MAX, FLT_MAX), maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX) {}
+
+    /**
+     * @brief Constructs the box from its corners.
+     *
+     * @param minimum The corner with the smallest coordinates.
+     * @param maximum The corner with the largest coordinates.
+     */
+    constexpr AABB(const Vector3& minimum, const Vector3& maximum) : minimum(minimum), maximum(maximum) {}
+
+    /**
+     * @brief Builds the box from its center and half extents.
+     *
+     * @param center The center of the box.
+     * @param extents Half the size of the box on each axis.
+     * @return The box.
+     */
+    static constexpr AABB fromCenterExtents(const Vector3& center, const Vector3& extents) {
+      return AABB(center - extents, center + extents);
+    }
+
+    /**
+     * @brief Builds the smallest box containing a set of points.
+     *
+     * Four points per iteration with SSE, then one at a time.
+     *
+     * @param points The points.
+     * @param count Number of points; zero gives an empty box.
+     * @return The box.
+     */
+    static AABB fromPoints(const Vector3* points, size_t count) {
+      AABB box;
+      size_t i = 0;
+#if ENGINE_SIMD_SSE2
+      if (count >= 4) {
+        __m128 minX = _mm_set1_ps(box.minimum.x), minY = minX, minZ = minX;
+        __m128 maxX = _mm_set1_ps(box.maximum.x), maxY = maxX, maxZ = maxX;
+        for (; i + 4 <= count; i += 4) {
+          const float* in = &points[i].x;
+          __m128 x, y, z;
+          SimdDeinterleave3(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+          minX = _mm_min_ps(minX, x);
+          minY = _mm_min_ps(minY, y);
+          minZ = _mm_min_ps(minZ, z);
+          maxX = _mm_max_ps(maxX, x);
+          maxY = _mm_max_ps(maxY, y);
+          maxZ = _mm_max_ps(maxZ, z);
+        }
+        // Transposing leaves lane i of each row holding the four x, y, z minima or maxima.
+        __m128 unused = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(minX, minY, minZ, unused);
+        __m128 lowest = _mm_min_ps(_mm_min_ps(minX, minY), _mm_min_ps(minZ, unused));
+        unused = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(maxX, maxY, maxZ, unused);
+        __m128 highest = _mm_max_ps(_mm_max_ps(maxX, maxY), _mm_max_ps(maxZ, unused));
+        alignas(16) float lo[4];
+        alignas(16) float hi[4];
+        _mm_store_ps(lo, lowest);
+        _mm_store_ps(hi, highest);
+        box = AABB(Vector3(lo[0], lo[1], lo[2]), Vector3(hi[0], hi[1], hi[2]));
+      }
+#endif
+      for (; i < count; ++i) {
+        box = box.merge(points[i]);
+      }
+      return box;
+    }
+
+    /**
+     * @brief Checks whether the box is empty (inverted on any axis).
+     */
+    constexpr bool isEmpty() const {
+      return minimum.x > maximum.x || minimum.y > maximum.y || minimum.z > maximum.z;
+    }
+
+    /**
+     * @brief Returns the center of the box.
+     */
+    constexpr Vector3 center() const {
+      return (minimum + maximum) * 0.5f;
+    }
+
+    /**
+     * @brief Returns half the size of the box on each axis.
+     */
+    constexpr Vector3 extents() const {
+      return (maximum - minimum) * 0.5f;
+    }
+
+    /**
+     * @brief Returns the size of the box on each axis.
+     */
+    constexpr Vector3 size() const {
+      return maximum - minimum;
+    }
+
+    /**
+     * @brief Returns the surface area, the usual cost metric for BVH builds.
+     */
+    constexpr float surfaceArea() const {
+      Vector3 s = size();
+      return 2.0f * (s.x * s.y + s.y * s.z + s.z * s.x);
+    }
+
+    /**
+     * @brief Returns the volume of the box.
+     */
+    constexpr float volume() const {
+      Vector3 s = size();
+      return s.x * s.y * s.z;
+    }
+
+    /**
+     * @brief Checks whether a point is inside or on the box.
+     */
+    constexpr bool contains(const Vector3& point) const {
+      return point.x >= minimum.x && point.x <= maximum.x &&
+             point.y >= minimum.y && point.y <= maximum.y &&
+             point.z >= minimum.z && point.z <= maximum.z;
+    }
+
+    /**
+     * @brief Checks whether another box is entirely inside this one.
+     */
+    constexpr bool contains(const AABB& other) const {
+      return other.minimum.x >= minimum.x && other.maximum.x <= maximum.x &&
+             other.minimum.y >= minimum.y && other.maximum.y <= maximum.y &&
+             other.minimum.z >= minimum.z && other.maximum.z <= maximum.z;
+    }
+
+    /**
+     * @brief Checks whether two boxes overlap; touching boxes count as overlapping.
+     */
+    constexpr bool intersects(const AABB& other) const {
+      return minimum.x <= other.maximum.x && maximum.x >= other.minimum.x &&
+             minimum.y <= other.maximum.y && maximum.y >= other.minimum.y &&
+             minimum.z <= other.maximum.z && maximum.z >= other.minimum.z;
+    }
+
+    /**
+     * @brief Returns the point of the box closest to a given point.
+     */
+    constexpr Vector3 closestPoint(const Vector3& point) const {
+      return Vector3(EMin(EMax(point.x, minimum.x), maximum.x),
+                     EMin(EMax(point.y, minimum.y), maximum.y),
+                     EMin(EMax(point.z, minimum.z), maximum.z));
+    }
+
+    /**
+     * @brief Returns the smallest box containing this box and a point.
+     */
+    constexpr AABB merge(const Vector3& point) const {
+      return AABB(Vector3(EMin(minimum.x, point.x), EMin(minimum.y, point.y), EMin(minimum.z, point.z)),
+                  Vector3(EMax(maximum.x, point.x), EMax(maximum.y, point.y), EMax(maximum.z, point.z)));
+    }
+
+    /**
+     * @brief Returns the smallest box containing both boxes.
+     */
+    constexpr AABB merge(const AABB& other) const {
+      return AABB(Vector3(EMin(minimum.x, other.minimum.x), EMin(minimum.y, other.minimum.y),
+                          EMin(minimum.z, other.minimum.z)),
+                  Vector3(EMax(maximum.x, other.maximum.x), EMax(maximum.y, other.maximum.y),
+                          EMax(maximum.z, other.maximum.z)));
+    }
+
+    /**
+     * @brief Returns the box enclosing this box after an affine transform.
+     *
+     * Uses Arvo's method: the center is transformed as a point and each new half
+     * extent is the sum of the old extents weighted by the absolute matrix entries,
+     * which is exact for the eight transformed corners. An empty box stays empty.
+     *
+     * @param matrix The transform (row-vector convention, translation in row 3).
+     * @return The transformed box.
+     */
+    constexpr AABB transform(const Matrix4x4& matrix) const {
+      if (isEmpty()) {
+        return *this;
+      }
+      Vector3 c = matrix.transformPoint(center());
+      Vector3 e = extents();
+      Vector3 newExtents(
+        fabs(matrix.m[0][0]) * e.x + fabs(matrix.m[1][0]) * e.y + fabs(matrix.m[2][0]) * e.z,
+        fabs(matrix.m[0][1]) * e.x + fabs(matrix.m[1][1]) * e.y + fabs(matrix.m[2][1]) * e.z,
+        fabs(matrix.m[0][2]) * e.x + fabs(matrix.m[1][2]) * e.y + fabs(matrix.m[2][2]) * e.z);
+      return fromCenterExtents(c, newExtents);
+    }
+
+    /**
+     * @brief Writes the eight corners; bit 0/1/2 of the index selects maximum x/y/z.
+     *
+     * @param corners Receives the corners.
+     */
+    constexpr void getCorners(Vector3 corners[8]) const {
+      for (int i = 0; i < 8; ++i) {
+        corners[i] = Vector3((i & 1) ? maximum.x : minimum.x,
+                             (i & 2) ? maximum.y : minimum.y,
+                             (i & 4) ? maximum.z : minimum.z);
+      }
+    }
+  };
+
+  // The frustum kernels read each box as two overlapping four-float loads.
+  static_assert(sizeof(AABB) == 6 * sizeof(float), "AABB must be six packed floats");
+}
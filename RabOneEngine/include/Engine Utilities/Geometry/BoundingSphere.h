@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+#include "AABB.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief A bounding sphere.
+   *
+   * A negative radius marks an empty sphere; the default constructor makes one,
+   * and merging anything into it yields that thing.
+   */
+  class BoundingSphere {
+  public:
+    Vector3 center; /**< The center of the sphere. */
+    float radius;   /**< The radius; negative when the sphere is empty. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes an empty sphere at the origin.
+     */
+    constexpr BoundingSphere() : center(), radius(-1.0f) {}
+
+    /**
+     * @brief Constructs the sphere from its center and radius.
+     *
+     * @param center The center of the sphere.
+     * @param radius The radius of the sphere.
+     */
+    constexpr BoundingSphere(const Vector3& center, float radius) : center(center), radius(radius) {}
+
+    /**
+     * @brief Builds the sphere circumscribing a box.
+     */
+    static constexpr BoundingSphere fromAABB(const AABB& box) {
+      return box.isEmpty() ? BoundingSphere() : BoundingSphere(box.center(), box.extents().magnitude());
+    }
+
+    /**
+     * @brief Builds a sphere containing a set of points with Ritter's algorithm.
+     *
+     * The initial sphere spans the most distant pair among the points that are
+     * extreme on each axis; one more pass grows it over any point left outside.
+     * The result is typically within 5-20% of the minimal radius.
+     *
+     * @param points The points.
+     * @param count Number of points; zero gives an empty sphere.
+     * @return The sphere.
+     */
+    static BoundingSphere fromPoints(const Vector3* points, size_t count) {
+      if (count == 0) {
+        return BoundingSphere();
+      }
+      size_t minIndex[3] = { 0, 0, 0 };
+      size_t maxIndex[3] = { 0, 0, 0 };
+      for (size_t i = 1; i < count; ++i) {
+        const float* p = points[i].data();
+        for (int axis = 0; axis < 3; ++axis) {
+          if (p[axis] < points[minIndex[axis]].data()[axis]) {
+            minIndex[axis] = i;
+          }
+          if (p[axis] > points[maxIndex[axis]].data()[axis]) {
+            maxIndex[axis] = i;
+          }
+        }
+      }
+      int widest = 0;
+      float widestSquared = -1.0f;
+      for (int axis = 0; axis < 3; ++axis) {
+        Vector3 span = points[maxIndex[axis]] - points[minIndex[axis]];
+        float spanSquared = span.dot(span);
+        if (spanSquared > widestSquared) {
+          widestSquared = spanSquared;
+          widest = axis;
+        }
+      }
+      BoundingSphere sphere((points[minIndex[widest]] + points[maxIndex[widest]]) * 0.5f,
+                            sqrt(widestSquared) * 0.5f);
+      for (size_t i = 0; i < count; ++i) {
+        sphere = sphere.merge(points[i]);
+      }
+      return sphere;
+    }
+
+    /**
+     * @brief Checks whether the sphere is empty.
+     */
+    constexpr bool isEmpty() const {
+      return radius < 0.0f;
+    }
+
+    /**
+     * @brief Checks whether a point is inside or on the sphere.
+     */
+    constexpr bool contains(const Vector3& point) const {
+      Vector3 offset = point - center;
+      return offset.dot(offset) <= radius * radius && !isEmpty();
+    }
+
+    /**
+     * @brief Checks whether another sphere is entirely inside this one.
+     */
+    constexpr bool contains(const BoundingSphere& other) const {
+      if (isEmpty() || other.isEmpty() || other.radius > radius) {
+        return false;
+      }
+      Vector3 offset = other.center - center;
+      float slack = radius - other.radius;
+      return offset.dot(offset) <= slack * slack;
+    }
+
+    /**
+     * @brief Checks whether two spheres overlap; touching spheres count as overlapping.
+     */
+    constexpr bool intersects(const BoundingSphere& other) const {
+      Vector3 offset = other.center - center;
+      float reach = radius + other.radius;
+      return offset.dot(offset) <= reach * reach && !isEmpty() && !other.isEmpty();
+    }
+
+    /**
+     * @brief Checks whether the sphere overlaps a box.
+     */
+    constexpr bool intersects(const AABB& box) const {
+      Vector3 offset = box.closestPoint(center) - center;
+      return offset.dot(offset) <= radius * radius && !isEmpty() && !box.isEmpty();
+    }
+
+    /**
+     * @brief Returns the smallest sphere containing this sphere and a point.
+     */
+    constexpr BoundingSphere merge(const Vector3& point) const {
+      if (isEmpty()) {
+        return BoundingSphere(point, 0.0f);
+      }
+      Vector3 offset = point - center;
+      float distanceSquared = offset.dot(offset);
+      if (distanceSquared <= radius * radius) {
+        return *this;
+      }
+      float distance = sqrt(distanceSquared);
+      float newRadius = (radius + distance) * 0.5f;
+      return BoundingSphere(center + offset * ((newRadius - radius) / distance), newRadius);
+    }
+
+    /**
+     * @brief Returns the smallest sphere containing both spheres.
+     */
+    constexpr BoundingSphere merge(const BoundingSphere& other) const {
+      if (other.isEmpty() || contains(other)) {
+        return *this;
+      }
+      if (isEmpty() || other.contains(*this)) {
+        return other;
+      }
+      Vector3 offset = other.center - center;
+      float distance = offset.magnitude();
+      float newRadius = (radius + distance + other.radius) * 0.5f;
+      return BoundingSphere(center + offset * ((newRadius - radius) / distance), newRadius);
+    }
+
+    /**
+     * @brief Returns a sphere enclosing this one after an affine transform.
+     *
+     * The radius is scaled by the longest basis row, so non-uniform scale gives a
+     * conservative sphere.
+     *
+     * @param matrix The transform (row-vector convention, translation in row 3).
+     * @return The transformed sphere.
+     */
+    constexpr BoundingSphere transform(const Matrix4x4& matrix) const {
+      if (isEmpty()) {
+        return *this;
+      }
+      float scaleSquared = 0.0f;
+      for (int i = 0; i < 3; ++i) {
+        Vector3 row(matrix.m[i][0], matrix.m[i][1], matrix.m[i][2]);
+        scaleSquared = EMax(scaleSquared, row.dot(row));
+      }
+      return BoundingSphere(matrix.transformPoint(center), radius * sqrt(scaleSquared));
+    }
+
+    /**
+     * @brief Returns the box tightly enclosing the sphere.
+     */
+    constexpr AABB toAABB() const {
+      if (isEmpty()) {
+        return AABB();
+      }
+      Vector3 r(radius, radius, radius);
+      return AABB(center - r, center + r);
+    }
+  };
+}
@@ -0,0 +1,336 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+#include "Plane.h"
+#include "AABB.h"
+#include "BoundingSphere.h"
+#include "OBB.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief A view frustum bounded by six inward-facing planes.
+   *
+   * The planes are normalized, so the sphere tests work in world units. The
+   * volume tests are conservative: a volume that is outside the frustum but not
+   * entirely behind any single plane (near a corner) still counts as intersecting,
+   * which is the usual trade-off for culling.
+   */
+  class Frustum {
+  public:
+    /**
+     * @brief Indices of the planes in the planes array.
+     */
+    enum PlaneIndex {
+      Left = 0,
+      Right,
+      Bottom,
+      Top,
+      Near,
+      Far,
+      PlaneCount
+    };
+
+    Plane planes[PlaneCount]; /**< The planes; normals point into the frustum. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes the frustum of an identity view-projection: the clip volume
+     * -1 <= x, y <= 1, 0 <= z <= 1.
+     */
+    constexpr Frustum()
+      : planes{ Plane(1.0f, 0.0f, 0.0f, 1.0f), Plane(-1.0f, 0.0f, 0.0f, 1.0f),
+                Plane(0.0f, 1.0f, 0.0f, 1.0f), Plane(0.0f, -1.0f, 0.0f, 1.0f),
+                Plane(0.0f, 0.0f, 1.0f, 0.0f), Plane(0.0f, 0.0f, -1.0f, 1.0f) } {}
+
+    /**
+     * @brief Extracts the planes of a view-projection matrix (Gribb and Hartmann).
+     *
+     * With the row-vector convention a point p is inside when the clip position
+     * c = p * M satisfies -w <= x <= w, -w <= y <= w and 0 <= z <= w (the Direct3D
+     * depth range), so each plane is a sum or difference of columns of M. Passing
+     * a projection alone gives view-space planes; a world-view-projection gives
+     * object-space planes.
+     *
+     * @param viewProjection The combined view and projection matrix.
+     * @return The frustum.
+     */
+    static constexpr Frustum fromViewProjection(const Matrix4x4& viewProjection) {
+      const float(*m)[4] = viewProjection.m;
+      Frustum frustum;
+      frustum.planes[Left] = Plane(m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0]);
+      frustum.planes[Right] = Plane(m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0]);
+      frustum.planes[Bottom] = Plane(m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1]);
+      frustum.planes[Top] = Plane(m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1]);
+      frustum.planes[Near] = Plane(m[0][2], m[1][2], m[2][2], m[3][2]);
+      frustum.planes[Far] = Plane(m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2]);
+      for (int i = 0; i < PlaneCount; ++i) {
+        frustum.planes[i] = frustum.planes[i].normalize();
+      }
+      return frustum;
+    }
+
+    /**
+     * @brief Checks whether a point is inside or on the frustum.
+     */
+    constexpr bool contains(const Vector3& point) const {
+      for (int i = 0; i < PlaneCount; ++i) {
+        if (planes[i].signedDistance(point) < 0.0f) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Checks whether a sphere is at least partly inside the frustum.
+     */
+    constexpr bool intersects(const BoundingSphere& sphere) const {
+      if (sphere.isEmpty()) {
+        return false;
+      }
+      for (int i = 0; i < PlaneCount; ++i) {
+        if (planes[i].signedDistance(sphere.center) < -sphere.radius) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Checks whether a box is at least partly inside the frustum.
+     *
+     * A box is rejected when its center is further behind some plane than its
+     * projected radius along that plane's normal. This is the same arithmetic as
+     * the batch cullAABBs kernels, so both give the same answers.
+     *
+     * @param box A non-empty box.
+     * @return False if the box is entirely behind one of the planes.
+     */
+    constexpr bool intersects(const AABB& box) const {
+      Vector3 c = (box.minimum + box.maximum) * 0.5f;
+      Vector3 e = (box.maximum - box.minimum) * 0.5f;
+      for (int i = 0; i < PlaneCount; ++i) {
+        const Plane& p = planes[i];
+        float distance = p.normal.x * c.x + p.normal.y * c.y + p.normal.z * c.z + p.d;
+        float radius = fabs(p.normal.x) * e.x + fabs(p.normal.y) * e.y + fabs(p.normal.z) * e.z;
+        if (distance + radius < 0.0f) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Checks whether an oriented box is at least partly inside the frustum.
+     */
+    constexpr bool intersects(const OBB& box) const {
+      for (int i = 0; i < PlaneCount; ++i) {
+        const Plane& p = planes[i];
+        float radius = fabs(p.normal.dot(box.axes[0])) * box.extents.x +
+                       fabs(p.normal.dot(box.axes[1])) * box.extents.y +
+                       fabs(p.normal.dot(box.axes[2])) * box.extents.z;
+        if (p.signedDistance(box.center) + radius < 0.0f) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+#if ENGINE_SIMD_SSE2
+  /**
+   * @brief Tests four boxes against the frustum; bit i is set if box i may be visible.
+   *
+   * Each box is read as two overlapping four-float loads, (min.xyz, max.x) and
+   * (min.z, max.xyz), and a 4x4 transpose turns them into SoA rows.
+   */
+  inline uint32_t frustumTestAABBs4(const Frustum& frustum, const AABB* boxes) {
+    __m128 lo0 = _mm_loadu_ps(&boxes[0].minimum.x);
+    __m128 lo1 = _mm_loadu_ps(&boxes[1].minimum.x);
+    __m128 lo2 = _mm_loadu_ps(&boxes[2].minimum.x);
+    __m128 lo3 = _mm_loadu_ps(&boxes[3].minimum.x);
+    __m128 hi0 = _mm_loadu_ps(&boxes[0].minimum.z);
+    __m128 hi1 = _mm_loadu_ps(&boxes[1].minimum.z);
+    __m128 hi2 = _mm_loadu_ps(&boxes[2].minimum.z);
+    __m128 hi3 = _mm_loadu_ps(&boxes[3].minimum.z);
+    _MM_TRANSPOSE4_PS(lo0, lo1, lo2, lo3);
+    _MM_TRANSPOSE4_PS(hi0, hi1, hi2, hi3);
+    // lo0..lo2 now hold min x, y, z and hi1..hi3 max x, y, z.
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128 cx = _mm_mul_ps(_mm_add_ps(lo0, hi1), half);
+    __m128 cy = _mm_mul_ps(_mm_add_ps(lo1, hi2), half);
+    __m128 cz = _mm_mul_ps(_mm_add_ps(lo2, hi3), half);
+    __m128 ex = _mm_mul_ps(_mm_sub_ps(hi1, lo0), half);
+    __m128 ey = _mm_mul_ps(_mm_sub_ps(hi2, lo1), half);
+    __m128 ez = _mm_mul_ps(_mm_sub_ps(hi3, lo2), half);
+    __m128 outside = _mm_setzero_ps();
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+      const Plane& p = frustum.planes[i];
+      __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(p.normal.x), cx), _mm_mul_ps(_mm_set1_ps(p.normal.y), cy)),
+        _mm_mul_ps(_mm_set1_ps(p.normal.z), cz)), _mm_set1_ps(p.d));
+      __m128 radius = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(fabs(p.normal.x)), ex), _mm_mul_ps(_mm_set1_ps(fabs(p.normal.y)), ey)),
+        _mm_mul_ps(_mm_set1_ps(fabs(p.normal.z)), ez));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+    }
+    return static_cast<uint32_t>(~_mm_movemask_ps(outside)) & 0xFu;
+  }
+#endif
+
+#if ENGINE_SIMD_AVX2
+  /**
+   * @brief Tests eight boxes against the frustum; bit i is set if box i may be visible.
+   *
+   * Boxes i and i + 4 share a register, so the in-lane transpose yields SoA rows
+   * ordered 0..7.
+   */
+  inline uint32_t frustumTestAABBs8(const Frustum& frustum, const AABB* boxes) {
+    __m256 lo[4];
+    __m256 hi[4];
+    for (int k = 0; k < 4; ++k) {
+      lo[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&boxes[k].minimum.x)),
+                                   _mm_loadu_ps(&boxes[k + 4].minimum.x), 1);
+      hi[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&boxes[k].minimum.z)),
+                                   _mm_loadu_ps(&boxes[k + 4].minimum.z), 1);
+    }
+    __m256 t0 = _mm256_unpacklo_ps(lo[0], lo[1]);
+    __m256 t1 = _mm256_unpacklo_ps(lo[2], lo[3]);
+    __m256 t2 = _mm256_unpackhi_ps(lo[0], lo[1]);
+    __m256 t3 = _mm256_unpackhi_ps(lo[2], lo[3]);
+    __m256 minX = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 minY = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 minZ = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    t0 = _mm256_unpacklo_ps(hi[0], hi[1]);
+    t1 = _mm256_unpacklo_ps(hi[2], hi[3]);
+    t2 = _mm256_unpackhi_ps(hi[0], hi[1]);
+    t3 = _mm256_unpackhi_ps(hi[2], hi[3]);
+    __m256 maxX = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 maxY = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 maxZ = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+    const __m256 half = _mm256_set1_ps(0.5f);
+    __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+    __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+    __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+    __m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+    __m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+    __m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+    __m256 outside = _mm256_setzero_ps();
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+      const Plane& p = frustum.planes[i];
+      __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(p.normal.x), cx), _mm256_mul_ps(_mm256_set1_ps(p.normal.y), cy)),
+        _mm256_mul_ps(_mm256_set1_ps(p.normal.z), cz)), _mm256_set1_ps(p.d));
+      __m256 radius = _mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(_mm256_set1_ps(fabs(p.normal.x)), ex), _mm256_mul_ps(_mm256_set1_ps(fabs(p.normal.y)), ey)),
+        _mm256_mul_ps(_mm256_set1_ps(fabs(p.normal.z)), ez));
+      outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+    }
+    return static_cast<uint32_t>(~_mm256_movemask_ps(outside)) & 0xFFu;
+  }
+#endif
+
+  /**
+   * @brief Tests an array of boxes against a frustum.
+   *
+   * Eight boxes per iteration with AVX2, four with SSE, then one at a time; every
+   * path matches Frustum::intersects(const AABB&).
+   *
+   * @param frustum The frustum.
+   * @param boxes The boxes; none may be empty.
+   * @param visible Receives 1 for each box that may be visible and 0 otherwise.
+   * @param count Number of boxes.
+   */
+  inline void
+  frustumTestAABBs(const Frustum& frustum, const AABB* boxes, uint8_t* visible, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_AVX2
+    for (; i + 8 <= count; i += 8) {
+      uint32_t mask = frustumTestAABBs8(frustum, boxes + i);
+      for (int k = 0; k < 8; ++k) {
+        visible[i + k] = static_cast<uint8_t>((mask >> k) & 1u);
+      }
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    for (; i + 4 <= count; i += 4) {
+      uint32_t mask = frustumTestAABBs4(frustum, boxes + i);
+      for (int k = 0; k < 4; ++k) {
+        visible[i + k] = static_cast<uint8_t>((mask >> k) & 1u);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      visible[i] = frustum.intersects(boxes[i]) ? 1 : 0;
+    }
+  }
+
+  /**
+   * @brief Culls an array of boxes, writing the indices of the ones that may be visible.
+   *
+   * @param frustum The frustum.
+   * @param boxes The boxes; none may be empty.
+   * @param visibleIndices Receives the indices of the visible boxes in ascending order;
+   * must have room for count entries.
+   * @param count Number of boxes.
+   * @return The number of indices written.
+   */
+  inline size_t
+  cullAABBs(const Frustum& frustum, const AABB* boxes, uint32_t* visibleIndices, size_t count) {
+    size_t visibleCount = 0;
+    size_t i = 0;
+#if ENGINE_SIMD_AVX2
+    for (; i + 8 <= count; i += 8) {
+      for (uint32_t mask = frustumTestAABBs8(frustum, boxes + i); mask != 0; mask &= mask - 1) {
+        visibleIndices[visibleCount++] = static_cast<uint32_t>(i) + CountTrailingZeros(mask);
+      }
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    for (; i + 4 <= count; i += 4) {
+      for (uint32_t mask = frustumTestAABBs4(frustum, boxes + i); mask != 0; mask &= mask - 1) {
+        visibleIndices[visibleCount++] = static_cast<uint32_t>(i) + CountTrailingZeros(mask);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      if (frustum.intersects(boxes[i])) {
+        visibleIndices[visibleCount++] = static_cast<uint32_t>(i);
+      }
+    }
+    return visibleCount;
+  }
+}
@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+#include "AABB.h"
+#include "BoundingSphere.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief An oriented bounding box.
+   *
+   * The box is a center, three orthonormal axes and the half extent along each
+   * axis. Built from an AABB and a world matrix, axis i is the normalized row i of
+   * the matrix, so the box stays exact for rotation, translation and any scale
+   * that does not shear.
+   */
+  class OBB {
+  public:
+    Vector3 center;  /**< The center of the box. */
+    Vector3 extents; /**< Half the size of the box along each axis. */
+    Vector3 axes[3]; /**< The orthonormal box axes. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes a degenerate box at the origin aligned with the world axes.
+     */
+    constexpr OBB()
+      : center(), extents(),
+        axes{ Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f) } {}
+
+    /**
+     * @brief Constructs the box from its parts.
+     *
+     * @param center The center of the box.
+     * @param extents Half the size of the box along each axis.
+     * @param axisX The first axis (unit length).
+     * @param axisY The second axis (unit length, orthogonal to axisX).
+     * @param axisZ The third axis (unit length, orthogonal to both).
+     */
+    constexpr OBB(const Vector3& center, const Vector3& extents,
+                  const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ)
+      : center(center), extents(extents), axes{ axisX, axisY, axisZ } {}
+
+    /**
+     * @brief Builds the box covering an AABB.
+     */
+    static constexpr OBB fromAABB(const AABB& box) {
+      return OBB(box.center(), box.extents(),
+                 Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f));
+    }
+
+    /**
+     * @brief Builds the box covering a local-space AABB placed by a world matrix.
+     *
+     * @param box The box in local space.
+     * @param world The local-to-world transform.
+     * @return The world-space box.
+     */
+    static constexpr OBB fromAABB(const AABB& box, const Matrix4x4& world) {
+      return fromAABB(box).transform(world);
+    }
+
+    /**
+     * @brief Returns the box after an affine transform.
+     *
+     * Each scaled axis is transformed as a direction; its length becomes the new
+     * extent and its direction the new axis. With shear the axes stop being
+     * orthogonal and the result is only approximate.
+     *
+     * @param matrix The transform (row-vector convention, translation in row 3).
+     * @return The transformed box.
+     */
+    constexpr OBB transform(const Matrix4x4& matrix) const {
+      // Vector3::data() is not usable as an array in constant expressions.
+      const float e[3] = { extents.x, extents.y, extents.z };
+      float newExtents[3] = {};
+      OBB result;
+      result.center = matrix.transformPoint(center);
+      for (int i = 0; i < 3; ++i) {
+        Vector3 axis = matrix.transformVector(axes[i]);
+        float length = axis.magnitude();
+        newExtents[i] = e[i] * length;
+        if (length > 0.0f) {
+          result.axes[i] = axis * (1.0f / length);
+        }
+      }
+      result.extents = Vector3(newExtents[0], newExtents[1], newExtents[2]);
+      return result;
+    }
+
+    /**
+     * @brief Returns the world AABB enclosing the box.
+     */
+    constexpr AABB toAABB() const {
+      Vector3 half(
+        fabs(axes[0].x) * extents.x + fabs(axes[1].x) * extents.y + fabs(axes[2].x) * extents.z,
+        fabs(axes[0].y) * extents.x + fabs(axes[1].y) * extents.y + fabs(axes[2].y) * extents.z,
+        fabs(axes[0].z) * extents.x + fabs(axes[1].z) * extents.y + fabs(axes[2].z) * extents.z);
+      return AABB::fromCenterExtents(center, half);
+    }
+
+    /**
+     * @brief Returns the point of the box closest to a given point.
+     */
+    constexpr Vector3 closestPoint(const Vector3& point) const {
+      Vector3 offset = point - center;
+      Vector3 result = center;
+      const float e[3] = { extents.x, extents.y, extents.z };
+      for (int i = 0; i < 3; ++i) {
+        float distance = EMin(EMax(offset.dot(axes[i]), -e[i]), e[i]);
+        result = result + axes[i] * distance;
+      }
+      return result;
+    }
+
+    /**
+     * @brief Checks whether a point is inside or on the box.
+     */
+    constexpr bool contains(const Vector3& point) const {
+      Vector3 offset = point - center;
+      return fabs(offset.dot(axes[0])) <= extents.x &&
+             fabs(offset.dot(axes[1])) <= extents.y &&
+             fabs(offset.dot(axes[2])) <= extents.z;
+    }
+
+    /**
+     * @brief Checks whether the box overlaps a sphere.
+     */
+    constexpr bool intersects(const BoundingSphere& sphere) const {
+      Vector3 offset = closestPoint(sphere.center) - sphere.center;
+      return offset.dot(offset) <= sphere.radius * sphere.radius && !sphere.isEmpty();
+    }
+
+    /**
+     * @brief Checks whether two boxes overlap with the separating axis test.
+     *
+     * Tests the 15 candidate axes of Gottschalk et al.: the three axes of each box
+     * and their nine cross products. A small epsilon on the rotation terms keeps
+     * nearly parallel edges from producing a false separating axis.
+     *
+     * @param other The other box.
+     * @return True if the boxes overlap or touch.
+     */
+    constexpr bool intersects(const OBB& other) const {
+      constexpr float epsilon = 1e-6f;
+      const float a[3] = { extents.x, extents.y, extents.z };
+      const float b[3] = { other.extents.x, other.extents.y, other.extents.z };
+      float r[3][3] = {};
+      float absR[3][3] = {};
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          r[i][j] = axes[i].dot(other.axes[j]);
+          absR[i][j] = fabs(r[i][j]) + epsilon;
+        }
+      }
+      Vector3 offset = other.center - center;
+      float t[3] = { offset.dot(axes[0]), offset.dot(axes[1]), offset.dot(axes[2]) };
+
+      for (int i = 0; i < 3; ++i) {
+        float ra = a[i];
+        float rb = b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2];
+        if (fabs(t[i]) > ra + rb) {
+          return false;
+        }
+      }
+      for (int j = 0; j < 3; ++j) {
+        float ra = a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j];
+        float rb = b[j];
+        if (fabs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + rb) {
+          return false;
+        }
+      }
+      // Axis A_i x B_j; i1, i2 and j1, j2 are the other two indices.
+      for (int i = 0; i < 3; ++i) {
+        int i1 = (i + 1) % 3;
+        int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j) {
+          int j1 = (j + 1) % 3;
+          int j2 = (j + 2) % 3;
+          float ra = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+          float rb = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+          if (fabs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Checks whether the box overlaps an AABB.
+     */
+    constexpr bool intersects(const AABB& box) const {
+      return !box.isEmpty() && intersects(fromAABB(box));
+    }
+
+    /**
+     * @brief Writes the eight corners; bit 0/1/2 of the index selects +x/+y/+z.
+     *
+     * @param corners Receives the corners.
+     */
+    constexpr void getCorners(Vector3 corners[8]) const {
+      Vector3 x = axes[0] * extents.x;
+      Vector3 y = axes[1] * extents.y;
+      Vector3 z = axes[2] * extents.z;
+      for (int i = 0; i < 8; ++i) {
+        corners[i] = center + ((i & 1) ? x : x * -1.0f) + ((i & 2) ? y : y * -1.0f) +
+                     ((i & 4) ? z : z * -1.0f);
+      }
+    }
+  };
+}
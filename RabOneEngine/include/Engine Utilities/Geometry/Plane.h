@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief A plane stored as normal . p + d = 0.
+   *
+   * Points with a positive signed distance are in front of the plane (on the side
+   * the normal points to). The frustum keeps its planes normalized, so signed
+   * distances are in world units.
+   */
+  class Plane {
+  public:
+    Vector3 normal; /**< The plane normal. */
+    float d;        /**< The negated distance from the origin along the normal. */
+
+    /**
+     * @brief Default constructor.
+     *
+     * Initializes the plane to y = 0, facing +Y.
+     */
+    constexpr Plane() : normal(0.0f, 1.0f, 0.0f), d(0.0f) {}
+
+    /**
+     * @brief Constructs the plane from its normal and d.
+     *
+     * @param normal The plane normal.
+     * @param d The plane constant.
+     */
+    constexpr Plane(const Vector3& normal, float d) : normal(normal), d(d) {}
+
+    /**
+     * @brief Constructs the plane from the coefficients of ax + by + cz + d = 0.
+     */
+    constexpr Plane(float a, float b, float c, float d) : normal(a, b, c), d(d) {}
+
+    /**
+     * @brief Builds the plane through a point with the given normal.
+     *
+     * @param point A point on the plane.
+     * @param normal The plane normal.
+     * @return The plane.
+     */
+    static constexpr Plane fromPointNormal(const Vector3& point, const Vector3& normal) {
+      return Plane(normal, -normal.dot(point));
+    }
+
+    /**
+     * @brief Signed distance from a point, scaled by the normal's length.
+     *
+     * @param point The point to test.
+     * @return Positive in front of the plane, negative behind it.
+     */
+    constexpr float signedDistance(const Vector3& point) const {
+      return normal.dot(point) + d;
+    }
+
+    /**
+     * @brief Scales the plane so its normal has unit length.
+     *
+     * @return The normalized plane, or the plane unchanged if its normal is zero.
+     */
+    constexpr Plane normalize() const {
+      float length = normal.magnitude();
+      if (length == 0.0f) {
+        return *this;
+      }
+      float invLength = 1.0f / length;
+      return Plane(normal * invLength, d * invLength);
+    }
+  };
+}
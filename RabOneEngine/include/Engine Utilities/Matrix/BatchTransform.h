@@ -0,0 +1,312 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Matrix4x4.h"
+
+namespace EngineUtilities {
+  /**
+   * @file BatchTransform.h
+   * @brief Kernels that transform many points or directions by one Matrix4x4.
+   *
+   * The kernels work on SoA streams (separate x, y and z arrays), 8 at a time with
+   * AVX2, then 4 with SSE, then one at a time. AoS data such as SimpleVertex::Pos
+   * is processed in blocks: each block is split into SoA on the stack, transformed
+   * and packed back. The matrix is treated as affine (row-vector convention), so
+   * its fourth column is ignored and no perspective divide happens.
+   *
+   * Input and output may alias exactly (in-place), but must not partially overlap.
+   */
+
+  /**
+   * @brief Number of elements the AoS kernels transform per stack block.
+   */
+  constexpr size_t BatchTransformBlockSize = 256;
+
+  /**
+   * @brief Transforms element i of the SoA streams; the scalar step of transformStreams.
+   */
+  inline void
+  transformStreamElement(const Matrix4x4& matrix,
+                         const float* inX, const float* inY, const float* inZ,
+                         float* outX, float* outY, float* outZ,
+                         size_t i, float tx, float ty, float tz) {
+    float x = inX[i];
+    float y = inY[i];
+    float z = inZ[i];
+    outX[i] = x * matrix.m[0][0] + y * matrix.m[1][0] + z * matrix.m[2][0] + tx;
+    outY[i] = x * matrix.m[0][1] + y * matrix.m[1][1] + z * matrix.m[2][1] + ty;
+    outZ[i] = x * matrix.m[0][2] + y * matrix.m[1][2] + z * matrix.m[2][2] + tz;
+  }
+
+  /**
+   * @brief Transforms SoA streams by the 3x3 part of a matrix plus w times its translation.
+   *
+   * @param matrix The transform.
+   * @param inX Input x stream.
+   * @param inY Input y stream.
+   * @param inZ Input z stream.
+   * @param outX Output x stream.
+   * @param outY Output y stream.
+   * @param outZ Output z stream.
+   * @param count Number of elements.
+   * @param w 1 for points, 0 for directions.
+   */
+  inline void
+  transformStreams(const Matrix4x4& matrix,
+                   const float* inX, const float* inY, const float* inZ,
+                   float* outX, float* outY, float* outZ,
+                   size_t count, float w) {
+    const float tx = matrix.m[3][0] * w;
+    const float ty = matrix.m[3][1] * w;
+    const float tz = matrix.m[3][2] * w;
+    size_t i = 0;
+#if ENGINE_SIMD_AVX2
+    {
+      const __m256 m00 = _mm256_set1_ps(matrix.m[0][0]), m01 = _mm256_set1_ps(matrix.m[0][1]), m02 = _mm256_set1_ps(matrix.m[0][2]);
+      const __m256 m10 = _mm256_set1_ps(matrix.m[1][0]), m11 = _mm256_set1_ps(matrix.m[1][1]), m12 = _mm256_set1_ps(matrix.m[1][2]);
+      const __m256 m20 = _mm256_set1_ps(matrix.m[2][0]), m21 = _mm256_set1_ps(matrix.m[2][1]), m22 = _mm256_set1_ps(matrix.m[2][2]);
+      const __m256 t0 = _mm256_set1_ps(tx), t1 = _mm256_set1_ps(ty), t2 = _mm256_set1_ps(tz);
+      // Unaligned 32-byte accesses split cache lines every other iteration, which made this
+      // loop slower than the SSE one on streams that do not fit in the cache. malloc returns
+      // 16-byte aligned blocks, so aligning the output usually aligns every stream.
+      if (count >= 16) {
+        for (; i < 7 && (reinterpret_cast<uintptr_t>(outX + i) & 31) != 0; ++i) {
+          transformStreamElement(matrix, inX, inY, inZ, outX, outY, outZ, i, tx, ty, tz);
+        }
+      }
+      for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(inX + i);
+        __m256 y = _mm256_loadu_ps(inY + i);
+        __m256 z = _mm256_loadu_ps(inZ + i);
+        __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)),
+                                  _mm256_add_ps(_mm256_mul_ps(z, m20), t0));
+        __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)),
+                                  _mm256_add_ps(_mm256_mul_ps(z, m21), t1));
+        __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)),
+                                  _mm256_add_ps(_mm256_mul_ps(z, m22), t2));
+        _mm256_storeu_ps(outX + i, rx);
+        _mm256_storeu_ps(outY + i, ry);
+        _mm256_storeu_ps(outZ + i, rz);
+      }
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    {
+      const __m128 m00 = _mm_set1_ps(matrix.m[0][0]), m01 = _mm_set1_ps(matrix.m[0][1]), m02 = _mm_set1_ps(matrix.m[0][2]);
+      const __m128 m10 = _mm_set1_ps(matrix.m[1][0]), m11 = _mm_set1_ps(matrix.m[1][1]), m12 = _mm_set1_ps(matrix.m[1][2]);
+      const __m128 m20 = _mm_set1_ps(matrix.m[2][0]), m21 = _mm_set1_ps(matrix.m[2][1]), m22 = _mm_set1_ps(matrix.m[2][2]);
+      const __m128 t0 = _mm_set1_ps(tx), t1 = _mm_set1_ps(ty), t2 = _mm_set1_ps(tz);
+      for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(inX + i);
+        __m128 y = _mm_loadu_ps(inY + i);
+        __m128 z = _mm_loadu_ps(inZ + i);
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)),
+                               _mm_add_ps(_mm_mul_ps(z, m20), t0));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)),
+                               _mm_add_ps(_mm_mul_ps(z, m21), t1));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)),
+                               _mm_add_ps(_mm_mul_ps(z, m22), t2));
+        _mm_storeu_ps(outX + i, rx);
+        _mm_storeu_ps(outY + i, ry);
+        _mm_storeu_ps(outZ + i, rz);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      transformStreamElement(matrix, inX, inY, inZ, outX, outY, outZ, i, tx, ty, tz);
+    }
+  }
+
+  /**
+   * @brief Transforms SoA points (w = 1).
+   */
+  inline void
+  transformPointsSoA(const Matrix4x4& matrix,
+                     const float* inX, const float* inY, const float* inZ,
+                     float* outX, float* outY, float* outZ, size_t count) {
+    transformStreams(matrix, inX, inY, inZ, outX, outY, outZ, count, 1.0f);
+  }
+
+  /**
+   * @brief Transforms SoA directions (w = 0); the translation is ignored.
+   */
+  inline void
+  transformVectorsSoA(const Matrix4x4& matrix,
+                      const float* inX, const float* inY, const float* inZ,
+                      float* outX, float* outY, float* outZ, size_t count) {
+    transformStreams(matrix, inX, inY, inZ, outX, outY, outZ, count, 0.0f);
+  }
+
+  /**
+   * @brief Splits strided float3 records into x, y and z streams (AoS to SoA).
+   *
+   * Tightly packed input (stride of 12 bytes) is transposed four records at a time
+   * with SSE shuffles; any other stride, such as sizeof(SimpleVertex), is gathered
+   * one record at a time.
+   *
+   * @param aos Address of the first float3.
+   * @param stride Distance in bytes between consecutive float3s.
+   * @param x Receives the x components.
+   * @param y Receives the y components.
+   * @param z Receives the z components.
+   * @param count Number of records.
+   */
+  inline void
+  aosToSoA3(const void* aos, size_t stride, float* x, float* y, float* z, size_t count) {
+    const char* src = static_cast<const char*>(aos);
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    if (stride == 3 * sizeof(float)) {
+      const float* packed = static_cast<const float*>(aos);
+      for (; i + 4 <= count; i += 4) {
+        __m128 vx, vy, vz;
+        SimdDeinterleave3(_mm_loadu_ps(packed + i * 3), _mm_loadu_ps(packed + i * 3 + 4),
+                          _mm_loadu_ps(packed + i * 3 + 8), vx, vy, vz);
+        _mm_storeu_ps(x + i, vx);
+        _mm_storeu_ps(y + i, vy);
+        _mm_storeu_ps(z + i, vz);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      float record[3];
+      std::memcpy(record, src + i * stride, sizeof(record));
+      x[i] = record[0];
+      y[i] = record[1];
+      z[i] = record[2];
+    }
+  }
+
+  /**
+   * @brief Packs x, y and z streams into strided float3 records (SoA to AoS).
+   *
+   * Only the 12 bytes of each float3 are written, so other fields of the record
+   * (for example SimpleVertex::Tex) are left untouched.
+   *
+   * @param x The x components.
+   * @param y The y components.
+   * @param z The z components.
+   * @param aos Address of the first float3.
+   * @param stride Distance in bytes between consecutive float3s.
+   * @param count Number of records.
+   */
+  inline void
+  soaToAoS3(const float* x, const float* y, const float* z, void* aos, size_t stride, size_t count) {
+    char* dst = static_cast<char*>(aos);
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    if (stride == 3 * sizeof(float)) {
+      float* packed = static_cast<float*>(aos);
+      for (; i + 4 <= count; i += 4) {
+        __m128 a, b, c;
+        SimdInterleave3(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i), a, b, c);
+        _mm_storeu_ps(packed + i * 3, a);
+        _mm_storeu_ps(packed + i * 3 + 4, b);
+        _mm_storeu_ps(packed + i * 3 + 8, c);
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      float record[3] = { x[i], y[i], z[i] };
+      std::memcpy(dst + i * stride, record, sizeof(record));
+    }
+  }
+
+  /**
+   * @brief Transforms strided float3 records in stack blocks of BatchTransformBlockSize.
+   *
+   * @param matrix The transform.
+   * @param input Address of the first input float3.
+   * @param inputStride Distance in bytes between input float3s.
+   * @param output Address of the first output float3.
+   * @param outputStride Distance in bytes between output float3s.
+   * @param count Number of records.
+   * @param w 1 for points, 0 for directions.
+   */
+  inline void
+  transformRecords(const Matrix4x4& matrix,
+                   const void* input, size_t inputStride,
+                   void* output, size_t outputStride,
+                   size_t count, float w) {
+    alignas(32) float x[BatchTransformBlockSize];
+    alignas(32) float y[BatchTransformBlockSize];
+    alignas(32) float z[BatchTransformBlockSize];
+    const char* src = static_cast<const char*>(input);
+    char* dst = static_cast<char*>(output);
+    for (size_t base = 0; base < count; base += BatchTransformBlockSize) {
+      size_t n = count - base < BatchTransformBlockSize ? count - base : BatchTransformBlockSize;
+      aosToSoA3(src + base * inputStride, inputStride, x, y, z, n);
+      transformStreams(matrix, x, y, z, x, y, z, n, w);
+      soaToAoS3(x, y, z, dst + base * outputStride, outputStride, n);
+    }
+  }
+
+  /**
+   * @brief Transforms strided AoS points (w = 1).
+   *
+   * Example, transforming mesh positions to world space:
+   *   transformPointsAoS(world, &vertices[0].Pos, sizeof(SimpleVertex),
+   *                      &worldVertices[0].Pos, sizeof(SimpleVertex), vertices.size());
+   */
+  inline void
+  transformPointsAoS(const Matrix4x4& matrix,
+                     const void* input, size_t inputStride,
+                     void* output, size_t outputStride, size_t count) {
+    transformRecords(matrix, input, inputStride, output, outputStride, count, 1.0f);
+  }
+
+  /**
+   * @brief Transforms strided AoS directions (w = 0); the translation is ignored.
+   */
+  inline void
+  transformVectorsAoS(const Matrix4x4& matrix,
+                      const void* input, size_t inputStride,
+                      void* output, size_t outputStride, size_t count) {
+    transformRecords(matrix, input, inputStride, output, outputStride, count, 0.0f);
+  }
+
+  /**
+   * @brief Transforms an array of Vector3 points.
+   */
+  inline void
+  transformPoints(const Matrix4x4& matrix, const Vector3* input, Vector3* output, size_t count) {
+    transformPointsAoS(matrix, input, sizeof(Vector3), output, sizeof(Vector3), count);
+  }
+
+  /**
+   * @brief Transforms an array of Vector3 directions; the translation is ignored.
+   */
+  inline void
+  transformVectors(const Matrix4x4& matrix, const Vector3* input, Vector3* output, size_t count) {
+    transformVectorsAoS(matrix, input, sizeof(Vector3), output, sizeof(Vector3), count);
+  }
+}
\ No newline at end of file
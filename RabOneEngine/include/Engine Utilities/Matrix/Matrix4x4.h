@@ -27,38 +27,35 @@
  * SOFTWARE.
 */
 #pragma once
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Vectors/Vector4.h"
+
 namespace EngineUtilities {
   /**
  * @brief A 4x4 matrix class.
  *
  * This class represents a 4x4 matrix and provides basic matrix operations such as
  * addition, subtraction, multiplication, determinant calculation, and inversion.
+ *
+ * The matrix is stored row-major and follows the row-vector convention used by
+ * Direct3D: a point is transformed as v * M, the translation lives in the fourth
+ * row, and A * B applies A first. Each row is 16-byte aligned so it loads into
+ * one SSE register; the hot operations use SSE (AVX2 for the product) when
+ * available and scalar code otherwise. Constant expressions always take the
+ * scalar code, so constant transforms can be built at compile time.
  */
-  class Matrix4x4 {
+  class alignas(16) Matrix4x4 {
   public:
     float m[4][4]; /**< The elements of the matrix. */
 
-    // Default constructor initializes to identity matrix
-    Matrix4x4() {
-      for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < 4; ++j) {
-          m[i][j] = (i == j) ? 1.0f : 0.0f;
-        }
-      }
-    }
-
     /**
      * @brief Default constructor.
      *
      * Initializes the matrix to the identity matrix.
      */
-    Matrix4x4() {
-      m[0][0] = 1; m[0][1] = 0; m[0][2] = 0; m[0][3] = 0;
-      m[1][0] = 0; m[1][1] = 1; m[1][2] = 0; m[1][3] = 0;
-      m[2][0] = 0; m[2][1] = 0; m[2][2] = 1; m[2][3] = 0;
-      m[3][0] = 0; m[3][1] = 0; m[3][2] = 0; m[3][3] = 1;
-    }
-
+    constexpr Matrix4x4()
+      : m{ { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } } {}
 
     /**
      * @brief Parameterized constructor.
@@ -82,24 +79,45 @@ namespace EngineUtilities {
      * @param a43 Element at row 4, column 3.
      * @param a44 Element at row 4, column 4.
      */
-    Matrix4x4(float a11, float a12, float a13, float a14,
+    constexpr Matrix4x4(float a11, float a12, float a13, float a14,
       float a21, float a22, float a23, float a24,
       float a31, float a32, float a33, float a34,
-      float a41, float a42, float a43, float a44) {
-      m[0][0] = a11; m[0][1] = a12; m[0][2] = a13; m[0][3] = a14;
-      m[1][0] = a21; m[1][1] = a22; m[1][2] = a23; m[1][3] = a24;
-      m[2][0] = a31; m[2][1] = a32; m[2][2] = a33; m[2][3] = a34;
-      m[3][0] = a41; m[3][1] = a42; m[3][2] = a43; m[3][3] = a44;
-    }
+      float a41, float a42, float a43, float a44)
+      : m{ { a11, a12, a13, a14 }, { a21, a22, a23, a24 },
+           { a31, a32, a33, a34 }, { a41, a42, a43, a44 } } {}
 
     // Copy constructor
-    Matrix4x4(const Matrix4x4& other) {
-      for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < 4; ++j) {
-          m[i][j] = other.m[i][j];
-        }
-      }
+    Matrix4x4(const Matrix4x4& other) = default;
+    Matrix4x4& operator=(const Matrix4x4& other) = default;
+
+#if ENGINE_SIMD_SSE2
+    /**
+     * @brief Constructs the matrix from four SSE rows.
+     */
+    Matrix4x4(__m128 row0, __m128 row1, __m128 row2, __m128 row3) {
+      setRows(row0, row1, row2, row3);
+    }
+
+    /**
+     * @brief Loads one row into an SSE register.
+     *
+     * @param index Row index in [0, 3].
+     * @return The row as (m[index][0], ..., m[index][3]).
+     */
+    __m128 row(int index) const {
+      return _mm_load_ps(m[index]);
+    }
+
+    /**
+     * @brief Stores four SSE rows into the matrix.
+     */
+    void setRows(__m128 row0, __m128 row1, __m128 row2, __m128 row3) {
+      _mm_store_ps(m[0], row0);
+      _mm_store_ps(m[1], row1);
+      _mm_store_ps(m[2], row2);
+      _mm_store_ps(m[3], row3);
     }
+#endif
 
     /**
      * @brief Adds another matrix to this matrix.
@@ -107,7 +125,7 @@ namespace EngineUtilities {
      * @param other The matrix to add.
      * @return The result of the addition.
      */
-    Matrix4x4 operator+(const Matrix4x4& other) const {
+    constexpr Matrix4x4 operator+(const Matrix4x4& other) const {
       return Matrix4x4(
         m[0][0] + other.m[0][0], m[0][1] + other.m[0][1], m[0][2] + other.m[0][2], m[0][3] + other.m[0][3],
         m[1][0] + other.m[1][0], m[1][1] + other.m[1][1], m[1][2] + other.m[1][2], m[1][3] + other.m[1][3],
@@ -122,7 +140,7 @@ namespace EngineUtilities {
      * @param other The matrix to subtract.
      * @return The result of the subtraction.
      */
-    Matrix4x4 operator-(const Matrix4x4& other) const {
+    constexpr Matrix4x4 operator-(const Matrix4x4& other) const {
       return Matrix4x4(
         m[0][0] - other.m[0][0], m[0][1] - other.m[0][1], m[0][2] - other.m[0][2], m[0][3] - other.m[0][3],
         m[1][0] - other.m[1][0], m[1][1] - other.m[1][1], m[1][2] - other.m[1][2], m[1][3] - other.m[1][3],
@@ -134,31 +152,101 @@ namespace EngineUtilities {
     /**
      * @brief Multiplies this matrix by another matrix.
      *
+     * Each result row is a linear combination of the rows of other, weighted by
+     * the broadcast elements of the matching row of this matrix. AVX2 builds
+     * compute two rows per instruction.
+     *
      * @param other The matrix to multiply by.
      * @return The result of the multiplication.
      */
-    Matrix4x4 operator*(const Matrix4x4& other) const {
+    constexpr Matrix4x4 operator*(const Matrix4x4& other) const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return multiplySimd(other);
+      }
+#endif
+      Matrix4x4 result;
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          result.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] +
+                           m[i][2] * other.m[2][j] + m[i][3] * other.m[3][j];
+        }
+      }
+      return result;
+    }
+
+    /**
+     * @brief Transforms a 4D vector as a row vector: v * M.
+     *
+     * @param v The vector to transform.
+     * @return The transformed vector.
+     */
+    constexpr Vector4 transform(const Vector4& v) const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return Vector4(transform(v.toSimd()));
+      }
+#endif
+      return Vector4(
+        v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0] + v.w * m[3][0],
+        v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1] + v.w * m[3][1],
+        v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2] + v.w * m[3][2],
+        v.x * m[0][3] + v.y * m[1][3] + v.z * m[2][3] + v.w * m[3][3]);
+    }
+
+#if ENGINE_SIMD_SSE2
+    /**
+     * @brief Transforms a row vector held in an SSE register: v * M.
+     *
+     * @param v The vector to transform.
+     * @return The transformed vector.
+     */
+    __m128 transform(__m128 v) const {
+      __m128 r = _mm_mul_ps(SimdSwizzle<0, 0, 0, 0>(v), row(0));
+      r = _mm_add_ps(r, _mm_mul_ps(SimdSwizzle<1, 1, 1, 1>(v), row(1)));
+      r = _mm_add_ps(r, _mm_mul_ps(SimdSwizzle<2, 2, 2, 2>(v), row(2)));
+      return _mm_add_ps(r, _mm_mul_ps(SimdSwizzle<3, 3, 3, 3>(v), row(3)));
+    }
+#endif
+
+    /**
+     * @brief Transforms a point (w = 1) without the perspective divide.
+     *
+     * @param p The point to transform.
+     * @return The transformed point.
+     */
+    constexpr Vector3 transformPoint(const Vector3& p) const {
+      Vector4 r = transform(Vector4(p.x, p.y, p.z, 1.0f));
+      return Vector3(r.x, r.y, r.z);
+    }
+
+    /**
+     * @brief Transforms a direction (w = 0); the translation is ignored.
+     *
+     * @param v The direction to transform.
+     * @return The transformed direction.
+     */
+    constexpr Vector3 transformVector(const Vector3& v) const {
+      Vector4 r = transform(Vector4(v.x, v.y, v.z, 0.0f));
+      return Vector3(r.x, r.y, r.z);
+    }
+
+    /**
+     * @brief Returns the transpose of the matrix.
+     *
+     * @return The transposed matrix.
+     */
+    constexpr Matrix4x4 transpose() const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return transposeSimd();
+      }
+#endif
       return Matrix4x4(
-        m[0][0] * other.m[0][0] + m[0][1] * other.m[1][0] + m[0][2] * other.m[2][0] + m[0][3] * other.m[3][0],
-        m[0][0] * other.m[0][1] + m[0][1] * other.m[1][1] + m[0][2] * other.m[2][1] + m[0][3] * other.m[3][1],
-        m[0][0] * other.m[0][2] + m[0][1] * other.m[1][2] + m[0][2] * other.m[2][2] + m[0][3] * other.m[3][2],
-        m[0][0] * other.m[0][3] + m[0][1] * other.m[1][3] + m[0][2] * other.m[2][3] + m[0][3] * other.m[3][3],
-
-        m[1][0] * other.m[0][0] + m[1][1] * other.m[1][0] + m[1][2] * other.m[2][0] + m[1][3] * other.m[3][0],
-        m[1][0] * other.m[0][1] + m[1][1] * other.m[1][1] + m[1][2] * other.m[2][1] + m[1][3] * other.m[3][1],
-        m[1][0] * other.m[0][2] + m[1][1] * other.m[1][2] + m[1][2] * other.m[2][2] + m[1][3] * other.m[3][2],
-        m[1][0] * other.m[0][3] + m[1][1] * other.m[1][3] + m[1][2] * other.m[2][3] + m[1][3] * other.m[3][3],
-
-        m[2][0] * other.m[0][0] + m[2][1] * other.m[1][0] + m[2][2] * other.m[2][0] + m[2][3] * other.m[3][0],
-        m[2][0] * other.m[0][1] + m[2][1] * other.m[1][1] + m[2][2] * other.m[2][1] + m[2][3] * other.m[3][1],
-        m[2][0] * other.m[0][2] + m[2][1] * other.m[1][2] + m[2][2] * other.m[2][2] + m[2][3] * other.m[3][2],
-        m[2][0] * other.m[0][3] + m[2][1] * other.m[1][3] + m[2][2] * other.m[2][3] + m[2][3] * other.m[3][3],
-
-        m[3][0] * other.m[0][0] + m[3][1] * other.m[1][0] + m[3][2] * other.m[2][0] + m[3][3] * other.m[3][0],
-        m[3][0] * other.m[0][1] + m[3][1] * other.m[1][1] + m[3][2] * other.m[2][1] + m[3][3] * other.m[3][1],
-        m[3][0] * other.m[0][2] + m[3][1] * other.m[1][2] + m[3][2] * other.m[2][2] + m[3][3] * other.m[3][2],
-        m[3][0] * other.m[0][3] + m[3][1] * other.m[1][3] + m[3][2] * other.m[2][3] + m[3][3] * other.m[3][3]
-      );
+        m[0][0], m[1][0], m[2][0], m[3][0],
+        m[0][1], m[1][1], m[2][1], m[3][1],
+        m[0][2], m[1][2], m[2][2], m[3][2],
+        m[0][3], m[1][3], m[2][3], m[3][3]);
     }
 
     /**
@@ -166,7 +254,7 @@ namespace EngineUtilities {
      *
      * @return The determinant of the matrix.
      */
-    float determinant() const {
+    constexpr float determinant() const {
       return
         m[0][0] * (
           m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
@@ -193,60 +281,411 @@ namespace EngineUtilities {
     /**
      * @brief Computes the inverse of the matrix.
      *
-     * @return The inverse of the matrix.
-     */
-    
-    //Matrix4x4 inverse() const {
-    //  float det = determinant();
-    //  if (det == 0) {
-    //    // Return identity matrix for simplicity when the matrix is singular.
-    //    return Matrix4x4();
-    //  }
-
-    //  float invDet = 1.0f / det;
-
-    //  return Matrix4x4(
-    //    (m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-    //      m[1][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
-    //      m[1][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1])) * invDet,
-    //    -(m[0][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-    //      m[0][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
-    //      m[0][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1])) * invDet,
-    //    (m[0][1] * (m[1][2] * m[3][3] - m[1][3] * m[3][2]) -
-    //      m[0][2] * (m[1][1] * m[3][3] - m[1][3] * m[3][1]) +
-    //      m[0][3] * (m[1][1] * m[3][2] - m[1][2] * m[3][1])) * invDet,
-    //    -(m[0][1] * (m[1][2] * m[2][3] - m[1][3] * m[2][2]) -
-    //      m[0][2] * (m[1][1] * m[2][3] - m[1][3] * m[2][1]) +
-    //      m[0][3] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])) * invDet,
-
-    //    -(m[1][0] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-    //      m[1][2] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-    //      m[1][3] * (m[2][0] * m[3][2] - m[2][2] * m[3][0])) * invDet,
-    //    (m[0][0] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-    //      m[0][2] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-    //      m[0][3] * (m[2][0] * m[3][2] - m[2][2] * m[3][0])) * invDet,
-    //    -(m[0][0] * (m[1][2] * m[3][3] - m[1][3] * m[3][2]) -
-    //      m[0][2] * (m[1][0] * m[3][3] - m[1][3] * m[3][0]) +
-    //      m[0][3] * (m[1][0] * m[3][2] - m[1][2] * m[3][0])) * invDet,
-    //    (m[0][0] * (m[1][2] * m[2][3] - m[1][3] * m[2][2]) -
-    //      m[0][2] * (m[1][0] * m[2][3] - m[1][3] * m[2][0]) +
-    //      m[0][3] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])) * invDet,
-
-    //    (m[1][0] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) -
-    //      m[1][1] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-    //      m[1][3] * (m[2][0] * m[3][1] - m[2][1] * m[3][0])) * invDet,
-    //    -(m[0][0] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) -
-    //      m[0][1] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-    //      m[0][3] * (m[2][0] * m[3][1] - m[2][1] * m[3][0])) * invDet,
-    //    (m[0][0] * (m[1][1] * m[3][3] - m[1][3] * m[3][1]) -
-    //      m[0][1] * (m[1][0] * m[3][3] - m[1][3] * m[3][0]) +
-    //      m[0][3] * (m[1][0] * m[3][1] - m[1][1] * m[3][0])) * invDet,
-    //    -(m[0][0] * (m[1][1] * m[2][3] - m[1][3] * m[2][1]) -
-    //      m[0][1] * (m[1][0] * m[2][3] - m[1][3] * m[2][0]) +
-    //      m[0][3] * (m[1][0] * m[2][1] - m[1][1] * m[2][0])) * invDet
-    //  );
-    //}
+     * The SSE path splits the matrix into four 2x2 blocks and inverts it through
+     * their adjugates, which needs about a third of the multiplies of the
+     * cofactor expansion used by the scalar path.
+     *
+     * @return The inverse of the matrix, or the identity if it is singular.
+     */
+    constexpr Matrix4x4 inverse() const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return inverseSimd();
+      }
+#endif
+      float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+      float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+      float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+      float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+      float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+      float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+      float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+      float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+      float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+      float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+      float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+      float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+      float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      if (det == 0.0f) {
+        return Matrix4x4();
+      }
+      float invDet = 1.0f / det;
+      return Matrix4x4(
+        ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * invDet,
+        (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * invDet,
+        ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * invDet,
+        (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * invDet,
+
+        (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * invDet,
+        ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * invDet,
+        (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * invDet,
+        ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * invDet,
+
+        ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * invDet,
+        (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * invDet,
+        ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * invDet,
+        (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * invDet,
+
+        (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * invDet,
+        ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * invDet,
+        (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * invDet,
+        ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * invDet);
+    }
+
+    /**
+     * @brief Computes the inverse of an affine matrix (last column 0, 0, 0, 1).
+     *
+     * Inverts the upper 3x3 block through cross products and applies it to the
+     * negated translation. Much cheaper than inverse() for world and view
+     * matrices; the result is undefined if the matrix is not affine.
+     *
+     * @return The inverse of the matrix, or the identity if it is singular.
+     */
+    constexpr Matrix4x4 affineInverse() const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return affineInverseSimd();
+      }
+#endif
+      Vector3 r0(m[0][0], m[0][1], m[0][2]);
+      Vector3 r1(m[1][0], m[1][1], m[1][2]);
+      Vector3 r2(m[2][0], m[2][1], m[2][2]);
+      Vector3 c0 = r1.cross(r2);
+      Vector3 c1 = r2.cross(r0);
+      Vector3 c2 = r0.cross(r1);
+      float det = r0.dot(c0);
+      if (det == 0.0f) {
+        return Matrix4x4();
+      }
+      float invDet = 1.0f / det;
+      c0 = c0 * invDet;
+      c1 = c1 * invDet;
+      c2 = c2 * invDet;
+      Vector3 t(m[3][0], m[3][1], m[3][2]);
+      return Matrix4x4(
+        c0.x, c1.x, c2.x, 0.0f,
+        c0.y, c1.y, c2.y, 0.0f,
+        c0.z, c1.z, c2.z, 0.0f,
+        -t.dot(c0), -t.dot(c1), -t.dot(c2), 1.0f);
+    }
+
+    /**
+     * @brief Builds a translation matrix.
+     *
+     * @param t The translation.
+     * @return The translation matrix.
+     */
+    static constexpr Matrix4x4 translation(const Vector3& t) {
+      return Matrix4x4(
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        t.x, t.y, t.z, 1);
+    }
+
+    /**
+     * @brief Builds a scaling matrix.
+     *
+     * @param s The scale on each axis.
+     * @return The scaling matrix.
+     */
+    static constexpr Matrix4x4 scaling(const Vector3& s) {
+      return Matrix4x4(
+        s.x, 0, 0, 0,
+        0, s.y, 0, 0,
+        0, 0, s.z, 0,
+        0, 0, 0, 1);
+    }
+
+    /**
+     * @brief Builds a rotation about the X axis.
+     *
+     * @param angle Angle in radians.
+     * @return The rotation matrix.
+     */
+    static Matrix4x4 rotationX(float angle) {
+      float s, c;
+      sincos(angle, s, c);
+      return Matrix4x4(
+        1, 0, 0, 0,
+        0, c, s, 0,
+        0, -s, c, 0,
+        0, 0, 0, 1);
+    }
+
+    /**
+     * @brief Builds a rotation about the Y axis.
+     *
+     * @param angle Angle in radians.
+     * @return The rotation matrix.
+     */
+    static Matrix4x4 rotationY(float angle) {
+      float s, c;
+      sincos(angle, s, c);
+      return Matrix4x4(
+        c, 0, -s, 0,
+        0, 1, 0, 0,
+        s, 0, c, 0,
+        0, 0, 0, 1);
+    }
+
+    /**
+     * @brief Builds a rotation about the Z axis.
+     *
+     * @param angle Angle in radians.
+     * @return The rotation matrix.
+     */
+    static Matrix4x4 rotationZ(float angle) {
+      float s, c;
+      sincos(angle, s, c);
+      return Matrix4x4(
+        c, s, 0, 0,
+        -s, c, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1);
+    }
 
+    /**
+     * @brief Builds a rotation from Euler angles: roll (Z), then pitch (X), then yaw (Y).
+     *
+     * Matches XMMatrixRotationRollPitchYaw.
+     *
+     * @param pitch Rotation about X in radians.
+     * @param yaw Rotation about Y in radians.
+     * @param roll Rotation about Z in radians.
+     * @return The rotation matrix.
+     */
+    static Matrix4x4 rotationRollPitchYaw(float pitch, float yaw, float roll) {
+      return compose(Vector3(0, 0, 0), Vector3(pitch, yaw, roll), Vector3(1, 1, 1));
+    }
 
+    /**
+     * @brief Builds scale * rotation * translation in one pass.
+     *
+     * Equivalent to scaling(scale) * rotationRollPitchYaw(rotation) * translation(position)
+     * without the two matrix products.
+     *
+     * @param position The translation.
+     * @param rotation Euler angles in radians (x = pitch, y = yaw, z = roll).
+     * @param scale The scale on each axis.
+     * @return The composed matrix.
+     */
+    static Matrix4x4 compose(const Vector3& position, const Vector3& rotation, const Vector3& scale) {
+      float sp, cp, sy, cy, sr, cr;
+      sincos(rotation.x, sp, cp);
+      sincos(rotation.y, sy, cy);
+      sincos(rotation.z, sr, cr);
+      return Matrix4x4(
+        scale.x * (cr * cy + sr * sp * sy), scale.x * (sr * cp), scale.x * (sr * sp * cy - cr * sy), 0,
+        scale.y * (cr * sp * sy - sr * cy), scale.y * (cr * cp), scale.y * (sr * sy + cr * sp * cy), 0,
+        scale.z * (cp * sy), scale.z * (-sp), scale.z * (cp * cy), 0,
+        position.x, position.y, position.z, 1);
+    }
+
+    /**
+     * @brief Splits an affine matrix back into the inputs of compose().
+     *
+     * A negative determinant is folded into the X scale. Pitch comes from
+     * atan2 rather than asin, so it stays accurate right up to +-90 degrees;
+     * only at the pole itself, where yaw and roll share an axis, is the roll
+     * reported as 0 and the yaw made to absorb it.
+     *
+     * @param position Receives the translation.
+     * @param rotation Receives the Euler angles (x = pitch, y = yaw, z = roll).
+     * @param scale Receives the scale on each axis.
+     * @return False if a scale is zero and the rotation cannot be recovered.
+     */
+    bool decompose(Vector3& position, Vector3& rotation, Vector3& scale) const {
+      position = Vector3(m[3][0], m[3][1], m[3][2]);
+      Vector3 r0(m[0][0], m[0][1], m[0][2]);
+      Vector3 r1(m[1][0], m[1][1], m[1][2]);
+      Vector3 r2(m[2][0], m[2][1], m[2][2]);
+      scale = Vector3(r0.magnitude(), r1.magnitude(), r2.magnitude());
+      if (r0.cross(r1).dot(r2) < 0.0f) {
+        scale.x = -scale.x;
+      }
+      if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f) {
+        rotation = Vector3(0, 0, 0);
+        return false;
+      }
+      r0 = r0 * (1.0f / scale.x);
+      r1 = r1 * (1.0f / scale.y);
+      r2 = r2 * (1.0f / scale.z);
+      float cosPitch = sqrt(r2.x * r2.x + r2.z * r2.z);
+      if (cosPitch > 1e-6f) {
+        rotation.x = atan2(-r2.y, cosPitch);
+        rotation.y = atan2(r2.x, r2.z);
+        rotation.z = atan2(r0.y, r1.y);
+      }
+      else {
+        rotation.x = copySign(MathConstants::HalfPi, -r2.y);
+        rotation.y = atan2(-r0.z, r0.x);
+        rotation.z = 0.0f;
+      }
+      return true;
+    }
+
+    /**
+     * @brief Builds a left-handed view matrix (XMMatrixLookAtLH).
+     *
+     * @param eye Camera position.
+     * @param target Point the camera looks at.
+     * @param up Up direction.
+     * @return The view matrix.
+     */
+    static constexpr Matrix4x4 lookAtLH(const Vector3& eye, const Vector3& target, const Vector3& up) {
+      Vector3 zAxis = (target - eye).normalize();
+      Vector3 xAxis = up.cross(zAxis).normalize();
+      Vector3 yAxis = zAxis.cross(xAxis);
+      return Matrix4x4(
+        xAxis.x, yAxis.x, zAxis.x, 0,
+        xAxis.y, yAxis.y, zAxis.y, 0,
+        xAxis.z, yAxis.z, zAxis.z, 0,
+        -xAxis.dot(eye), -yAxis.dot(eye), -zAxis.dot(eye), 1);
+    }
+
+    /**
+     * @brief Builds a left-handed perspective projection (XMMatrixPerspectiveFovLH).
+     *
+     * Maps depth to [0, 1] as Direct3D expects.
+     *
+     * @param fovY Vertical field of view in radians.
+     * @param aspect Width divided by height.
+     * @param nearZ Distance to the near plane.
+     * @param farZ Distance to the far plane.
+     * @return The projection matrix.
+     */
+    static Matrix4x4 perspectiveFovLH(float fovY, float aspect, float nearZ, float farZ) {
+      float s, c;
+      sincos(0.5f * fovY, s, c);
+      float height = c / s;
+      float width = height / aspect;
+      float range = farZ / (farZ - nearZ);
+      return Matrix4x4(
+        width, 0, 0, 0,
+        0, height, 0, 0,
+        0, 0, range, 1,
+        0, 0, -range * nearZ, 0);
+    }
+
+  private:
+#if ENGINE_SIMD_SSE2
+    // Intrinsic paths of the constexpr operations above; constant expressions use the scalar code.
+    Matrix4x4 multiplySimd(const Matrix4x4& other) const {
+#if ENGINE_SIMD_AVX2
+      Matrix4x4 result;
+      __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[0]));
+      __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[1]));
+      __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[2]));
+      __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(other.m[3]));
+      for (int i = 0; i < 4; i += 2) {
+        __m256 a = _mm256_loadu_ps(m[i]);
+        __m256 r = _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x00), b0);
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x55), b1));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xAA), b2));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xFF), b3));
+        _mm256_storeu_ps(result.m[i], r);
+      }
+      return result;
+#else
+      return Matrix4x4(other.transform(row(0)), other.transform(row(1)),
+                       other.transform(row(2)), other.transform(row(3)));
+#endif
+    }
+
+    Matrix4x4 transposeSimd() const {
+      __m128 r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      return Matrix4x4(r0, r1, r2, r3);
+    }
+
+    Matrix4x4 inverseSimd() const {
+      __m128 r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+      // 2x2 blocks, each stored row-major in one register.
+      __m128 A = _mm_movelh_ps(r0, r1);
+      __m128 B = _mm_movehl_ps(r1, r0);
+      __m128 C = _mm_movelh_ps(r2, r3);
+      __m128 D = _mm_movehl_ps(r3, r2);
+
+      // (|A|, |B|, |C|, |D|)
+      __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(SimdShuffle<0, 2, 0, 2>(r0, r2), SimdShuffle<1, 3, 1, 3>(r1, r3)),
+        _mm_mul_ps(SimdShuffle<1, 3, 1, 3>(r0, r2), SimdShuffle<0, 2, 0, 2>(r1, r3)));
+      __m128 detA = SimdSwizzle<0, 0, 0, 0>(detSub);
+      __m128 detB = SimdSwizzle<1, 1, 1, 1>(detSub);
+      __m128 detC = SimdSwizzle<2, 2, 2, 2>(detSub);
+      __m128 detD = SimdSwizzle<3, 3, 3, 3>(detSub);
+
+      __m128 adjDC = adjugateMul2x2(D, C);
+      __m128 adjAB = adjugateMul2x2(A, B);
+      __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mul2x2(B, adjDC));
+      __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mul2x2(C, adjAB));
+      __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mulAdjugate2x2(D, adjAB));
+      __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mulAdjugate2x2(A, adjDC));
+
+      // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+      __m128 trace = SimdHorizontalSum(_mm_mul_ps(adjAB, SimdSwizzle<0, 2, 1, 3>(adjDC)));
+      __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+      if (_mm_cvtss_f32(det) == 0.0f) {
+        return Matrix4x4();
+      }
+      __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+      X = _mm_mul_ps(X, invDet);
+      Y = _mm_mul_ps(Y, invDet);
+      Z = _mm_mul_ps(Z, invDet);
+      W = _mm_mul_ps(W, invDet);
+
+      // Applies the final adjugate and scatters the blocks back into rows.
+      return Matrix4x4(SimdShuffle<3, 1, 3, 1>(X, Y), SimdShuffle<2, 0, 2, 0>(X, Y),
+                       SimdShuffle<3, 1, 3, 1>(Z, W), SimdShuffle<2, 0, 2, 0>(Z, W));
+    }
+
+    Matrix4x4 affineInverseSimd() const {
+      __m128 r0 = row(0), r1 = row(1), r2 = row(2);
+      // Columns of the inverse, scaled by the determinant.
+      __m128 c0 = cross3(r1, r2);
+      __m128 c1 = cross3(r2, r0);
+      __m128 c2 = cross3(r0, r1);
+      __m128 det = SimdHorizontalSum(_mm_mul_ps(r0, c0));
+      if (_mm_cvtss_f32(det) == 0.0f) {
+        return Matrix4x4();
+      }
+      __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+      __m128 i0 = _mm_mul_ps(c0, invDet);
+      __m128 i1 = _mm_mul_ps(c1, invDet);
+      __m128 i2 = _mm_mul_ps(c2, invDet);
+      __m128 i3 = _mm_setzero_ps();
+      _MM_TRANSPOSE4_PS(i0, i1, i2, i3);
+      __m128 t = row(3);
+      __m128 translation = _mm_mul_ps(SimdSwizzle<0, 0, 0, 0>(t), i0);
+      translation = _mm_add_ps(translation, _mm_mul_ps(SimdSwizzle<1, 1, 1, 1>(t), i1));
+      translation = _mm_add_ps(translation, _mm_mul_ps(SimdSwizzle<2, 2, 2, 2>(t), i2));
+      translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+      return Matrix4x4(i0, i1, i2, translation);
+    }
+
+    // 2x2 row-major helpers for inverse(): A * B, A# * B and A * B#.
+    static __m128 mul2x2(__m128 a, __m128 b) {
+      return _mm_add_ps(_mm_mul_ps(a, SimdSwizzle<0, 3, 0, 3>(b)),
+                        _mm_mul_ps(SimdSwizzle<1, 0, 3, 2>(a), SimdSwizzle<2, 1, 2, 1>(b)));
+    }
+
+    static __m128 adjugateMul2x2(__m128 a, __m128 b) {
+      return _mm_sub_ps(_mm_mul_ps(SimdSwizzle<3, 3, 0, 0>(a), b),
+                        _mm_mul_ps(SimdSwizzle<1, 1, 2, 2>(a), SimdSwizzle<2, 3, 0, 1>(b)));
+    }
+
+    static __m128 mulAdjugate2x2(__m128 a, __m128 b) {
+      return _mm_sub_ps(_mm_mul_ps(a, SimdSwizzle<3, 0, 3, 0>(b)),
+                        _mm_mul_ps(SimdSwizzle<1, 0, 3, 2>(a), SimdSwizzle<2, 1, 2, 1>(b)));
+    }
+
+    // Cross product of the xyz lanes; the w lane of the result is 0 when both w lanes are 0.
+    static __m128 cross3(__m128 a, __m128 b) {
+      __m128 r = _mm_sub_ps(_mm_mul_ps(a, SimdSwizzle<1, 2, 0, 3>(b)),
+                            _mm_mul_ps(SimdSwizzle<1, 2, 0, 3>(a), b));
+      return SimdSwizzle<1, 2, 0, 3>(r);
+    }
+#endif
   };
 }
\ No newline at end of file
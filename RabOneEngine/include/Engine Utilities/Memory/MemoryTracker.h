@@ -0,0 +1,566 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include "TAllocator.h"
+
+/**
+ * @brief Si vale 1, adems de las estadsticas se guarda en cada reserva el ENGINE_MEMORY_SCOPE
+ * que la hizo y se enlaza en una lista global, para listar al cerrar lo que sigue vivo.
+ *
+ * Es un modo de depuracin de fugas: la lista est protegida por un mutex que se toma en cada
+ * reserva y liberacin. Por defecto vale 0 y activarlo implica ENGINE_MEMORY_TRACKING=1.
+ */
+#ifndef ENGINE_MEMORY_LEAK_TRACKING
+#define ENGINE_MEMORY_LEAK_TRACKING 0
+#endif
+
+/**
+ * @brief Si vale 1, cada reserva de memoria se etiqueta con un subsistema y se registra.
+ *
+ * Es opcional en todas las configuraciones: hay que definirlo a 1 explcitamente (o activar
+ * ENGINE_MEMORY_LEAK_TRACKING). Con 0 las etiquetas y los informes no cuestan nada.
+ */
+#ifndef ENGINE_MEMORY_TRACKING
+#define ENGINE_MEMORY_TRACKING ENGINE_MEMORY_LEAK_TRACKING
+#endif
+
+#if ENGINE_MEMORY_LEAK_TRACKING && !ENGINE_MEMORY_TRACKING
+#error "ENGINE_MEMORY_LEAK_TRACKING=1 necesita ENGINE_MEMORY_TRACKING=1"
+#endif
+
+#define ENGINE_MEMORY_CONCAT_INNER(A, B) A##B
+#define ENGINE_MEMORY_CONCAT(A, B) ENGINE_MEMORY_CONCAT_INNER(A, B)
+
+/**
+ * @brief Etiqueta las reservas hechas en el resto del bloque actual (en este hilo).
+ *
+ * Ejemplo: ENGINE_MEMORY_SCOPE(Mesh);
+ */
+#define ENGINE_MEMORY_SCOPE(Tag) \
+  EngineUtilities::MemoryTagScope ENGINE_MEMORY_CONCAT(MemoryScope_, __LINE__)(EngineUtilities::MemoryTag::Tag, __FILE__, __LINE__)
+
+namespace EngineUtilities {
+  /**
+   * @brief Subsistema al que se atribuye una reserva.
+   */
+  enum class MemoryTag : uint8_t {
+    Misc,         ///< Reservas fuera de cualquier ENGINE_MEMORY_SCOPE.
+    Mesh,
+    Texture,
+    ECS,
+    UI,
+    Loader,
+    MathScratch,
+    Count
+  };
+
+  constexpr size_t MemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+  inline const char*
+  GetMemoryTagName(MemoryTag Tag) {
+    static const char* const Names[MemoryTagCount] = {
+      "Misc", "Mesh", "Texture", "ECS", "UI", "Loader", "Math scratch"
+    };
+    return Tag < MemoryTag::Count ? Names[static_cast<size_t>(Tag)] : "Unknown";
+  }
+
+  /**
+   * @brief Estadsticas agregadas de una etiqueta.
+   */
+  struct MemoryTagStats {
+    int64_t LiveBytes = 0;          ///< Bytes reservados ahora mismo.
+    int64_t LiveCount = 0;          ///< Reservas vivas ahora mismo.
+    int64_t PeakBytes = 0;          ///< Mximo de LiveBytes desde el inicio (ver MemoryTracker::PeakResolution).
+    uint64_t TotalAllocations = 0;  ///< Reservas hechas desde el inicio.
+  };
+
+  /**
+   * @brief Registro de memoria por subsistema.
+   *
+   * Cada hilo cuenta en sus propios contadores, sin locks ni operaciones atmicas de
+   * lectura-escritura; GetStats los suma cuando alguien pide el informe. Los bytes que un hilo
+   * acumula se publican en un total global cada PeakResolution bytes (o antes, si la reserva es
+   * mayor), y ah se actualiza el pico: as el pico se sigue en la propia reserva sin que cada
+   * new pague un atmico compartido.
+   *
+   * Cada reserva lleva delante una cabecera con su etiqueta y tamao. Con
+   * ENGINE_MEMORY_LEAK_TRACKING=1 la cabecera guarda tambin el ENGINE_MEMORY_SCOPE activo y se
+   * enlaza en una lista global para poder listar lo que sigue vivo al cerrar.
+   *
+   * El motor enruta operator new/delete a Allocate/Deallocate (src/MemoryTracking.cpp), de
+   * modo que todas las reservas quedan registradas; por eso el propio registro solo usa malloc.
+   */
+  class MemoryTracker {
+  public:
+    /**
+     * @brief Bytes que un hilo puede acumular (en positivo o negativo) antes de publicarlos
+     * en el total global. El pico puede quedarse corto en, como mucho, esta cantidad por hilo.
+     */
+    static constexpr int64_t PeakResolution = 64 * 1024;
+
+    /**
+     * @brief Reserva Bytes con la alineacin pedida y la atribuye a la etiqueta actual del hilo.
+     *
+     * Con ENGINE_MEMORY_TRACKING=0 no hay registro: la reserva se pide a HeapAllocate, que
+     * respeta la alineacin igual que con el registro activo.
+     *
+     * @return nullptr si malloc falla (sin registro, HeapAllocate lanza std::bad_alloc).
+     */
+    static void*
+    Allocate(size_t Bytes, size_t Alignment) {
+#if ENGINE_MEMORY_TRACKING
+      if (Alignment < alignof(AllocationHeader)) {
+        Alignment = alignof(AllocationHeader);
+      }
+      char* Raw = static_cast<char*>(std::malloc(Bytes + sizeof(AllocationHeader) + Alignment - 1));
+      if (!Raw) {
+        return nullptr;
+      }
+      uintptr_t User = (reinterpret_cast<uintptr_t>(Raw) + sizeof(AllocationHeader) + Alignment - 1) &
+                       ~(static_cast<uintptr_t>(Alignment) - 1);
+      AllocationHeader* Header = reinterpret_cast<AllocationHeader*>(User) - 1;
+
+      ThreadState& State = GetThreadState();
+      Header->Raw = Raw;
+      Header->Bytes = Bytes;
+      Header->Tag = State.Tag;
+      State.Count(Header->Tag, static_cast<int64_t>(Bytes), 1);
+
+#if ENGINE_MEMORY_LEAK_TRACKING
+      Header->File = State.File;
+      Header->Line = State.Line;
+      Globals& G = GetGlobals();
+      {
+        std::lock_guard<std::mutex> Lock(G.Mutex);
+        Header->Prev = nullptr;
+        Header->Next = G.LiveList;
+        if (G.LiveList) {
+          G.LiveList->Prev = Header;
+        }
+        G.LiveList = Header;
+      }
+#endif
+      return reinterpret_cast<void*>(User);
+#else
+      return HeapAllocate(Bytes ? Bytes : 1, Alignment);
+#endif
+    }
+
+    /**
+     * @brief Libera memoria obtenida con Allocate (nullptr se ignora).
+     *
+     * @param Alignment La alineacin que se pidi a Allocate. Con el registro activo la
+     * cabecera ya la conoce; sin l HeapDeallocate la necesita para liberar correctamente.
+     */
+    static void
+    Deallocate(void* Ptr, size_t Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      if (!Ptr) {
+        return;
+      }
+#if ENGINE_MEMORY_TRACKING
+      AllocationHeader* Header = static_cast<AllocationHeader*>(Ptr) - 1;
+#if ENGINE_MEMORY_LEAK_TRACKING
+      Globals& G = GetGlobals();
+      {
+        std::lock_guard<std::mutex> Lock(G.Mutex);
+        if (Header->Prev) {
+          Header->Prev->Next = Header->Next;
+        }
+        else {
+          G.LiveList = Header->Next;
+        }
+        if (Header->Next) {
+          Header->Next->Prev = Header->Prev;
+        }
+      }
+#endif
+      // Se descuenta en el hilo que libera; la suma de todos los hilos sigue siendo correcta.
+      GetThreadState().Count(Header->Tag, -static_cast<int64_t>(Header->Bytes), -1);
+      std::free(Header->Raw);
+      (void)Alignment;
+#else
+      HeapDeallocate(Ptr, Alignment);
+#endif
+    }
+
+    /**
+     * @brief Etiqueta actual del hilo.
+     */
+    static MemoryTag
+    GetCurrentTag() {
+#if ENGINE_MEMORY_TRACKING
+      return GetThreadState().Tag;
+#else
+      return MemoryTag::Misc;
+#endif
+    }
+
+    /**
+     * @brief Suma los contadores de todos los hilos.
+     *
+     * @param Out Estadsticas por etiqueta, indexadas por MemoryTag.
+     */
+    static void
+    GetStats(MemoryTagStats (&Out)[MemoryTagCount]) {
+      for (MemoryTagStats& Stats : Out) {
+        Stats = MemoryTagStats();
+      }
+#if ENGINE_MEMORY_TRACKING
+      Globals& G = GetGlobals();
+      std::lock_guard<std::mutex> Lock(G.Mutex);
+      for (size_t i = 0; i < MemoryTagCount; ++i) {
+        Out[i].LiveBytes = G.LiveBytes[i].load(std::memory_order_relaxed);
+        Out[i].LiveCount = G.Retired.LiveCount[i];
+        Out[i].TotalAllocations = static_cast<uint64_t>(G.Retired.Allocations[i]);
+      }
+      for (ThreadState* State = G.Threads; State; State = State->Next) {
+        for (size_t i = 0; i < MemoryTagCount; ++i) {
+          Out[i].LiveBytes += State->PendingBytes[i].load(std::memory_order_relaxed);
+          Out[i].LiveCount += State->LiveCount[i].load(std::memory_order_relaxed);
+          Out[i].TotalAllocations += static_cast<uint64_t>(State->Allocations[i].load(std::memory_order_relaxed));
+        }
+      }
+      for (size_t i = 0; i < MemoryTagCount; ++i) {
+        // La suma exacta de este momento tambin cuenta como candidata a pico.
+        Out[i].PeakBytes = RaisePeak(G, i, Out[i].LiveBytes);
+      }
+#endif
+    }
+
+    /**
+     * @brief Informe de texto: una lnea por etiqueta y, con ENGINE_MEMORY_LEAK_TRACKING, la
+     * lista de reservas vivas agrupadas por el ENGINE_MEMORY_SCOPE que las hizo, de mayor a menor.
+     *
+     * @param MaxLeakSites Mximo de puntos del cdigo a listar.
+     */
+    static std::string
+    BuildReport(size_t MaxLeakSites = 32) {
+#if ENGINE_MEMORY_TRACKING
+      MemoryTagStats Stats[MemoryTagCount];
+      GetStats(Stats);
+
+      std::string Report = "Memory report (live bytes / live allocations / peak bytes / total allocations)\n";
+      char Line[256];
+      for (size_t i = 0; i < MemoryTagCount; ++i) {
+        std::snprintf(Line, sizeof(Line), "  %-12s %12lld %8lld %12lld %10llu\n",
+                      GetMemoryTagName(static_cast<MemoryTag>(i)),
+                      static_cast<long long>(Stats[i].LiveBytes), static_cast<long long>(Stats[i].LiveCount),
+                      static_cast<long long>(Stats[i].PeakBytes),
+                      static_cast<unsigned long long>(Stats[i].TotalAllocations));
+        Report += Line;
+      }
+
+#if ENGINE_MEMORY_LEAK_TRACKING
+      // Sin reservar memoria mientras se tiene el mutex: operator new tambin lo toma.
+      LeakSite Sites[MaxTrackedSites];
+      size_t SiteCount = 0;
+      {
+        Globals& G = GetGlobals();
+        std::lock_guard<std::mutex> Lock(G.Mutex);
+        for (AllocationHeader* Header = G.LiveList; Header; Header = Header->Next) {
+          size_t Index = 0;
+          while (Index < SiteCount &&
+                 !(Sites[Index].File == Header->File && Sites[Index].Line == Header->Line && Sites[Index].Tag == Header->Tag)) {
+            ++Index;
+          }
+          if (Index == SiteCount) {
+            if (SiteCount == MaxTrackedSites) {
+              Index = MaxTrackedSites - 1;  ///< Tabla llena: se acumula en la ltima entrada.
+            }
+            else {
+              Sites[SiteCount++] = LeakSite{ Header->File, Header->Line, Header->Tag, 0, 0 };
+            }
+          }
+          Sites[Index].Bytes += Header->Bytes;
+          ++Sites[Index].Count;
+        }
+      }
+      std::sort(Sites, Sites + SiteCount,
+                [](const LeakSite& A, const LeakSite& B) { return A.Bytes > B.Bytes; });
+
+      Report += "Live allocations by scope:\n";
+      for (size_t i = 0; i < SiteCount && i < MaxLeakSites; ++i) {
+        std::snprintf(Line, sizeof(Line), "  %s:%d [%s] %llu bytes in %llu allocations\n",
+                      Sites[i].File ? Sites[i].File : "(no scope)", Sites[i].Line,
+                      GetMemoryTagName(Sites[i].Tag),
+                      static_cast<unsigned long long>(Sites[i].Bytes),
+                      static_cast<unsigned long long>(Sites[i].Count));
+        Report += Line;
+      }
+#else
+      (void)MaxLeakSites;
+      Report += "Live allocations by scope: not recorded (define ENGINE_MEMORY_LEAK_TRACKING=1).\n";
+#endif
+      return Report;
+#else
+      (void)MaxLeakSites;
+      return "Memory tracking disabled (define ENGINE_MEMORY_TRACKING=1).\n";
+#endif
+    }
+
+  private:
+    friend class MemoryTagScope;
+
+#if ENGINE_MEMORY_TRACKING
+    /**
+     * @brief Cabecera delante de cada reserva.
+     */
+    struct alignas(16) AllocationHeader {
+#if ENGINE_MEMORY_LEAK_TRACKING
+      AllocationHeader* Prev;
+      AllocationHeader* Next;
+      const char* File;       ///< Archivo del ENGINE_MEMORY_SCOPE activo (nullptr si no haba).
+      int Line;
+#endif
+      void* Raw;              ///< Puntero devuelto por malloc.
+      size_t Bytes;
+      MemoryTag Tag;
+    };
+
+#if ENGINE_MEMORY_LEAK_TRACKING
+    static constexpr size_t MaxTrackedSites = 256;
+
+    struct LeakSite {
+      const char* File;
+      int Line;
+      MemoryTag Tag;
+      size_t Bytes;
+      size_t Count;
+    };
+#endif
+
+    /**
+     * @brief Contadores de reservas de los hilos que ya terminaron (sus bytes ya estn publicados).
+     */
+    struct RetiredCounters {
+      int64_t LiveCount[MemoryTagCount] = {};
+      int64_t Allocations[MemoryTagCount] = {};
+    };
+
+    struct ThreadState;
+
+    struct Globals {
+      std::mutex Mutex;                                   ///< Lista de hilos, Retired y LiveList.
+      ThreadState* Threads = nullptr;                     ///< Hilos con contadores registrados.
+      RetiredCounters Retired;
+      std::atomic<int64_t> LiveBytes[MemoryTagCount] = {};  ///< Bytes publicados por los hilos.
+      std::atomic<int64_t> PeakBytes[MemoryTagCount] = {};
+#if ENGINE_MEMORY_LEAK_TRACKING
+      AllocationHeader* LiveList = nullptr;               ///< Reservas vivas.
+#endif
+    };
+
+    /**
+     * @brief Sube el pico de la etiqueta a Live si es mayor y devuelve el pico resultante.
+     */
+    static int64_t
+    RaisePeak(Globals& G, size_t Index, int64_t Live) {
+      int64_t Peak = G.PeakBytes[Index].load(std::memory_order_relaxed);
+      while (Live > Peak &&
+             !G.PeakBytes[Index].compare_exchange_weak(Peak, Live, std::memory_order_relaxed)) {
+      }
+      return Live > Peak ? Live : Peak;
+    }
+
+    /**
+     * @brief Suma Bytes al total global de la etiqueta y actualiza su pico.
+     */
+    static void
+    PublishBytes(size_t Index, int64_t Bytes) {
+      Globals& G = GetGlobals();
+      int64_t Live = G.LiveBytes[Index].fetch_add(Bytes, std::memory_order_relaxed) + Bytes;
+      RaisePeak(G, Index, Live);
+    }
+
+    /**
+     * @brief Etiqueta actual y contadores de un hilo. Solo su hilo escribe en ellos; los
+     * atmicos permiten que GetStats los lea desde otro hilo.
+     */
+    struct ThreadState {
+      MemoryTag Tag = MemoryTag::Misc;
+      const char* File = nullptr;
+      int Line = 0;
+      std::atomic<int64_t> PendingBytes[MemoryTagCount] = {};  ///< Bytes an sin publicar.
+      std::atomic<int64_t> LiveCount[MemoryTagCount] = {};
+      std::atomic<int64_t> Allocations[MemoryTagCount] = {};
+      ThreadState* Next = nullptr;
+      bool Registered = false;
+      bool Exited = false;   ///< El hilo est terminando: lo que quede se cuenta en Retired.
+
+      void
+      Count(MemoryTag InTag, int64_t Bytes, int64_t Allocs) {
+        size_t i = static_cast<size_t>(InTag);
+        if (Exited) {
+          PublishBytes(i, Bytes);
+          Globals& G = GetGlobals();
+          std::lock_guard<std::mutex> Lock(G.Mutex);
+          G.Retired.LiveCount[i] += Allocs;
+          G.Retired.Allocations[i] += Allocs > 0 ? 1 : 0;
+          return;
+        }
+        if (!Registered) {
+          Register();
+        }
+        int64_t Pending = PendingBytes[i].load(std::memory_order_relaxed) + Bytes;
+        if (Pending >= PeakResolution || Pending <= -PeakResolution) {
+          // Primero se vaca el pendiente: un GetStats concurrente puede quedarse corto, nunca contar doble.
+          PendingBytes[i].store(0, std::memory_order_relaxed);
+          PublishBytes(i, Pending);
+        }
+        else {
+          PendingBytes[i].store(Pending, std::memory_order_relaxed);
+        }
+        LiveCount[i].store(LiveCount[i].load(std::memory_order_relaxed) + Allocs, std::memory_order_relaxed);
+        if (Allocs > 0) {
+          Allocations[i].store(Allocations[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+      }
+
+      void
+      Register() {
+        Globals& G = GetGlobals();
+        std::lock_guard<std::mutex> Lock(G.Mutex);
+        Next = G.Threads;
+        G.Threads = this;
+        Registered = true;
+      }
+
+      /**
+       * @brief Al terminar el hilo sus bytes se publican y sus contadores pasan a Retired.
+       */
+      ~ThreadState() {
+        Exited = true;
+        if (!Registered) {
+          return;
+        }
+        Globals& G = GetGlobals();
+        std::lock_guard<std::mutex> Lock(G.Mutex);
+        for (ThreadState** Link = &G.Threads; *Link; Link = &(*Link)->Next) {
+          if (*Link == this) {
+            *Link = Next;
+            break;
+          }
+        }
+        for (size_t i = 0; i < MemoryTagCount; ++i) {
+          PublishBytes(i, PendingBytes[i].load(std::memory_order_relaxed));
+          G.Retired.LiveCount[i] += LiveCount[i].load(std::memory_order_relaxed);
+          G.Retired.Allocations[i] += Allocations[i].load(std::memory_order_relaxed);
+          PendingBytes[i].store(0, std::memory_order_relaxed);
+          LiveCount[i].store(0, std::memory_order_relaxed);
+          Allocations[i].store(0, std::memory_order_relaxed);
+        }
+        Registered = false;
+      }
+    };
+
+    /**
+     * @brief Estado global; nunca se destruye, porque puede haber liberaciones despus de main.
+     */
+    static Globals&
+    GetGlobals() {
+      static Globals* G = new (std::malloc(sizeof(Globals))) Globals();
+      return *G;
+    }
+
+    static ThreadState&
+    GetThreadState() {
+      static thread_local ThreadState State;
+      return State;
+    }
+#endif
+  };
+
+  /**
+   * @brief Cambia la etiqueta del hilo mientras vive el objeto (usa ENGINE_MEMORY_SCOPE).
+   */
+  class MemoryTagScope {
+  public:
+    MemoryTagScope(MemoryTag Tag, const char* File, int Line) {
+#if ENGINE_MEMORY_TRACKING
+      MemoryTracker::ThreadState& State = MemoryTracker::GetThreadState();
+      m_prevTag = State.Tag;
+      m_prevFile = State.File;
+      m_prevLine = State.Line;
+      State.Tag = Tag;
+      State.File = File;
+      State.Line = Line;
+#else
+      (void)Tag;
+      (void)File;
+      (void)Line;
+#endif
+    }
+
+    ~MemoryTagScope() {
+#if ENGINE_MEMORY_TRACKING
+      MemoryTracker::ThreadState& State = MemoryTracker::GetThreadState();
+      State.Tag = m_prevTag;
+      State.File = m_prevFile;
+      State.Line = m_prevLine;
+#endif
+    }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+  private:
+#if ENGINE_MEMORY_TRACKING
+    MemoryTag m_prevTag;
+    const char* m_prevFile;
+    int m_prevLine;
+#endif
+  };
+
+  /*
+  // Ejemplo de uso del registro de memoria
+  int main()
+  {
+    {
+      ENGINE_MEMORY_SCOPE(Mesh);                      // Todo lo reservado aqu cuenta como Mesh
+      void* Vertices = MemoryTracker::Allocate(4096, 16);
+      MemoryTracker::Deallocate(Vertices, 16);
+    }
+
+    MemoryTagStats Stats[MemoryTagCount];
+    MemoryTracker::GetStats(Stats);
+    std::cout << Stats[static_cast<size_t>(MemoryTag::Mesh)].PeakBytes << std::endl;
+    std::cout << MemoryTracker::BuildReport() << std::endl;
+    return 0;
+  }
+  */
+}
\ No newline at end of file
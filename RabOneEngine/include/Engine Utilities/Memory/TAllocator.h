@@ -0,0 +1,380 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace EngineUtilities {
+  /**
+   * @file TAllocator.h
+   * @brief Polticas de asignacin de memoria para los contenedores de EngineUtilities.
+   *
+   * TArray, TInlineArray, TMap y TSet reciben una poltica de asignacin como parmetro de
+   * plantilla. Una poltica es un objeto pequeo y copiable con dos funciones:
+   *
+   *   void* Allocate(size_t Bytes, size_t Alignment);
+   *   void  Deallocate(void* Ptr, size_t Bytes, size_t Alignment);
+   *
+   * El contenedor guarda una copia de la poltica, as que las polticas que usan un recurso
+   * (una arena o un pool) solo guardan un puntero a l; el recurso debe vivir ms que los
+   * contenedores que lo usan. Ninguno de los recursos es seguro entre hilos.
+   */
+
+  /**
+   * @brief Tamao de lnea de cach asumido para separar datos que escriben hilos distintos.
+   */
+  constexpr size_t CacheLineSize = 64;
+
+  /**
+   * @brief Reserva memoria del heap con la alineacin pedida.
+   */
+  inline void*
+  HeapAllocate(size_t Bytes, size_t Alignment) {
+    if (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return ::operator new(Bytes, std::align_val_t(Alignment));
+    }
+    return ::operator new(Bytes);
+  }
+
+  /**
+   * @brief Libera memoria obtenida con HeapAllocate.
+   */
+  inline void
+  HeapDeallocate(void* Ptr, size_t Alignment) {
+    if (Alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(Ptr, std::align_val_t(Alignment));
+    }
+    else {
+      ::operator delete(Ptr);
+    }
+  }
+
+  /**
+   * @brief Poltica por defecto: cada bloque se pide al heap con operator new.
+   */
+  class THeapAllocator {
+  public:
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      return HeapAllocate(Bytes, Alignment);
+    }
+
+    void
+    Deallocate(void* Ptr, size_t /*Bytes*/, size_t Alignment) {
+      HeapDeallocate(Ptr, Alignment);
+    }
+  };
+
+  /**
+   * @brief Arena lineal: cada reserva avanza un puntero dentro de un bloque fijo.
+   *
+   * Reservar cuesta un incremento de puntero y liberar no hace nada; toda la memoria se
+   * recupera de una vez con Reset(). Es ideal para datos temporales que viven un frame.
+   *
+   * Si la arena se llena, las reservas siguientes se piden al heap (y se cuentan en
+   * GetOverflowCount()) para que el programa siga funcionando; Deallocate distingue ambos casos.
+   */
+  class TLinearArena {
+  public:
+    /**
+     * @brief Crea una arena con su propio bloque de memoria.
+     *
+     * @param InCapacity Tamao del bloque en bytes.
+     */
+    explicit TLinearArena(size_t InCapacity)
+      : m_begin(static_cast<char*>(HeapAllocate(InCapacity, alignof(std::max_align_t)))),
+        m_capacity(InCapacity), m_offset(0), m_overflowCount(0), m_ownsMemory(true) {}
+
+    /**
+     * @brief Crea una arena sobre un bloque externo, que no se libera al destruirla.
+     *
+     * @param Buffer Memoria a usar.
+     * @param InCapacity Tamao del bloque en bytes.
+     */
+    TLinearArena(void* Buffer, size_t InCapacity)
+      : m_begin(static_cast<char*>(Buffer)), m_capacity(InCapacity), m_offset(0),
+        m_overflowCount(0), m_ownsMemory(false) {}
+
+    ~TLinearArena() {
+      if (m_ownsMemory) {
+        HeapDeallocate(m_begin, alignof(std::max_align_t));
+      }
+    }
+
+    TLinearArena(const TLinearArena&) = delete;
+    TLinearArena& operator=(const TLinearArena&) = delete;
+
+    /**
+     * @brief Reserva Bytes con la alineacin indicada (potencia de dos).
+     */
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      uintptr_t Base = reinterpret_cast<uintptr_t>(m_begin);
+      uintptr_t Aligned = (Base + m_offset + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+      size_t NewOffset = static_cast<size_t>(Aligned - Base) + Bytes;
+      if (NewOffset > m_capacity) {
+        ++m_overflowCount;
+        return HeapAllocate(Bytes, Alignment);
+      }
+      m_offset = NewOffset;
+      return reinterpret_cast<void*>(Aligned);
+    }
+
+    /**
+     * @brief No libera memoria de la arena; solo devuelve al heap las reservas de desbordamiento.
+     */
+    void
+    Deallocate(void* Ptr, size_t /*Bytes*/, size_t Alignment) {
+      if (Ptr && !Owns(Ptr)) {
+        HeapDeallocate(Ptr, Alignment);
+      }
+    }
+
+    /**
+     * @brief Indica si el puntero pertenece al bloque de la arena.
+     */
+    bool
+    Owns(const void* Ptr) const {
+      const char* P = static_cast<const char*>(Ptr);
+      return P >= m_begin && P < m_begin + m_capacity;
+    }
+
+    /**
+     * @brief Libera toda la memoria de la arena. Los datos reservados dejan de ser vlidos.
+     */
+    void
+    Reset() {
+      m_offset = 0;
+    }
+
+    size_t GetUsed() const { return m_offset; }
+    size_t GetCapacity() const { return m_capacity; }
+    size_t GetOverflowCount() const { return m_overflowCount; }
+
+  private:
+    char* m_begin;            ///< Inicio del bloque.
+    size_t m_capacity;        ///< Tamao del bloque en bytes.
+    size_t m_offset;          ///< Bytes usados desde el inicio.
+    size_t m_overflowCount;   ///< Reservas que no cupieron y se pidieron al heap.
+    bool m_ownsMemory;        ///< true si la arena cre el bloque.
+  };
+
+  /**
+   * @brief Poltica que reserva memoria de una TLinearArena.
+   */
+  class TLinearAllocator {
+  public:
+    TLinearAllocator() : m_arena(nullptr) {}
+    TLinearAllocator(TLinearArena& Arena) : m_arena(&Arena) {}
+
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      return m_arena ? m_arena->Allocate(Bytes, Alignment) : HeapAllocate(Bytes, Alignment);
+    }
+
+    void
+    Deallocate(void* Ptr, size_t Bytes, size_t Alignment) {
+      if (m_arena) {
+        m_arena->Deallocate(Ptr, Bytes, Alignment);
+      }
+      else {
+        HeapDeallocate(Ptr, Alignment);
+      }
+    }
+
+  private:
+    TLinearArena* m_arena;  ///< Arena de la que se reserva (nullptr usa el heap).
+  };
+
+  /**
+   * @brief Pool de bloques de tamao fijo con lista libre intrusiva.
+   *
+   * Reservar y liberar cuestan O(1). Un contenedor que usa el pool debe pedir bloques de
+   * BlockSize bytes o menos (por ejemplo un TArray con Reserve hecho de antemano); las
+   * peticiones mayores, o las que llegan con el pool agotado, se piden al heap y se cuentan
+   * en GetOverflowCount().
+   */
+  class TFixedPool {
+  public:
+    /**
+     * @brief Crea el pool.
+     *
+     * @param InBlockSize Tamao de cada bloque en bytes.
+     * @param InBlockCount Nmero de bloques.
+     * @param InAlignment Alineacin de cada bloque (potencia de dos). Nunca es menor que
+     * alignof(void*), porque cada bloque libre guarda el puntero al siguiente.
+     */
+    TFixedPool(size_t InBlockSize, size_t InBlockCount, size_t InAlignment = alignof(std::max_align_t))
+      : m_blockSize(RoundUp(InBlockSize < sizeof(void*) ? sizeof(void*) : InBlockSize,
+                            BlockAlignment(InAlignment))),
+        m_blockCount(InBlockCount), m_alignment(BlockAlignment(InAlignment)), m_freeList(nullptr),
+        m_freeCount(InBlockCount), m_overflowCount(0) {
+      m_begin = static_cast<char*>(HeapAllocate(m_blockSize * m_blockCount, m_alignment));
+      for (size_t i = m_blockCount; i > 0; --i) {
+        void** Block = reinterpret_cast<void**>(m_begin + (i - 1) * m_blockSize);
+        *Block = m_freeList;
+        m_freeList = Block;
+      }
+    }
+
+    ~TFixedPool() {
+      HeapDeallocate(m_begin, m_alignment);
+    }
+
+    TFixedPool(const TFixedPool&) = delete;
+    TFixedPool& operator=(const TFixedPool&) = delete;
+
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      if (Bytes > m_blockSize || Alignment > m_alignment || !m_freeList) {
+        ++m_overflowCount;
+        return HeapAllocate(Bytes, Alignment);
+      }
+      void** Block = static_cast<void**>(m_freeList);
+      m_freeList = *Block;
+      --m_freeCount;
+      return Block;
+    }
+
+    void
+    Deallocate(void* Ptr, size_t /*Bytes*/, size_t Alignment) {
+      if (!Ptr) {
+        return;
+      }
+      if (!Owns(Ptr)) {
+        HeapDeallocate(Ptr, Alignment);
+        return;
+      }
+      *static_cast<void**>(Ptr) = m_freeList;
+      m_freeList = Ptr;
+      ++m_freeCount;
+    }
+
+    bool
+    Owns(const void* Ptr) const {
+      const char* P = static_cast<const char*>(Ptr);
+      return P >= m_begin && P < m_begin + m_blockSize * m_blockCount;
+    }
+
+    size_t GetBlockSize() const { return m_blockSize; }
+    size_t GetFreeCount() const { return m_freeCount; }
+    size_t GetOverflowCount() const { return m_overflowCount; }
+
+  private:
+    static size_t
+    RoundUp(size_t Value, size_t Alignment) {
+      return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    static size_t
+    BlockAlignment(size_t Alignment) {
+      return Alignment < alignof(void*) ? alignof(void*) : Alignment;
+    }
+
+    char* m_begin;            ///< Inicio de la memoria del pool.
+    size_t m_blockSize;       ///< Tamao de cada bloque (mltiplo de la alineacin).
+    size_t m_blockCount;      ///< Nmero total de bloques.
+    size_t m_alignment;       ///< Alineacin de los bloques.
+    void* m_freeList;         ///< Primer bloque libre; cada bloque libre apunta al siguiente.
+    size_t m_freeCount;       ///< Bloques libres.
+    size_t m_overflowCount;   ///< Reservas que se pidieron al heap.
+  };
+
+  /**
+   * @brief Poltica que reserva bloques de un TFixedPool.
+   */
+  class TPoolAllocator {
+  public:
+    TPoolAllocator() : m_pool(nullptr) {}
+    TPoolAllocator(TFixedPool& Pool) : m_pool(&Pool) {}
+
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      return m_pool ? m_pool->Allocate(Bytes, Alignment) : HeapAllocate(Bytes, Alignment);
+    }
+
+    void
+    Deallocate(void* Ptr, size_t Bytes, size_t Alignment) {
+      if (m_pool) {
+        m_pool->Deallocate(Ptr, Bytes, Alignment);
+      }
+      else {
+        HeapDeallocate(Ptr, Alignment);
+      }
+    }
+
+  private:
+    TFixedPool* m_pool;  ///< Pool del que se reserva (nullptr usa el heap).
+  };
+
+  /**
+   * @brief Acceso a una poltica para reservar objetos de un tipo concreto.
+   *
+   * Por defecto reduce la peticin a Allocate(sizeof(T), alignof(T)). Las polticas que
+   * reservan por tipo (TObjectPoolAllocator) la especializan; quien conoce el tipo del
+   * bloque que reserva (AllocateShared) pasa por aqu.
+   */
+  template<typename Allocator>
+  struct TAllocatorTraits {
+    template<typename T>
+    static void*
+    AllocateObject(Allocator& Alloc) {
+      return Alloc.Allocate(sizeof(T), alignof(T));
+    }
+
+    template<typename T>
+    static void
+    DeallocateObject(Allocator& Alloc, void* Ptr) {
+      Alloc.Deallocate(Ptr, sizeof(T), alignof(T));
+    }
+  };
+
+  // EXAMPLE
+
+  /*
+  int main() {
+    TLinearArena FrameArena(64 * 1024);  ///< 64 KB para datos temporales del frame.
+
+    {
+      TArray<int, TLinearAllocator> Visible(FrameArena);  ///< Crece dentro de la arena.
+      for (int i = 0; i < 100; ++i) {
+        Visible.Add(i);
+      }
+    }
+    FrameArena.Reset();  ///< Al final del frame se recupera toda la memoria.
+
+    TFixedPool Pool(256, 32);  ///< 32 bloques de 256 bytes.
+    TArray<float, TPoolAllocator> Weights(Pool);
+    Weights.Reserve(64);  ///< 64 floats caben en un bloque.
+
+    return 0;
+  }
+  */
+}
\ No newline at end of file
@@ -0,0 +1,298 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include "MemoryTracker.h"
+#include "TAllocator.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief Arena de frame con doble bfer para datos temporales de update() y render().
+   *
+   * Cada bfer es un bloque de tamao fijo donde reservar es incrementar un puntero. Al
+   * empezar un frame (BeginFrame) se pasa al otro bfer y se vaca, as que lo reservado en
+   * el frame N sigue siendo vlido durante el frame N + 1 (por ejemplo, datos que prepara
+   * update() y consume el render del frame siguiente) y se recupera despus de golpe.
+   *
+   * Si un bfer se llena, las reservas siguientes se piden al heap, se enlazan en una lista
+   * y se liberan en el mismo momento que el bfer; se cuentan para poder detectar frames que
+   * necesitan ms capacidad. Deallocate no hace nada: nada se libera antes del reinicio.
+   *
+   * La arena no es segura entre hilos; est pensada para el hilo del bucle principal.
+   */
+  class TFrameArena {
+  public:
+    /**
+     * @brief Crea la arena.
+     *
+     * @param InCapacity Capacidad en bytes de cada uno de los dos bferes.
+     */
+    explicit TFrameArena(size_t InCapacity)
+      : m_capacity(InCapacity), m_current(0), m_frameIndex(0),
+        m_lastFrameUsed(0), m_lastFrameOverflowCount(0), m_peakUsed(0), m_overflowFrameCount(0) {
+      ENGINE_MEMORY_SCOPE(MathScratch);
+      for (FrameBuffer& Buffer : m_buffers) {
+        Buffer.Begin = static_cast<char*>(HeapAllocate(InCapacity, alignof(std::max_align_t)));
+      }
+    }
+
+    ~TFrameArena() {
+      if (s_active == this) {
+        s_active = nullptr;
+      }
+      for (FrameBuffer& Buffer : m_buffers) {
+        ReleaseOverflow(Buffer);
+        HeapDeallocate(Buffer.Begin, alignof(std::max_align_t));
+      }
+    }
+
+    TFrameArena(const TFrameArena&) = delete;
+    TFrameArena& operator=(const TFrameArena&) = delete;
+
+    /**
+     * @brief Cierra el frame actual (registra sus estadsticas) y empieza uno nuevo.
+     *
+     * Invalida todo lo reservado dos frames atrs.
+     */
+    void
+    BeginFrame() {
+      FrameBuffer& Finished = m_buffers[m_current];
+      m_lastFrameUsed = Finished.Used + Finished.OverflowBytes;
+      m_lastFrameOverflowCount = Finished.OverflowCount;
+      if (m_lastFrameUsed > m_peakUsed) {
+        m_peakUsed = m_lastFrameUsed;
+      }
+      if (Finished.OverflowCount > 0) {
+        ++m_overflowFrameCount;
+      }
+
+      m_current ^= 1;
+      FrameBuffer& Next = m_buffers[m_current];
+      ReleaseOverflow(Next);
+      Next.Used = 0;
+      ++m_frameIndex;
+    }
+
+    /**
+     * @brief Reserva Bytes con la alineacin indicada (potencia de dos) en el bfer del frame actual.
+     */
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      FrameBuffer& Buffer = m_buffers[m_current];
+      uintptr_t Base = reinterpret_cast<uintptr_t>(Buffer.Begin);
+      uintptr_t Aligned = (Base + Buffer.Used + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+      size_t NewUsed = static_cast<size_t>(Aligned - Base) + Bytes;
+      if (NewUsed <= m_capacity) {
+        Buffer.Used = NewUsed;
+        return reinterpret_cast<void*>(Aligned);
+      }
+      return AllocateOverflow(Buffer, Bytes, Alignment);
+    }
+
+    /**
+     * @brief No hace nada: la memoria se recupera cuando se reinicia su bfer.
+     */
+    void
+    Deallocate(void* /*Ptr*/, size_t /*Bytes*/, size_t /*Alignment*/) {}
+
+    size_t GetCapacity() const { return m_capacity; }
+    uint64_t GetFrameIndex() const { return m_frameIndex; }
+
+    /**
+     * @brief Bytes reservados hasta ahora en el frame actual (incluido el desbordamiento).
+     */
+    size_t
+    GetFrameUsed() const {
+      return m_buffers[m_current].Used + m_buffers[m_current].OverflowBytes;
+    }
+
+    /**
+     * @brief Mximo de bytes que us el ltimo frame completo.
+     */
+    size_t GetLastFrameHighWater() const { return m_lastFrameUsed; }
+
+    /**
+     * @brief Reservas del ltimo frame completo que tuvieron que ir al heap (0 en estado estable).
+     */
+    size_t GetLastFrameOverflowCount() const { return m_lastFrameOverflowCount; }
+
+    /**
+     * @brief Mximo de bytes usados por un frame desde que se cre la arena.
+     */
+    size_t GetPeakHighWater() const { return m_peakUsed; }
+
+    /**
+     * @brief Nmero de frames que desbordaron su bfer.
+     */
+    uint64_t GetOverflowFrameCount() const { return m_overflowFrameCount; }
+
+    /**
+     * @brief Registra la arena que usan FrameAlloc y TFrameAllocator por defecto.
+     */
+    static void SetActive(TFrameArena* Arena) { s_active = Arena; }
+    static TFrameArena* GetActive() { return s_active; }
+
+  private:
+    /**
+     * @brief Cabecera de una reserva de desbordamiento; el bloque til va detrs.
+     */
+    struct OverflowNode {
+      OverflowNode* Next;
+      size_t Alignment;
+    };
+
+    struct FrameBuffer {
+      char* Begin = nullptr;             ///< Inicio del bloque.
+      size_t Used = 0;                   ///< Bytes usados desde el inicio.
+      OverflowNode* Overflow = nullptr;  ///< Reservas de heap hechas al llenarse el bloque.
+      size_t OverflowBytes = 0;          ///< Bytes pedidos al heap en este frame.
+      size_t OverflowCount = 0;          ///< Nmero de reservas de heap en este frame.
+    };
+
+    void*
+    AllocateOverflow(FrameBuffer& Buffer, size_t Bytes, size_t Alignment) {
+      ENGINE_MEMORY_SCOPE(MathScratch);
+      size_t NodeAlignment = Alignment > alignof(OverflowNode) ? Alignment : alignof(OverflowNode);
+      size_t Header = (sizeof(OverflowNode) + NodeAlignment - 1) & ~(NodeAlignment - 1);
+      char* Block = static_cast<char*>(HeapAllocate(Header + Bytes, NodeAlignment));
+      OverflowNode* Node = reinterpret_cast<OverflowNode*>(Block);
+      Node->Next = Buffer.Overflow;
+      Node->Alignment = NodeAlignment;
+      Buffer.Overflow = Node;
+      Buffer.OverflowBytes += Bytes;
+      ++Buffer.OverflowCount;
+      return Block + Header;
+    }
+
+    static void
+    ReleaseOverflow(FrameBuffer& Buffer) {
+      OverflowNode* Node = Buffer.Overflow;
+      while (Node) {
+        OverflowNode* Next = Node->Next;
+        HeapDeallocate(Node, Node->Alignment);
+        Node = Next;
+      }
+      Buffer.Overflow = nullptr;
+      Buffer.OverflowBytes = 0;
+      Buffer.OverflowCount = 0;
+    }
+
+    FrameBuffer m_buffers[2];           ///< Bfer del frame actual y del anterior.
+    size_t m_capacity;                  ///< Capacidad de cada bfer en bytes.
+    unsigned m_current;                 ///< ndice del bfer del frame actual.
+    uint64_t m_frameIndex;              ///< Frames empezados.
+    size_t m_lastFrameUsed;             ///< High-water del ltimo frame completo.
+    size_t m_lastFrameOverflowCount;    ///< Reservas al heap del ltimo frame completo.
+    size_t m_peakUsed;                  ///< Mayor high-water de todos los frames.
+    uint64_t m_overflowFrameCount;      ///< Frames que desbordaron.
+
+    static inline TFrameArena* s_active = nullptr;  ///< Arena de FrameAlloc y TFrameAllocator.
+  };
+
+  /**
+   * @brief Poltica que reserva de una TFrameArena (por defecto la activa) para los contenedores.
+   *
+   * El contenedor no debe vivir ms all del frame siguiente al que lo llen.
+   * Sin arena activa recurre al heap normal.
+   */
+  class TFrameAllocator {
+  public:
+    TFrameAllocator() : m_arena(TFrameArena::GetActive()) {}
+    TFrameAllocator(TFrameArena& Arena) : m_arena(&Arena) {}
+
+    void*
+    Allocate(size_t Bytes, size_t Alignment) {
+      return m_arena ? m_arena->Allocate(Bytes, Alignment) : HeapAllocate(Bytes, Alignment);
+    }
+
+    void
+    Deallocate(void* Ptr, size_t Bytes, size_t Alignment) {
+      if (m_arena) {
+        m_arena->Deallocate(Ptr, Bytes, Alignment);
+      }
+      else {
+        HeapDeallocate(Ptr, Alignment);
+      }
+    }
+
+  private:
+    TFrameArena* m_arena;  ///< Arena de la que se reserva (nullptr usa el heap).
+  };
+
+  /**
+   * @brief Reserva Count objetos de tipo T en la arena de frame activa.
+   *
+   * Los objetos se construyen por defecto y nunca se destruyen, por eso T debe ser
+   * trivialmente destructible. Son vlidos hasta el final del frame siguiente.
+   *
+   * @return Puntero al primer objeto, o nullptr si no hay arena activa.
+   */
+  template<typename T>
+  T*
+  FrameAlloc(size_t Count = 1) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "FrameAlloc no llama a destructores; usa un tipo trivialmente destructible.");
+    TFrameArena* Arena = TFrameArena::GetActive();
+    if (!Arena || Count == 0) {
+      return nullptr;
+    }
+    T* Data = static_cast<T*>(Arena->Allocate(sizeof(T) * Count, alignof(T)));
+    for (size_t i = 0; i < Count; ++i) {
+      ::new (static_cast<void*>(Data + i)) T;
+    }
+    return Data;
+  }
+
+  /*
+  // Ejemplo de uso de TFrameArena
+  int main()
+  {
+    TFrameArena arena(64 * 1024);
+    TFrameArena::SetActive(&arena);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+      arena.BeginFrame();
+
+      float* weights = FrameAlloc<float>(256);          // Vlido hasta el final del frame siguiente
+      TArray<int, TFrameAllocator> visible;             // Contenedor temporal sin tocar el heap
+      visible.Add(frame);
+
+      std::cout << arena.GetFrameUsed() << " bytes este frame" << std::endl;
+    }
+
+    std::cout << "High-water: " << arena.GetPeakHighWater() << std::endl;
+    TFrameArena::SetActive(nullptr);
+    return 0;
+  }
+  */
+}
\ No newline at end of file
@@ -0,0 +1,326 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#include "TAllocator.h"
+#include "TSharedPointer.h"
+
+/**
+ * @brief Si vale 1, los huecos libres del pool se rellenan con un patrn y se comprueba al
+ * reutilizarlos, para detectar escrituras despus de liberar. Activo por defecto en Debug;
+ * si se activa en Release la comprobacin tambin detiene el programa.
+ */
+#ifndef ENGINE_POOL_POISONING
+#ifdef NDEBUG
+#define ENGINE_POOL_POISONING 0
+#else
+#define ENGINE_POOL_POISONING 1
+#endif
+#endif
+
+namespace EngineUtilities {
+  /**
+   * @brief Pool de objetos de tipo T, uno por tipo, con lista libre y crecimiento por chunks.
+   *
+   * La memoria se pide en chunks de ChunkSize huecos contiguos que nunca se mueven ni se
+   * devuelven hasta destruir el pool, as que los objetos de un mismo tipo quedan juntos en
+   * memoria. Reservar y liberar cuestan O(1): sacan o meten un hueco en una lista libre
+   * intrusiva protegida por un mutex.
+   *
+   * Con SetThreadCacheEnabled(true) cada hilo guarda hasta ThreadCacheSize huecos libres
+   * propios y solo toca el mutex al llenarse o vaciarse esa cach.
+   *
+   * @tparam T Tipo de los objetos.
+   * @tparam ChunkSize Huecos por chunk.
+   */
+  template<typename T, size_t ChunkSize = 64>
+  class TObjectPool {
+  public:
+    static constexpr size_t ThreadCacheSize = 32;
+
+    /**
+     * @brief Pool compartido del tipo T (se crea en el primer uso).
+     */
+    static TObjectPool&
+    Get() {
+      static TObjectPool Instance(true);
+      return Instance;
+    }
+
+    /**
+     * @brief Crea un pool independiente (sin cach por hilo).
+     */
+    TObjectPool() : TObjectPool(false) {}
+
+    ~TObjectPool() {
+      for (char* Chunk : m_chunks) {
+        HeapDeallocate(Chunk, SlotAlignment);
+      }
+    }
+
+    TObjectPool(const TObjectPool&) = delete;
+    TObjectPool& operator=(const TObjectPool&) = delete;
+
+    /**
+     * @brief Reserva un hueco sin construir para un T.
+     */
+    void*
+    Allocate() {
+      void* Slot = nullptr;
+      ThreadCache* Cache = GetThreadCache();
+      if (Cache && Cache->Count > 0) {
+        Slot = Cache->Slots[--Cache->Count];
+      }
+      else {
+        std::lock_guard<std::mutex> Lock(m_mutex);
+        if (!m_freeList) {
+          AddChunk();
+        }
+        Slot = m_freeList;
+        m_freeList = *static_cast<void**>(Slot);
+      }
+      m_liveCount.fetch_add(1, std::memory_order_relaxed);
+      CheckPoison(Slot);
+      return Slot;
+    }
+
+    /**
+     * @brief Devuelve al pool un hueco obtenido con Allocate (el objeto ya debe estar destruido).
+     */
+    void
+    Deallocate(void* Slot) {
+      if (!Slot) {
+        return;
+      }
+      Poison(Slot);
+      m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+      ThreadCache* Cache = GetThreadCache();
+      if (Cache && m_threadCacheEnabled.load(std::memory_order_relaxed) && Cache->Count < ThreadCacheSize) {
+        Cache->Owner = this;
+        Cache->Slots[Cache->Count++] = Slot;
+        return;
+      }
+      std::lock_guard<std::mutex> Lock(m_mutex);
+      *static_cast<void**>(Slot) = m_freeList;
+      m_freeList = Slot;
+    }
+
+    /**
+     * @brief Construye un T en el pool.
+     */
+    template<typename... Args>
+    T*
+    Create(Args&&... args) {
+      void* Slot = Allocate();
+      try {
+        return ::new (Slot) T(std::forward<Args>(args)...);
+      }
+      catch (...) {
+        Deallocate(Slot);
+        throw;
+      }
+    }
+
+    /**
+     * @brief Destruye un T creado con Create y devuelve su hueco.
+     */
+    void
+    Destroy(T* Object) {
+      if (Object) {
+        Object->~T();
+        Deallocate(Object);
+      }
+    }
+
+    /**
+     * @brief Activa o desactiva la cach por hilo (desactivada por defecto; solo el pool compartido la usa).
+     */
+    void
+    SetThreadCacheEnabled(bool Enabled) {
+      m_threadCacheEnabled.store(Enabled, std::memory_order_relaxed);
+    }
+
+    size_t GetLiveCount() const { return m_liveCount.load(std::memory_order_relaxed); }
+    size_t GetChunkCount() const { std::lock_guard<std::mutex> Lock(m_mutex); return m_chunks.size(); }
+    size_t GetCapacity() const { return GetChunkCount() * ChunkSize; }
+
+  private:
+    explicit TObjectPool(bool InShared)
+      : m_freeList(nullptr), m_liveCount(0), m_threadCacheEnabled(false), m_shared(InShared) {}
+
+    static constexpr size_t SlotAlignment = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+    static constexpr size_t SlotSize =
+      ((sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*)) + SlotAlignment - 1) & ~(SlotAlignment - 1);
+    static constexpr unsigned char PoisonByte = 0xDD;
+
+    /**
+     * @brief Huecos libres guardados por un hilo; al terminar el hilo vuelven al pool.
+     */
+    struct ThreadCache {
+      TObjectPool* Owner = nullptr;
+      void* Slots[ThreadCacheSize];
+      size_t Count = 0;
+
+      ~ThreadCache() {
+        if (Owner) {
+          std::lock_guard<std::mutex> Lock(Owner->m_mutex);
+          for (size_t i = 0; i < Count; ++i) {
+            *static_cast<void**>(Slots[i]) = Owner->m_freeList;
+            Owner->m_freeList = Slots[i];
+          }
+        }
+      }
+    };
+
+    /**
+     * @brief Cach del hilo actual, o nullptr si este no es el pool compartido (Get()).
+     */
+    ThreadCache*
+    GetThreadCache() {
+      if (!m_shared) {
+        return nullptr;
+      }
+      static thread_local ThreadCache Cache;
+      return &Cache;
+    }
+
+    /**
+     * @brief Pide un chunk nuevo y encadena sus huecos en la lista libre (en orden de direccin).
+     */
+    void
+    AddChunk() {
+      char* Chunk = static_cast<char*>(HeapAllocate(SlotSize * ChunkSize, SlotAlignment));
+      m_chunks.push_back(Chunk);
+      for (size_t i = ChunkSize; i > 0; --i) {
+        void* Slot = Chunk + (i - 1) * SlotSize;
+        Poison(Slot);
+        *static_cast<void**>(Slot) = m_freeList;
+        m_freeList = Slot;
+      }
+    }
+
+    static void
+    Poison(void* Slot) {
+#if ENGINE_POOL_POISONING
+      std::memset(static_cast<char*>(Slot) + sizeof(void*), PoisonByte, SlotSize - sizeof(void*));
+#else
+      (void)Slot;
+#endif
+    }
+
+    static void
+    CheckPoison(void* Slot) {
+#if ENGINE_POOL_POISONING
+      const unsigned char* Bytes = static_cast<const unsigned char*>(Slot);
+      for (size_t i = sizeof(void*); i < SlotSize; ++i) {
+        if (Bytes[i] != PoisonByte) {
+          std::fputs("TObjectPool: slot written after it was freed\n", stderr);
+          std::abort();
+        }
+      }
+#else
+      (void)Slot;
+#endif
+    }
+
+    mutable std::mutex m_mutex;               ///< Protege la lista libre y los chunks.
+    std::vector<char*> m_chunks;              ///< Chunks reservados.
+    void* m_freeList;                         ///< Primer hueco libre; cada hueco libre apunta al siguiente.
+    std::atomic<size_t> m_liveCount;          ///< Objetos reservados ahora mismo.
+    std::atomic<bool> m_threadCacheEnabled;   ///< Si Deallocate guarda huecos en la cach del hilo.
+    bool m_shared;                            ///< true solo para el pool de Get(), el nico con cach por hilo.
+  };
+
+  /**
+   * @brief Poltica sin estado que reserva cada tipo en su TObjectPool compartido.
+   *
+   * Solo sirve para reservas de un objeto (AllocateShared, TAllocatorTraits); no la uses
+   * en contenedores que piden arrays.
+   */
+  class TObjectPoolAllocator {};
+
+  template<>
+  struct TAllocatorTraits<TObjectPoolAllocator> {
+    template<typename T>
+    static void*
+    AllocateObject(TObjectPoolAllocator& /*Alloc*/) {
+      return TObjectPool<T>::Get().Allocate();
+    }
+
+    template<typename T>
+    static void
+    DeallocateObject(TObjectPoolAllocator& /*Alloc*/, void* Ptr) {
+      TObjectPool<T>::Get().Deallocate(Ptr);
+    }
+  };
+
+  /**
+   * @brief Crea un TSharedPointer cuyo objeto y bloque de control viven en el pool de su tipo.
+   *
+   * @tparam T Tipo del objeto gestionado.
+   * @param args Argumentos del constructor del objeto gestionado.
+   * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
+   */
+  template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename... Args>
+  TSharedPointer<T, Mode>
+  MakeSharedPooled(Args&&... args) {
+    return AllocateShared<T, Mode>(TObjectPoolAllocator(), std::forward<Args>(args)...);
+  }
+
+  /*
+  // Ejemplo de uso de TObjectPool
+  struct Particle { float Position[3]; float Life; };
+
+  int main()
+  {
+    TObjectPool<Particle>& Pool = TObjectPool<Particle>::Get();
+
+    Particle* A = Pool.Create();              // O(1), contiguo a los dems Particle
+    Particle* B = Pool.Create();
+    Pool.Destroy(A);                          // El hueco vuelve a la lista libre
+    Particle* C = Pool.Create();              // Reutiliza el hueco de A
+
+    TSharedPointer<Particle> Shared = MakeSharedPooled<Particle>();
+
+    std::cout << Pool.GetLiveCount() << std::endl;
+    Pool.Destroy(B);
+    Pool.Destroy(C);
+    return 0;
+  }
+  */
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace EngineUtilities {
+  /**
+   * @brief Puntero con recuento de referencias intrusivo.
+   *
+   * El recuento vive dentro del propio objeto: T debe exponer AddRef() y Release(), como hacen
+   * todas las interfaces COM de Direct3D (ID3D11Texture2D, ID3D11Buffer...). Copiar un
+   * TRefCountPtr solo llama a AddRef, sin reservar memoria, y el objeto se libera cuando se
+   * destruye la ltima copia.
+   *
+   * Para tipos propios del motor se puede heredar de TRefCountedObject.
+   *
+   * No llames a Release() a travs de operator->; usa reset().
+   *
+   * @tparam T Tipo del objeto gestionado.
+   */
+  template<typename T>
+  class TRefCountPtr {
+  public:
+    /**
+     * @brief Constructor por defecto.
+     */
+    TRefCountPtr() : ptr(nullptr) {}
+
+    TRefCountPtr(std::nullptr_t) : ptr(nullptr) {}
+
+    /**
+     * @brief Constructor que toma un puntero crudo.
+     *
+     * @param rawPtr Puntero crudo al objeto.
+     * @param addRef true para tomar una referencia nueva; false para adoptar una que ya
+     *               pertenece al llamador (por ejemplo la que devuelve una funcin Create*).
+     */
+    explicit TRefCountPtr(T* rawPtr, bool addRef = true) : ptr(rawPtr) {
+      if (ptr && addRef) {
+        ptr->AddRef();
+      }
+    }
+
+    /**
+     * @brief Constructor de copia. Toma una referencia ms sobre el mismo objeto.
+     */
+    TRefCountPtr(const TRefCountPtr& other) : ptr(other.ptr) {
+      if (ptr) {
+        ptr->AddRef();
+      }
+    }
+
+    /**
+     * @brief Constructor de conversin desde un TRefCountPtr a un tipo derivado.
+     */
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    TRefCountPtr(const TRefCountPtr<U>& other) : ptr(other.get()) {
+      if (ptr) {
+        ptr->AddRef();
+      }
+    }
+
+    /**
+     * @brief Constructor de movimiento. Transfiere la referencia sin tocar el recuento.
+     */
+    TRefCountPtr(TRefCountPtr&& other) noexcept : ptr(other.ptr) {
+      other.ptr = nullptr;
+    }
+
+    /**
+     * @brief Destructor. Suelta la referencia.
+     */
+    ~TRefCountPtr() {
+      if (ptr) {
+        ptr->Release();
+      }
+    }
+
+    TRefCountPtr&
+      operator=(const TRefCountPtr& other) {
+      TRefCountPtr(other).swap(*this);  ///< AddRef antes que Release: seguro en la autoasignacin.
+      return *this;
+    }
+
+    TRefCountPtr&
+      operator=(TRefCountPtr&& other) noexcept {
+      TRefCountPtr(std::move(other)).swap(*this);
+      return *this;
+    }
+
+    TRefCountPtr&
+      operator=(std::nullptr_t) {
+      reset();
+      return *this;
+    }
+
+    T&
+      operator*() const {
+      return *ptr;
+    }
+
+    T*
+      operator->() const {
+      return ptr;
+    }
+
+    /**
+     * @brief Conversin implcita al puntero crudo, para pasarlo directamente a la API de D3D.
+     */
+    operator T*() const {
+      return ptr;
+    }
+
+    /**
+     * @brief Obtener el puntero crudo.
+     */
+    T*
+      get() const {
+      return ptr;
+    }
+
+    /**
+     * @brief Comprobar si el puntero es nulo.
+     */
+    bool
+      isNull() const {
+      return ptr == nullptr;
+    }
+
+    /**
+     * @brief Suelta el objeto actual y devuelve la direccin del puntero interno para que una
+     * funcin Create* escriba en ella (la referencia que escribe se adopta).
+     *
+     * @return Direccin del puntero interno, ya a nullptr.
+     */
+    T**
+      getInitReference() {
+      reset();
+      return &ptr;
+    }
+
+    /**
+     * @brief Direccin del puntero interno sin soltarlo, para funciones que reciben un array
+     * de punteros (PSSetShaderResources, IASetVertexBuffers...).
+     */
+    T* const*
+      getAddressOf() const {
+      return &ptr;
+    }
+
+    /**
+     * @brief Suelta el objeto actual y opcionalmente toma una referencia sobre otro.
+     *
+     * @param newPtr Nuevo objeto (por defecto nullptr).
+     */
+    void
+      reset(T* newPtr = nullptr) {
+      TRefCountPtr(newPtr).swap(*this);
+    }
+
+    /**
+     * @brief Adopta una referencia que ya pertenece al llamador, sin llamar a AddRef.
+     */
+    void
+      attach(T* rawPtr) {
+      TRefCountPtr(rawPtr, false).swap(*this);
+    }
+
+    /**
+     * @brief Entrega la referencia al llamador sin llamar a Release.
+     *
+     * @return El puntero crudo; el llamador debe liberarlo.
+     */
+    T*
+      detach() {
+      T* rawPtr = ptr;
+      ptr = nullptr;
+      return rawPtr;
+    }
+
+    /**
+     * @brief Recuento actual del objeto (solo para depuracin).
+     */
+    uint32_t
+      getRefCount() const {
+      if (!ptr) {
+        return 0;
+      }
+      ptr->AddRef();
+      return static_cast<uint32_t>(ptr->Release());
+    }
+
+    void
+      swap(TRefCountPtr& other) noexcept {
+      T* temp = ptr;
+      ptr = other.ptr;
+      other.ptr = temp;
+    }
+
+  private:
+    T* ptr; ///< Puntero al objeto gestionado.
+  };
+
+  /**
+   * @brief Base con recuento intrusivo atmico para objetos del motor gestionados con TRefCountPtr.
+   *
+   * Sigue la convencin de COM: AddRef y Release devuelven el recuento nuevo y Release
+   * destruye el objeto al llegar a cero. El objeto debe crearse con new.
+   */
+  class TRefCountedObject {
+  public:
+    TRefCountedObject() : m_refCount(0) {}
+    TRefCountedObject(const TRefCountedObject&) = delete;
+    TRefCountedObject& operator=(const TRefCountedObject&) = delete;
+
+    uint32_t
+      AddRef() const {
+      return m_refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    uint32_t
+      Release() const {
+      uint32_t newCount = m_refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+      if (newCount == 0) {
+        delete this;
+      }
+      return newCount;
+    }
+
+  protected:
+    virtual ~TRefCountedObject() {}
+
+  private:
+    mutable std::atomic<uint32_t> m_refCount; ///< Recuento de referencias.
+  };
+
+  /*
+  // Ejemplo de uso de TRefCountPtr
+  class MyResource : public TRefCountedObject
+  {
+  public:
+    int value = 10;
+  };
+
+  int main()
+  {
+    TRefCountPtr<MyResource> a(new MyResource());
+    TRefCountPtr<MyResource> b = a;        // Solo AddRef, sin reservar memoria
+    std::cout << a.getRefCount() << std::endl; // 2
+
+    // Con Direct3D: la funcin Create* escribe una referencia que se adopta.
+    // TRefCountPtr<ID3D11Buffer> buffer;
+    // device->CreateBuffer(&desc, nullptr, buffer.getInitReference());
+    // context->VSSetConstantBuffers(0, 1, buffer.getAddressOf());
+
+    a.reset();
+    std::cout << b->value << std::endl;    // El objeto sigue vivo mientras b exista
+    return 0;
+  }
+  */
+}
\ No newline at end of file
@@ -27,132 +27,328 @@
  * SOFTWARE.
 */
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "TAllocator.h"
 
 namespace EngineUtilities {
+	/**
+	 * @brief Modo de recuento de referencias de TSharedPointer y TWeakPointer.
+	 */
+	enum class RefCountMode
+	{
+		ThreadSafe,      ///< Contadores atmicos: los punteros pueden copiarse y destruirse desde varios hilos.
+		SingleThreaded   ///< Contadores normales: ms rpidos, solo para objetos que no salen de un hilo.
+	};
+
+	/**
+	 * @brief Contador de referencias con la implementacin que corresponde a cada modo.
+	 */
+	template<RefCountMode Mode>
+	class TRefCounter;
+
+	template<>
+	class TRefCounter<RefCountMode::ThreadSafe>
+	{
+	public:
+		explicit TRefCounter(int32_t Initial) : Count(Initial) {}
+
+		void Increment() { Count.fetch_add(1, std::memory_order_relaxed); }
+
+		/**
+		 * @brief Decrementa el contador.
+		 *
+		 * @return true si el contador lleg a cero.
+		 */
+		bool Decrement()
+		{
+			// acq_rel: las escrituras de todos los dueos son visibles para quien destruye el objeto.
+			return Count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+		}
+
+		/**
+		 * @brief Incrementa el contador solo si no es cero (para promover un puntero dbil).
+		 *
+		 * @return true si se increment.
+		 */
+		bool IncrementIfNotZero()
+		{
+			int32_t Current = Count.load(std::memory_order_relaxed);
+			while (Current != 0)
+			{
+				if (Count.compare_exchange_weak(Current, Current + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		int32_t Get() const { return Count.load(std::memory_order_acquire); }
+
+	private:
+		std::atomic<int32_t> Count;
+	};
+
+	template<>
+	class TRefCounter<RefCountMode::SingleThreaded>
+	{
+	public:
+		explicit TRefCounter(int32_t Initial) : Count(Initial) {}
+
+		void Increment() { ++Count; }
+		bool Decrement() { return --Count == 0; }
+
+		bool IncrementIfNotZero()
+		{
+			if (Count == 0)
+			{
+				return false;
+			}
+			++Count;
+			return true;
+		}
+
+		int32_t Get() const { return Count; }
+
+	private:
+		int32_t Count;
+	};
+
+	/**
+	 * @brief Bloque de control compartido por todos los TSharedPointer y TWeakPointer de un objeto.
+	 *
+	 * StrongCount cuenta los TSharedPointer. WeakCount cuenta los TWeakPointer ms uno que
+	 * representa a todos los fuertes juntos. Cuando StrongCount llega a cero se destruye el
+	 * objeto; cuando WeakCount llega a cero se libera el bloque.
+	 */
+	template<RefCountMode Mode>
+	class TRefControlBlock
+	{
+	public:
+		TRefControlBlock() : StrongCount(1), WeakCount(1) {}
+
+		void AddStrongRef() { StrongCount.Increment(); }
+		bool TryAddStrongRef() { return StrongCount.IncrementIfNotZero(); }
+		void AddWeakRef() { WeakCount.Increment(); }
+
+		void ReleaseStrongRef()
+		{
+			if (StrongCount.Decrement())
+			{
+				DestroyObject();
+				ReleaseWeakRef();  ///< Soltar la referencia dbil colectiva de los punteros fuertes.
+			}
+		}
+
+		void ReleaseWeakRef()
+		{
+			if (WeakCount.Decrement())
+			{
+				DestroyBlock();
+			}
+		}
+
+		int32_t GetStrongCount() const { return StrongCount.Get(); }
+
+	protected:
+		virtual ~TRefControlBlock() {}
+
+		/**
+		 * @brief Destruye el objeto gestionado (se llama una vez, al soltar el ltimo puntero fuerte).
+		 */
+		virtual void DestroyObject() = 0;
+
+		/**
+		 * @brief Libera el propio bloque de control.
+		 */
+		virtual void DestroyBlock() { delete this; }
+
+	private:
+		TRefCounter<Mode> StrongCount;  ///< Nmero de TSharedPointer.
+		TRefCounter<Mode> WeakCount;    ///< Nmero de TWeakPointer + 1 mientras haya punteros fuertes.
+	};
+
+	/**
+	 * @brief Bloque de control para un objeto creado por separado con new.
+	 */
+	template<typename T, RefCountMode Mode>
+	class TPointerControlBlock : public TRefControlBlock<Mode>
+	{
+	public:
+		explicit TPointerControlBlock(T* InObject) : Object(InObject) {}
+
+	protected:
+		void DestroyObject() override { delete Object; }
+
+	private:
+		T* Object;  ///< Objeto con su tipo original, para destruirlo correctamente aunque se haya convertido a una base.
+	};
+
+	/**
+	 * @brief Bloque de control que contiene el propio objeto (lo usan MakeShared y AllocateShared).
+	 *
+	 * Objeto y contadores quedan en una sola reserva contigua: una asignacin en lugar de dos y
+	 * los contadores en la misma lnea de cach que el inicio del objeto.
+	 */
+	template<typename T, RefCountMode Mode, typename Allocator>
+	class TInlineControlBlock : public TRefControlBlock<Mode>
+	{
+	public:
+		template<typename... Args>
+		explicit TInlineControlBlock(const Allocator& InAlloc, Args&&... args) : Alloc(InAlloc)
+		{
+			::new (static_cast<void*>(Storage)) T(std::forward<Args>(args)...);
+		}
+
+		T* GetObject() { return reinterpret_cast<T*>(Storage); }
+
+	protected:
+		void DestroyObject() override { GetObject()->~T(); }
+
+		void DestroyBlock() override
+		{
+			Allocator BlockAlloc = Alloc;  ///< Copia: el bloque deja de existir antes de devolver su memoria.
+			this->~TInlineControlBlock();
+			TAllocatorTraits<Allocator>::template DeallocateObject<TInlineControlBlock>(BlockAlloc, this);
+		}
+
+	private:
+		Allocator Alloc;                                 ///< Poltica con la que se reserv el bloque.
+		alignas(T) unsigned char Storage[sizeof(T)];    ///< Almacenamiento del objeto gestionado.
+	};
+
+	template<typename T, RefCountMode Mode>
+	class TWeakPointer;
+
 	/**
 	 * @brief Clase TSharedPointer para manejar la gestin de memoria compartida.
 	 *
 	 * La clase TSharedPointer gestiona la memoria de un objeto de tipo T y lleva un
 	 * recuento de referencias para permitir la comparticin segura de un mismo objeto
 	 * en mltiples instancias de TSharedPointer.
+	 *
+	 * El recuento vive en un bloque de control (TRefControlBlock) con contadores fuerte y dbil.
+	 * En el modo por defecto (RefCountMode::ThreadSafe) los contadores son atmicos, as que
+	 * distintos hilos pueden copiar y destruir punteros al mismo objeto. El objeto en s no se
+	 * vuelve seguro entre hilos.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Modo de recuento de referencias.
 	 */
-	template<typename T>
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 	class TSharedPointer
 	{
 	public:
+		typedef TRefControlBlock<Mode> ControlBlock;
+
 		/**
 		 * @brief Constructor por defecto.
 		 *
-		 * Inicializa el puntero y el recuento de referencias a nullptr.
+		 * Inicializa el puntero y el bloque de control a nullptr.
 		 */
-		TSharedPointer() : ptr(nullptr), refCount(nullptr) {}
+		TSharedPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un puntero crudo.
 		 *
 		 * @param rawPtr Puntero crudo al objeto que se va a gestionar.
 		 */
-		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		explicit TSharedPointer(U* rawPtr)
+			: ptr(rawPtr), controlBlock(rawPtr ? new TPointerControlBlock<U, Mode>(rawPtr) : nullptr) {}
 
 		/**
-		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
+		 * @brief Constructor de aliasing: comparte el bloque de control de other pero apunta a aliasPtr.
 		 *
-		 * @param rawPtr Puntero crudo al objeto gestionado.
-		 * @param existingRefCount Puntero al recuento de referencias existente.
+		 * Se usa para las conversiones y para apuntar a un miembro del objeto gestionado.
+		 *
+		 * @param other Puntero compartido cuyo bloque de control se comparte.
+		 * @param aliasPtr Puntero que devolver get().
 		 */
-		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
+		template<typename U>
+		TSharedPointer(const TSharedPointer<U, Mode>& other, T* aliasPtr)
+			: ptr(aliasPtr), controlBlock(other.controlBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->AddStrongRef();
 			}
 		}
 
 		/**
 		 * @brief Constructor de copia.
 		 *
-		 * Copia el puntero y el recuento de referencias del otro TSharedPointer y
+		 * Copia el puntero y el bloque de control del otro TSharedPointer y
 		 * aumenta el recuento de referencias.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(const TSharedPointer<T>& other) : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(const TSharedPointer& other) : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
-			if (refCount)
+			if (controlBlock)
 			{
-				++(*refCount);
+				controlBlock->AddStrongRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de conversin desde un TSharedPointer a un tipo derivado.
+		 *
+		 * @param other Otro TSharedPointer cuyo tipo es convertible a T.
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		TSharedPointer(const TSharedPointer<U, Mode>& other) : ptr(other.ptr), controlBlock(other.controlBlock)
+		{
+			if (controlBlock)
+			{
+				controlBlock->AddStrongRef();
 			}
 		}
 
 		/**
 		 * @brief Constructor de movimiento.
 		 *
-		 * Transfiere la propiedad del puntero y el recuento de referencias del otro
+		 * Transfiere la propiedad del puntero y el bloque de control del otro
 		 * TSharedPointer al nuevo objeto TSharedPointer.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(TSharedPointer<T>&& other) noexcept : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(TSharedPointer&& other) noexcept : ptr(other.ptr), controlBlock(other.controlBlock)
 		{
 			other.ptr = nullptr;
-			other.refCount = nullptr;
+			other.controlBlock = nullptr;
 		}
 
 		/**
 		 * @brief Operador de asignacin de copia.
 		 *
-		 * Libera el objeto actual, copia el puntero y el recuento de referencias del otro
+		 * Libera el objeto actual, copia el puntero y el bloque de control del otro
 		 * TSharedPointer, y aumenta el recuento de referencias.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(const TSharedPointer<T>& other)
+		TSharedPointer& operator=(const TSharedPointer& other)
 		{
-			if (this != &other)
-			{
-				// Disminuir el recuento de referencias del objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
-				// Copiar datos del otro puntero compartido
-				ptr = other.ptr;
-				refCount = other.refCount;
-				if (refCount)
-				{
-					++(*refCount);
-				}
-			}
+			TSharedPointer(other).swap(*this);  ///< Copiar primero: seguro si other depende de *this.
 			return *this;
 		}
 
 		/**
 		 * @brief Operador de asignacin de movimiento.
 		 *
-		 * Libera el objeto actual, transfiere la propiedad del puntero y el recuento de
-		 * referencias del otro TSharedPointer al actual.
+		 * Libera el objeto actual, transfiere la propiedad del puntero y el bloque de
+		 * control del otro TSharedPointer al actual.
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(TSharedPointer<T>&& other) noexcept
+		TSharedPointer& operator=(TSharedPointer&& other) noexcept
 		{
-			if (this != &other)
-			{
-				// Liberar el objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
-				// Transferir los datos del otro puntero compartido
-				ptr = other.ptr;
-				refCount = other.refCount;
-				other.ptr = nullptr;
-				other.refCount = nullptr;
-			}
+			TSharedPointer(std::move(other)).swap(*this);
 			return *this;
 		}
 
@@ -164,10 +360,9 @@ namespace EngineUtilities {
 		 */
 		~TSharedPointer()
 		{
-			if (refCount && --(*refCount) == 0)
+			if (controlBlock)
 			{
-				delete ptr;
-				delete refCount;
+				controlBlock->ReleaseStrongRef();
 			}
 		}
 
@@ -204,10 +399,10 @@ namespace EngineUtilities {
 		 */
 		bool isNull() const { return ptr == nullptr; }
 
-
-	public:
-		T* ptr;       ///< Puntero al objeto gestionado.
-		int* refCount; ///< Puntero al recuento de referencias.
+		/**
+		 * @brief Nmero de TSharedPointer que comparten el objeto (aproximado si otros hilos los modifican).
+		 */
+		int32_t useCount() const { return controlBlock ? controlBlock->GetStrongCount() : 0; }
 
 		/**
 		 * @brief Mtodo swap.
@@ -216,74 +411,111 @@ namespace EngineUtilities {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		void swap(TSharedPointer<T>& other) noexcept
+		void swap(TSharedPointer& other) noexcept
 		{
-			T* tempPtr = other.ptr;
-			int* tempRefCount = other.refCount;
-
-			other.ptr = this->ptr;
-			other.refCount = this->refCount;
-
-			this->ptr = tempPtr;
-			this->refCount = tempRefCount;
+			std::swap(ptr, other.ptr);
+			std::swap(controlBlock, other.controlBlock);
 		}
 
 		/**
-				 * @brief Libera el objeto actual y opcionalmente asigna un nuevo objeto.
-				 *
-				 * @param newPtr Nuevo puntero crudo al objeto que se va a gestionar (por defecto es nullptr).
-				 */
+		 * @brief Libera el objeto actual y opcionalmente asigna un nuevo objeto.
+		 *
+		 * @param newPtr Nuevo puntero crudo al objeto que se va a gestionar (por defecto es nullptr).
+		 */
 		void reset(T* newPtr = nullptr)
 		{
-			// Disminuir el recuento de referencias del objeto actual
-			if (refCount && --(*refCount) == 0)
-			{
-				delete ptr;
-				delete refCount;
-			}
-
-			// Si newPtr es nullptr, asignar nullptr al puntero y recuento de referencias
-			if (newPtr == nullptr)
-			{
-				ptr = nullptr;
-				refCount = nullptr;
-			}
-			else
-			{
-				// Asignar nuevo objeto y manejar el recuento de referencias
-				ptr = newPtr;
-				refCount = new int(1);
-			}
+			TSharedPointer(newPtr).swap(*this);
 		}
 
-		// Mtodo de conversin para hacer cast dinmico
+		/**
+		 * @brief Conversin dinmica que comparte el bloque de control.
+		 *
+		 * @return Un TSharedPointer<U> al mismo objeto, o nulo si el objeto no es de tipo U.
+		 */
 		template<typename U>
-		TSharedPointer<U> dynamic_pointer_cast() const {
-			// Intenta convertir el puntero de tipo T a U
+		TSharedPointer<U, Mode> dynamic_pointer_cast() const {
 			U* castedPtr = dynamic_cast<U*>(ptr);
 			if (castedPtr) {
-				// Si la conversin es exitosa, devuelve un nuevo TSharedPointer<U>
-				return TSharedPointer<U>(castedPtr, refCount);
-			}
-			else {
-				// Si falla la conversin, devuelve un TSharedPointer<U> nulo
-				return TSharedPointer<U>();
+				return TSharedPointer<U, Mode>(*this, castedPtr);
 			}
+			return TSharedPointer<U, Mode>();
+		}
+
+		/**
+		 * @brief Conversin esttica (sin comprobacin) que comparte el bloque de control.
+		 */
+		template<typename U>
+		TSharedPointer<U, Mode> static_pointer_cast() const {
+			return TSharedPointer<U, Mode>(*this, static_cast<U*>(ptr));
 		}
+
+		template<typename U>
+		bool operator==(const TSharedPointer<U, Mode>& other) const { return ptr == other.get(); }
+		template<typename U>
+		bool operator!=(const TSharedPointer<U, Mode>& other) const { return ptr != other.get(); }
+
+	private:
+		template<typename U, RefCountMode M>
+		friend class TSharedPointer;
+		template<typename U, RefCountMode M>
+		friend class TWeakPointer;
+		template<typename U, RefCountMode M, typename Allocator, typename... Args>
+		friend TSharedPointer<U, M> AllocateShared(const Allocator& alloc, Args&&... args);
+
+		/**
+		 * @brief Adopta una referencia fuerte ya contada (usado por TWeakPointer::lock).
+		 */
+		TSharedPointer(T* rawPtr, ControlBlock* block, bool /*adoptRef*/) : ptr(rawPtr), controlBlock(block) {}
+
+		T* ptr;                      ///< Puntero al objeto gestionado.
+		ControlBlock* controlBlock;  ///< Bloque de control con los recuentos fuerte y dbil.
 	};
 
+	/**
+	 * @brief Crea un objeto de tipo T y su bloque de control en una sola reserva de la poltica dada.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Modo de recuento de referencias.
+	 * @param alloc Poltica de asignacin (THeapAllocator, TLinearAllocator, TPoolAllocator...).
+	 *              Se guarda una copia en el bloque para liberarlo; el recurso debe vivir ms que
+	 *              el ltimo TSharedPointer o TWeakPointer al objeto.
+	 * @param args Argumentos del constructor del objeto gestionado (se reenvan sin copias).
+	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
+	 */
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename Allocator, typename... Args>
+	TSharedPointer<T, Mode> AllocateShared(const Allocator& alloc, Args&&... args)
+	{
+		typedef TInlineControlBlock<T, Mode, Allocator> Block;
+		Allocator BlockAlloc = alloc;
+		void* Memory = TAllocatorTraits<Allocator>::template AllocateObject<Block>(BlockAlloc);
+		Block* NewBlock = nullptr;
+		try
+		{
+			NewBlock = ::new (Memory) Block(alloc, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			TAllocatorTraits<Allocator>::template DeallocateObject<Block>(BlockAlloc, Memory);
+			throw;
+		}
+		return TSharedPointer<T, Mode>(NewBlock->GetObject(), NewBlock, true);
+	}
+
 	/**
 	 * @brief Funcin de utilidad para crear un TSharedPointer.
 	 *
+	 * El objeto y su bloque de control se reservan juntos en el heap (una sola asignacin).
+	 *
 	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Modo de recuento de referencias.
 	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
-	 * @param args Argumentos del constructor del objeto gestionado.
+	 * @param args Argumentos del constructor del objeto gestionado (se reenvan sin copias).
 	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
 	 */
-	template<typename T, typename... Args>
-	TSharedPointer<T> MakeShared(Args... args)
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe, typename... Args>
+	TSharedPointer<T, Mode> MakeShared(Args&&... args)
 	{
-		return TSharedPointer<T>(new T(args...));
+		return AllocateShared<T, Mode>(THeapAllocator(), std::forward<Args>(args)...);
 	}
 }
 
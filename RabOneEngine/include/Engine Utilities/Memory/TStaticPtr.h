@@ -27,13 +27,78 @@
  * SOFTWARE.
 */
 #pragma once
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace EngineUtilities {
+  /**
+   * @brief Registro de los TStaticPtr creados, para destruirlos en orden inverso al de creacin.
+   *
+   * Un servicio que usa otro al crearse (por ejemplo un registro de assets que escribe en el
+   * logger) se crea despus y por tanto se destruye antes que l.
+   */
+  class StaticPtrRegistry {
+  public:
+    typedef void (*ShutdownFunction)();
+
+    /**
+     * @brief Anota la funcin de cierre de un singleton recin creado.
+     */
+    static void
+    Register(ShutdownFunction Function) {
+      std::lock_guard<std::mutex> Lock(GetMutex());
+      GetFunctions().push_back(Function);
+    }
+
+    /**
+     * @brief Destruye todos los singletons registrados, el ltimo creado primero.
+     *
+     * Debe llamarse cuando ningn otro hilo use ya los servicios (por ejemplo en BaseApp::destroy).
+     */
+    static void
+    ShutdownAll() {
+      std::vector<ShutdownFunction> Functions;
+      {
+        std::lock_guard<std::mutex> Lock(GetMutex());
+        Functions.swap(GetFunctions());
+      }
+      for (size_t i = Functions.size(); i > 0; --i) {
+        Functions[i - 1]();
+      }
+    }
+
+  private:
+    static std::mutex&
+    GetMutex() {
+      static std::mutex Mutex;
+      return Mutex;
+    }
+
+    static std::vector<ShutdownFunction>&
+    GetFunctions() {
+      static std::vector<ShutdownFunction> Functions;
+      return Functions;
+    }
+  };
+
   /**
  * @brief Clase TStaticPtr para manejo de un puntero esttico.
  *
  * La clase TStaticPtr gestiona un nico objeto esttico y proporciona mtodos
  * para acceder al objeto, verificar si el puntero es nulo y realizar operaciones
  * bsicas de manejo de memoria.
+ *
+ * Es segura entre hilos: el puntero se publica con un store release y se lee con un load
+ * acquire, as que un acceso a un singleton ya creado cuesta una sola carga atmica y no
+ * toma ningn lock. Solo la creacin (getOrCreate, initialize) y la destruccin (reset,
+ * shutdown) toman un mutex.
+ *
+ * El objeto pertenece al slot esttico, no a los objetos TStaticPtr: destruir un TStaticPtr
+ * no destruye la instancia. La instancia vive hasta shutdown(), reset() o
+ * StaticPtrRegistry::ShutdownAll(). Ninguna de esas llamadas puede hacerse mientras otro
+ * hilo siga usando el objeto.
  */
   template<typename T>
   class TStaticPtr {
@@ -41,7 +106,7 @@ namespace EngineUtilities {
     /**
      * @brief Inicializa el puntero esttico al objeto.
      *
-     * Inicializa el puntero esttico a nullptr.
+     * No modifica la instancia.
      */
     TStaticPtr() = default;
 
@@ -51,32 +116,49 @@ namespace EngineUtilities {
      * @param rawPtr Puntero crudo al objeto que se va a gestionar.
      */
     explicit TStaticPtr(T* rawPtr) {
-      if (instance != nullptr) {
-        delete instance;
-      }
-      instance = rawPtr;
+      reset(rawPtr);
     }
 
     /**
      * @brief Destructor.
      *
-     * Libera la memoria del objeto gestionado si es la ltima instancia.
+     * No libera la instancia compartida; su vida termina con shutdown().
      */
-    ~TStaticPtr() {
-      if (instance != nullptr) {
-        delete instance;
-        instance = nullptr;
-      }
-    }
+    ~TStaticPtr() = default;
 
     /**
      * @brief Obtener el puntero crudo.
      *
-     * @return Puntero crudo al objeto gestionado.
+     * @return Puntero crudo al objeto gestionado, o nullptr si todava no existe.
      */
     static T*
       get() {
-      return instance;
+      return instance.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Obtener la instancia, crendola con T() la primera vez (doble comprobacin).
+     *
+     * @return La instancia, o nullptr si ya se llam a shutdown().
+     */
+    static T*
+      getOrCreate() {
+      T* Current = instance.load(std::memory_order_acquire);
+      if (Current) {
+        return Current;
+      }
+      return create([]() { return new T(); });
+    }
+
+    /**
+     * @brief Crear la instancia con argumentos concretos si todava no existe.
+     *
+     * @return La instancia (la ya existente si otro hilo lleg antes), o nullptr tras shutdown().
+     */
+    template<typename... Args>
+    static T*
+      initialize(Args&&... args) {
+      return create([&]() { return new T(std::forward<Args>(args)...); });
     }
 
     /**
@@ -86,7 +168,7 @@ namespace EngineUtilities {
      */
     static bool
       isNull() {
-      return instance == nullptr;
+      return get() == nullptr;
     }
 
     /**
@@ -98,26 +180,80 @@ namespace EngineUtilities {
      */
     static void
       reset(T* rawPtr = nullptr) {
-      if (instance != nullptr) {
-        delete instance;
+      T* Old = nullptr;
+      {
+        std::lock_guard<std::mutex> Lock(mutex);
+        if (rawPtr) {
+          isShutDown = false;
+          registerShutdown();
+        }
+        Old = instance.exchange(rawPtr, std::memory_order_acq_rel);
       }
-      instance = rawPtr;
+      delete Old;
+    }
+
+    /**
+     * @brief Destruir la instancia y bloquear su recreacin perezosa.
+     *
+     * Despus de shutdown(), getOrCreate() devuelve nullptr en lugar de resucitar el servicio.
+     */
+    static void
+      shutdown() {
+      T* Old = nullptr;
+      {
+        std::lock_guard<std::mutex> Lock(mutex);
+        isShutDown = true;
+        Old = instance.exchange(nullptr, std::memory_order_acq_rel);
+      }
+      delete Old;
     }
 
   private:
-    static T* instance; ///< Puntero esttico al objeto gestionado.
+    template<typename Factory>
+    static T*
+      create(Factory&& factory) {
+      std::lock_guard<std::mutex> Lock(mutex);
+      T* Current = instance.load(std::memory_order_relaxed);
+      if (!Current && !isShutDown) {
+        Current = factory();
+        registerShutdown();
+        instance.store(Current, std::memory_order_release);
+      }
+      return Current;
+    }
+
+    /**
+     * @brief Anota shutdown() en el registro una sola vez por tipo (con el mutex tomado).
+     */
+    static void
+      registerShutdown() {
+      if (!isRegistered) {
+        isRegistered = true;
+        StaticPtrRegistry::Register(&shutdownFromRegistry);
+      }
+    }
+
+    static void
+      shutdownFromRegistry() {
+      {
+        std::lock_guard<std::mutex> Lock(mutex);
+        isRegistered = false;
+      }
+      shutdown();
+    }
+
+    static inline std::atomic<T*> instance{ nullptr }; ///< Puntero esttico al objeto gestionado.
+    static inline std::mutex mutex;                     ///< Serializa creacin y destruccin.
+    static inline bool isShutDown = false;              ///< true tras shutdown(): no se recrea.
+    static inline bool isRegistered = false;            ///< true si shutdown() est en StaticPtrRegistry.
   };
 
   /*
-  // Inicializar el puntero esttico
-  template<typename T>
-  T* TStaticPtr<T>::instance = nullptr;
-
   // Ejemplo de uso de TStaticPtr
   class MyClass
   {
   public:
-    MyClass(int value) : value(value)
+    MyClass(int value = 0) : value(value)
     {
       std::cout << "MyClass constructor: " << value << std::endl;
     }
@@ -161,6 +297,13 @@ namespace EngineUtilities {
       }
     }
 
+    // Creacin perezosa segura entre hilos: el primer hilo que llega crea el objeto
+    std::thread worker([]() { TStaticPtr<MyClass>::getOrCreate()->display(); });
+    TStaticPtr<MyClass>::getOrCreate()->display();
+    worker.join();
+
+    // Al cerrar, todos los singletons en orden inverso al de creacin
+    StaticPtrRegistry::ShutdownAll();
     return 0;
   }
   */
@@ -27,6 +27,7 @@
  * SOFTWARE.
 */
 #pragma once
+#include <utility>
 
 namespace EngineUtilities {
   /**
@@ -174,13 +175,13 @@ namespace EngineUtilities {
    *
    * @tparam T Tipo del objeto gestionado.
    * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
-   * @param args Argumentos del constructor del objeto gestionado.
+   * @param args Argumentos del constructor del objeto gestionado (se reenvan sin copias).
    * @return Un objeto TUniquePtr gestionando un nuevo objeto de tipo T.
    */
   template<typename T, typename... Args>
   TUniquePtr<T>
-    MakeUnique(Args... args) {
-    return TUniquePtr<T>(new T(args...));
+    MakeUnique(Args&&... args) {
+    return TUniquePtr<T>(new T(std::forward<Args>(args)...));
   }
 
   /*
@@ -37,44 +37,115 @@ namespace
 		 * La clase TWeakPointer proporciona una manera de observar un objeto gestionado por un TSharedPointer
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * an existe.
+		 *
+		 * El puntero dbil mantiene vivo el bloque de control (no el objeto) mediante el recuento dbil,
+		 * as que lock() puede comprobar de forma segura si el objeto sigue existiendo aunque otro hilo
+		 * est soltando la ltima referencia fuerte.
 		 */
-	template<typename T>
+	template<typename T, RefCountMode Mode = RefCountMode::ThreadSafe>
 	class TWeakPointer {
 	public:
+		typedef TRefControlBlock<Mode> ControlBlock;
+
 		/**
 		 * @brief Constructor por defecto.
 		 */
-		TWeakPointer() : ptr(nullptr), refCount(nullptr) {}
+		TWeakPointer() : ptr(nullptr), controlBlock(nullptr) {}
 
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
 		 * @param sharedPtr TSharedPointer desde el cual se observar el objeto.
 		 */
-		TWeakPointer(const TSharedPointer<T>& sharedPtr)
-			: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+		TWeakPointer(const TSharedPointer<U, Mode>& sharedPtr)
+			: ptr(sharedPtr.ptr), controlBlock(sharedPtr.controlBlock) {
+			if (controlBlock) {
+				controlBlock->AddWeakRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TWeakPointer(const TWeakPointer& other)
+			: ptr(other.ptr), controlBlock(other.controlBlock) {
+			if (controlBlock) {
+				controlBlock->AddWeakRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TWeakPointer(TWeakPointer&& other) noexcept
+			: ptr(other.ptr), controlBlock(other.controlBlock) {
+			other.ptr = nullptr;
+			other.controlBlock = nullptr;
+		}
+
+		/**
+		 * @brief Destructor. Suelta la referencia dbil; el ltimo dueo libera el bloque de control.
+		 */
+		~TWeakPointer() {
+			if (controlBlock) {
+				controlBlock->ReleaseWeakRef();
+			}
+		}
+
+		TWeakPointer&
+			operator=(const TWeakPointer& other) {
+			TWeakPointer(other).swap(*this);
+			return *this;
+		}
+
+		TWeakPointer&
+			operator=(TWeakPointer&& other) noexcept {
+			TWeakPointer(std::move(other)).swap(*this);
+			return *this;
 		}
 
 		/**
 		 * @brief Convertir TWeakPointer a TSharedPointer.
 		 *
+		 * El recuento fuerte solo se incrementa si todava no es cero, de modo que nunca se
+		 * resucita un objeto que otro hilo est destruyendo.
+		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
 		 */
-		TSharedPointer<T>
+		TSharedPointer<T, Mode>
 			lock() const {
-			if (refCount && *refCount > 0) {
-				return TSharedPointer<T>(ptr, refCount);
+			if (controlBlock && controlBlock->TryAddStrongRef()) {
+				return TSharedPointer<T, Mode>(ptr, controlBlock, true);
 			}
-			return TSharedPointer<T>();
+			return TSharedPointer<T, Mode>();
 		}
 
-		// Hacer que TSharedPointer sea un amigo para acceder a los miembros privados.
-		template<typename U>
-		friend class TSharedPointer;
+		/**
+		 * @brief Comprobar si el objeto observado ya fue destruido.
+		 */
+		bool
+			expired() const {
+			return !controlBlock || controlBlock->GetStrongCount() == 0;
+		}
+
+		/**
+		 * @brief Dejar de observar el objeto.
+		 */
+		void
+			reset() {
+			TWeakPointer().swap(*this);
+		}
+
+		void
+			swap(TWeakPointer& other) noexcept {
+			std::swap(ptr, other.ptr);
+			std::swap(controlBlock, other.controlBlock);
+		}
 
 	private:
-		T* ptr;       ///< Puntero al objeto observado.
-		int* refCount; ///< Puntero al recuento de referencias del TSharedPointer original.
+		T* ptr;                      ///< Puntero al objeto observado.
+		ControlBlock* controlBlock;  ///< Bloque de control compartido con los TSharedPointer del objeto.
 	};
 
 	/*
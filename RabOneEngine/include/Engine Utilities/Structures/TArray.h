@@ -26,9 +26,29 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
 */
-
 #pragma once
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Engine Utilities/Memory/TAllocator.h"
+
 namespace EngineUtilities {
+	/**
+	 * @brief Indica si un objeto de tipo T puede reubicarse en memoria copiando sus bytes.
+	 *
+	 * Por defecto solo los tipos trivialmente copiables se consideran reubicables. Un tipo que
+	 * no guarda punteros a s mismo (por ejemplo un puntero inteligente) puede especializar esta
+	 * plantilla para que TArray lo mueva con memcpy al crecer.
+	 */
+	template<typename T>
+	struct TIsTriviallyRelocatable
+	{
+		static constexpr bool Value = std::is_trivially_copyable<T>::value;
+	};
+
 	/**
 	 * @brief TArray es una clase de array dinmica para almacenar elementos de tipo T.
 	 *
@@ -36,44 +56,144 @@ namespace EngineUtilities {
 	 * colecciones de elementos, con operaciones bsicas como agregar, eliminar y acceder a elementos.
 	 * La memoria se gestiona dinmicamente, aumentando la capacidad del array segn sea necesario.
 	 *
+	 * Las ranuras libres se mantienen como memoria sin inicializar: los elementos se construyen
+	 * en su lugar al aadirse y se destruyen al eliminarse. Al crecer, los elementos se mueven
+	 * (o se copian con memcpy si el tipo es trivialmente reubicable) en vez de copiarse.
+	 *
 	 * @tparam T El tipo de elementos almacenados en el array.
+	 * @tparam Allocator Poltica de asignacin (ver TAllocator.h). Por defecto usa el heap.
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = THeapAllocator>
 	class TArray
 	{
 	private:
 		T* Data;           ///< Puntero a la memoria donde se almacenan los elementos del array.
 		size_t Capacity;   ///< Capacidad actual del array (nmero de elementos que puede almacenar).
 		size_t Size;       ///< Nmero de elementos actualmente en el array.
+		Allocator Alloc;   ///< Poltica de la que se obtiene la memoria de los elementos.
+
+		T* AllocateElements(size_t Count)
+		{
+			return static_cast<T*>(Alloc.Allocate(Count * sizeof(T), alignof(T)));
+		}
+
+		void FreeElements(T* Block, size_t Count)
+		{
+			if (Block)
+			{
+				Alloc.Deallocate(Block, Count * sizeof(T), alignof(T));
+			}
+		}
 
 		/**
-		 * @brief Redimensiona el array para tener una nueva capacidad.
+		 * @brief Reubica Count elementos de Source a la memoria sin inicializar de Dest.
 		 *
-		 * @param NewCapacity La nueva capacidad del array.
+		 * Al terminar, los elementos de Source quedan destruidos.
 		 */
-		void Resize(size_t NewCapacity)
+		static void RelocateElements(T* Dest, T* Source, size_t Count)
+		{
+			if constexpr (TIsTriviallyRelocatable<T>::Value)
+			{
+				if (Count)
+				{
+					std::memcpy(static_cast<void*>(Dest), static_cast<const void*>(Source), Count * sizeof(T));
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < Count; ++i)
+				{
+					::new (static_cast<void*>(Dest + i)) T(std::move_if_noexcept(Source[i]));
+					Source[i].~T();
+				}
+			}
+		}
+
+		/**
+		 * @brief Destruye los elementos en el rango [First, Last).
+		 */
+		static void DestroyElements(T* First, T* Last)
 		{
-			T* NewData = new T[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			if constexpr (!std::is_trivially_destructible<T>::value)
 			{
-				NewData[i] = Data[i];  ///< Copiar los elementos existentes al nuevo bloque de memoria.
+				for (; First != Last; ++First)
+				{
+					First->~T();
+				}
 			}
-			delete[] Data;  ///< Liberar la memoria del array antiguo.
+		}
+
+		/**
+		 * @brief Redimensiona el array para tener una nueva capacidad.
+		 *
+		 * @param NewCapacity La nueva capacidad del array (debe ser al menos Size).
+		 */
+		void Resize(size_t NewCapacity)
+		{
+			T* NewData = NewCapacity ? AllocateElements(NewCapacity) : nullptr;  ///< Memoria sin inicializar con la nueva capacidad.
+			RelocateElements(NewData, Data, Size);  ///< Mover los elementos existentes al nuevo bloque de memoria.
+			FreeElements(Data, Capacity);  ///< Liberar la memoria del array antiguo.
 			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
 			Capacity = NewCapacity;  ///< Actualizar la capacidad del array.
 		}
 
 	public:
+		typedef T* Iterator;
+		typedef const T* ConstIterator;
+
 		/**
 		 * @brief Constructor por defecto que inicializa el array con capacidad y tamao cero.
 		 */
 		TArray() : Data(nullptr), Capacity(0), Size(0)	{}
 
+		/**
+		 * @brief Constructor que usa una poltica de asignacin concreta (por ejemplo una arena).
+		 *
+		 * @param InAllocator La poltica de asignacin a usar.
+		 */
+		explicit TArray(const Allocator& InAllocator) : Data(nullptr), Capacity(0), Size(0), Alloc(InAllocator)	{}
+
+		/**
+		 * @brief Constructor de copia. La copia usa la misma poltica de asignacin.
+		 */
+		TArray(const TArray& Other) : Data(nullptr), Capacity(0), Size(0), Alloc(Other.Alloc)
+		{
+			Reserve(Other.Size);
+			for (; Size < Other.Size; ++Size)
+			{
+				::new (static_cast<void*>(Data + Size)) T(Other.Data[Size]);
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento. Toma la memoria del otro array sin copiar elementos.
+		 */
+		TArray(TArray&& Other) noexcept
+			: Data(Other.Data), Capacity(Other.Capacity), Size(Other.Size), Alloc(Other.Alloc)
+		{
+			Other.Data = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin (copia o movimiento).
+		 */
+		TArray& operator=(TArray Other) noexcept
+		{
+			std::swap(Data, Other.Data);
+			std::swap(Capacity, Other.Capacity);
+			std::swap(Size, Other.Size);
+			std::swap(Alloc, Other.Alloc);
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al array.
 		 */
 		~TArray()	{
-			delete[] Data;  ///< Liberar la memoria del array.
+			DestroyElements(Data, Data + Size);  ///< Destruir los elementos.
+			FreeElements(Data, Capacity);  ///< Liberar la memoria del array.
 		}
 
 		/**
@@ -82,16 +202,90 @@ namespace EngineUtilities {
 		 * @param Element El elemento a aadir al array.
 		 */
 		void Add(const T& Element)
+		{
+			Emplace(Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array movindolo.
+		 *
+		 * @param Element El elemento a aadir al array.
+		 */
+		void Add(T&& Element)
+		{
+			Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Construye un nuevo elemento directamente al final del array.
+		 *
+		 * @param Args Argumentos que se reenvan al constructor de T.
+		 * @return Referencia al elemento construido.
+		 */
+		template<typename... Args>
+		T& Emplace(Args&&... args)
 		{
 			if (Size == Capacity)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				// El argumento puede ser una referencia a un elemento de este mismo array, as que
+				// se construye en el bloque nuevo antes de reubicar los elementos antiguos.
+				size_t NewCapacity = Capacity == 0 ? 1 : Capacity * 2;
+				T* NewData = AllocateElements(NewCapacity);
+				::new (static_cast<void*>(NewData + Size)) T(std::forward<Args>(args)...);
+				RelocateElements(NewData, Data, Size);
+				FreeElements(Data, Capacity);
+				Data = NewData;
+				Capacity = NewCapacity;
+			}
+			else
+			{
+				::new (static_cast<void*>(Data + Size)) T(std::forward<Args>(args)...);
 			}
-			Data[Size++] = Element;  ///< Aadir el nuevo elemento y aumentar el tamao.
+			return Data[Size++];  ///< Aumentar el tamao y devolver el nuevo elemento.
 		}
 
 		/**
-		 * @brief Elimina el elemento en la posicin especificada.
+		 * @brief Reserva memoria para al menos Number elementos sin cambiar el tamao.
+		 *
+		 * @param Number Nmero de elementos que el array podr contener sin redimensionar.
+		 */
+		void Reserve(size_t Number)
+		{
+			if (Number > Capacity)
+			{
+				Resize(Number);
+			}
+		}
+
+		/**
+		 * @brief Reduce la capacidad al nmero de elementos actual, liberando la memoria sobrante.
+		 */
+		void Shrink()
+		{
+			if (Capacity > Size)
+			{
+				Resize(Size);
+			}
+		}
+
+		/**
+		 * @brief Cambia el nmero de elementos sin construir los nuevos.
+		 *
+		 * Pensado para llenar el array directamente (por ejemplo con memcpy), por lo que solo
+		 * est disponible para tipos trivialmente copiables.
+		 *
+		 * @param NewSize El nuevo nmero de elementos.
+		 */
+		void SetNumUninitialized(size_t NewSize)
+		{
+			static_assert(std::is_trivially_copyable<T>::value,
+			              "SetNumUninitialized requiere un tipo trivialmente copiable");
+			Reserve(NewSize);
+			Size = NewSize;
+		}
+
+		/**
+		 * @brief Elimina el elemento en la posicin especificada conservando el orden.
 		 *
 		 * @param Index La posicin del elemento a eliminar.
 		 */
@@ -104,11 +298,73 @@ namespace EngineUtilities {
 			}
 			for (size_t i = Index; i < Size - 1; ++i)
 			{
-				Data[i] = Data[i + 1];  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
+				Data[i] = std::move(Data[i + 1]);  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
 			}
+			Data[Size - 1].~T();  ///< Destruir el ltimo elemento, que ya fue movido.
 			--Size;  ///< Disminuir el tamao del array.
 		}
 
+		/**
+		 * @brief Elimina el elemento en la posicin especificada moviendo el ltimo a su lugar.
+		 *
+		 * Cuesta O(1) pero no conserva el orden de los elementos.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAtSwap(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				return;
+			}
+			if (Index != Size - 1)
+			{
+				Data[Index] = std::move(Data[Size - 1]);  ///< Mover el ltimo elemento al hueco.
+			}
+			Data[Size - 1].~T();
+			--Size;
+		}
+
+		/**
+		 * @brief Elimina todos los elementos que cumplen un predicado conservando el orden.
+		 *
+		 * Compacta el array en una sola pasada, as que cuesta O(n) sin importar cuntos
+		 * elementos se eliminen.
+		 *
+		 * @param Predicate Funcin que recibe un elemento y devuelve true si debe eliminarse.
+		 * @return El nmero de elementos eliminados.
+		 */
+		template<typename Pred>
+		size_t RemoveAll(Pred Predicate)
+		{
+			size_t Write = 0;
+			for (size_t Read = 0; Read < Size; ++Read)
+			{
+				if (!Predicate(Data[Read]))
+				{
+					if (Write != Read)
+					{
+						Data[Write] = std::move(Data[Read]);
+					}
+					++Write;
+				}
+			}
+			size_t Removed = Size - Write;
+			DestroyElements(Data + Write, Data + Size);
+			Size = Write;
+			return Removed;
+		}
+
+		/**
+		 * @brief Elimina todos los elementos conservando la memoria reservada.
+		 */
+		void Empty()
+		{
+			DestroyElements(Data, Data + Size);
+			Size = 0;
+		}
+
 		/**
 		 * @brief Sobrecarga del operador [] para acceder a elementos por ndice.
 		 *
@@ -141,6 +397,12 @@ namespace EngineUtilities {
 			return Data[Index];  ///< Devolver el elemento en la posicin especificada.
 		}
 
+		/**
+		 * @brief Devuelve un puntero al primer elemento del array.
+		 */
+		T* GetData() { return Data; }
+		const T* GetData() const { return Data; }
+
 		/**
 		 * @brief Devuelve el nmero de elementos actualmente en el array.
 		 *
@@ -160,6 +422,11 @@ namespace EngineUtilities {
 		{
 			return Capacity;  ///< Devolver la capacidad actual del array.
 		}
+
+		Iterator begin() { return Data; }
+		Iterator end() { return Data + Size; }
+		ConstIterator begin() const { return Data; }
+		ConstIterator end() const { return Data + Size; }
 	};
 
 	// EXAMPLE
@@ -169,6 +436,7 @@ namespace EngineUtilities {
 
 		// TArray Example
 		TArray<int> MyArray;
+		MyArray.Reserve(8);  ///< Reservar memoria una sola vez.
 		MyArray.Add(1);
 		MyArray.Add(2);
 		MyArray.Add(3);
@@ -177,13 +445,19 @@ namespace EngineUtilities {
 
 		MyArray.Add(6);
 		MyArray.RemoveAt(2);
+		MyArray.RemoveAtSwap(0);  ///< O(1), el ltimo elemento ocupa la posicin 0.
+		MyArray.RemoveAll([](int Value) { return Value % 2 == 0; });  ///< Eliminar los pares.
 
-		for (size_t i = 0; i < MyArray.Num(); ++i)
+		for (int Value : MyArray)
 		{
-			std::cout << MyArray[i] << " ";
+			std::cout << Value << " ";
 		}
 		std::cout << std::endl;
 
+		TArray<std::string> Names;
+		Names.Emplace(3, 'a');  ///< Construye "aaa" directamente en el array.
+
+		MyArray.Shrink();
 		std::cout << "Size: " << MyArray.Num() << ", Capacity: " << MyArray.GetCapacity() << std::endl;
 
 		return 0;
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace EngineUtilities {
+	/**
+	 * @brief Mezcla los bits de un valor hash para repartirlo uniformemente.
+	 *
+	 * Las tablas hash de EngineUtilities usan capacidades potencia de dos y toman los bits
+	 * bajos del hash como ndice. Algunos hashes (por ejemplo std::hash de enteros o punteros)
+	 * son la identidad, por lo que se aplica un finalizador (splitmix64 / murmur3) antes de usarlos.
+	 *
+	 * @param Value El hash original.
+	 * @return El hash con sus bits mezclados.
+	 */
+	inline size_t HashMix(size_t Value)
+	{
+#if SIZE_MAX > 0xFFFFFFFFu
+		uint64_t X = static_cast<uint64_t>(Value);
+		X ^= X >> 30;
+		X *= 0xBF58476D1CE4E5B9ull;
+		X ^= X >> 27;
+		X *= 0x94D049BB133111EBull;
+		X ^= X >> 31;
+		return static_cast<size_t>(X);
+#else
+		uint32_t X = static_cast<uint32_t>(Value);
+		X ^= X >> 16;
+		X *= 0x85EBCA6Bu;
+		X ^= X >> 13;
+		X *= 0xC2B2AE35u;
+		X ^= X >> 16;
+		return static_cast<size_t>(X);
+#endif
+	}
+
+	/**
+	 * @brief Combina un hash con otro, til para claves compuestas.
+	 *
+	 * @param Seed El hash acumulado.
+	 * @param Value El hash a combinar.
+	 * @return El hash combinado.
+	 */
+	inline size_t HashCombine(size_t Seed, size_t Value)
+	{
+		return Seed ^ (Value + static_cast<size_t>(0x9E3779B97F4A7C15ull) + (Seed << 6) + (Seed >> 2));
+	}
+
+	/**
+	 * @brief Calcula el hash FNV-1a de un bloque de bytes.
+	 *
+	 * @param Bytes Puntero al inicio de los datos.
+	 * @param Length Nmero de bytes.
+	 * @return El hash de los datos.
+	 */
+	inline size_t HashBytes(const void* Bytes, size_t Length)
+	{
+		const unsigned char* Ptr = static_cast<const unsigned char*>(Bytes);
+#if SIZE_MAX > 0xFFFFFFFFu
+		uint64_t H = 0xCBF29CE484222325ull;
+		for (size_t i = 0; i < Length; ++i)
+		{
+			H ^= Ptr[i];
+			H *= 0x100000001B3ull;
+		}
+#else
+		uint32_t H = 0x811C9DC5u;
+		for (size_t i = 0; i < Length; ++i)
+		{
+			H ^= Ptr[i];
+			H *= 0x01000193u;
+		}
+#endif
+		return HashMix(static_cast<size_t>(H));
+	}
+
+	/**
+	 * @brief Functor de hash por defecto de los contenedores de EngineUtilities.
+	 *
+	 * Usa std::hash y mezcla el resultado con HashMix. Para usar un tipo propio como clave
+	 * basta con especializar THash para ese tipo o pasar otro functor como parmetro de plantilla.
+	 *
+	 * @tparam T El tipo a hashear.
+	 */
+	template<typename T>
+	struct THash
+	{
+		size_t operator()(const T& Value) const
+		{
+			return HashMix(std::hash<T>()(Value));
+		}
+	};
+}
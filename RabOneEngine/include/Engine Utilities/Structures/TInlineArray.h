@@ -0,0 +1,490 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TArray.h"
+
+namespace EngineUtilities {
+	/**
+	 * @brief TInlineArray es un array dinmico que guarda sus primeros N elementos dentro del objeto.
+	 *
+	 * Mientras el array tenga N elementos o menos no reserva memoria dinmica; al superar ese
+	 * nmero los elementos pasan a un bloque en el heap y el array se comporta igual que TArray.
+	 * Est pensado para listas cortas (componentes, texturas o buffers de un actor) donde casi
+	 * siempre hay pocos elementos.
+	 *
+	 * Ofrece la misma interfaz que TArray.
+	 *
+	 * @tparam T El tipo de elementos almacenados en el array.
+	 * @tparam N Nmero de elementos que caben sin reservar memoria dinmica.
+	 * @tparam Allocator Poltica de asignacin para el bloque externo (ver TAllocator.h).
+	 */
+	template<typename T, size_t N, typename Allocator = THeapAllocator>
+	class TInlineArray
+	{
+		static_assert(N > 0, "TInlineArray necesita al menos un elemento en linea");
+
+	private:
+		alignas(T) unsigned char InlineStorage[N * sizeof(T)];  ///< Memoria para los primeros N elementos.
+		T* Data;           ///< Apunta a InlineStorage o al bloque del heap.
+		size_t Capacity;   ///< Capacidad actual del array (N mientras se usa la memoria en lnea).
+		size_t Size;       ///< Nmero de elementos actualmente en el array.
+		Allocator Alloc;   ///< Poltica de la que se obtiene el bloque externo.
+
+		T* InlineData() { return reinterpret_cast<T*>(InlineStorage); }
+
+		T* AllocateElements(size_t Count)
+		{
+			return static_cast<T*>(Alloc.Allocate(Count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Libera el bloque actual si no es la memoria en lnea.
+		 */
+		void FreeHeap()
+		{
+			if (!IsInline())
+			{
+				Alloc.Deallocate(Data, Capacity * sizeof(T), alignof(T));
+			}
+		}
+
+		/**
+		 * @brief Reubica Count elementos de Source a la memoria sin inicializar de Dest.
+		 */
+		static void RelocateElements(T* Dest, T* Source, size_t Count)
+		{
+			if constexpr (TIsTriviallyRelocatable<T>::Value)
+			{
+				if (Count)
+				{
+					std::memcpy(static_cast<void*>(Dest), static_cast<const void*>(Source), Count * sizeof(T));
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < Count; ++i)
+				{
+					::new (static_cast<void*>(Dest + i)) T(std::move_if_noexcept(Source[i]));
+					Source[i].~T();
+				}
+			}
+		}
+
+		static void DestroyElements(T* First, T* Last)
+		{
+			if constexpr (!std::is_trivially_destructible<T>::value)
+			{
+				for (; First != Last; ++First)
+				{
+					First->~T();
+				}
+			}
+		}
+
+		/**
+		 * @brief Cambia la capacidad del array, volviendo a la memoria en lnea si NewCapacity <= N.
+		 *
+		 * @param NewCapacity La nueva capacidad del array (debe ser al menos Size).
+		 */
+		void Resize(size_t NewCapacity)
+		{
+			T* NewData = NewCapacity <= N ? InlineData() : AllocateElements(NewCapacity);
+			if (NewData == Data)
+			{
+				return;
+			}
+			RelocateElements(NewData, Data, Size);
+			FreeHeap();
+			Data = NewData;
+			Capacity = NewCapacity <= N ? N : NewCapacity;
+		}
+
+		/**
+		 * @brief Toma los elementos de otro array, robando su bloque si est en el heap.
+		 */
+		void MoveFrom(TInlineArray& Other)
+		{
+			if (Other.IsInline())
+			{
+				RelocateElements(InlineData(), Other.Data, Other.Size);
+			}
+			else
+			{
+				Data = Other.Data;
+				Capacity = Other.Capacity;
+				Other.Data = Other.InlineData();
+				Other.Capacity = N;
+			}
+			Size = Other.Size;
+			Other.Size = 0;
+		}
+
+	public:
+		typedef T* Iterator;
+		typedef const T* ConstIterator;
+
+		/**
+		 * @brief Constructor por defecto. El array empieza vaco usando la memoria en lnea.
+		 */
+		TInlineArray() : Data(InlineData()), Capacity(N), Size(0)	{}
+
+		/**
+		 * @brief Constructor que usa una poltica de asignacin concreta para el bloque externo.
+		 *
+		 * @param InAllocator La poltica de asignacin a usar.
+		 */
+		explicit TInlineArray(const Allocator& InAllocator)
+			: Data(InlineData()), Capacity(N), Size(0), Alloc(InAllocator)	{}
+
+		/**
+		 * @brief Constructor de copia. La copia usa la misma poltica de asignacin.
+		 */
+		TInlineArray(const TInlineArray& Other) : Data(InlineData()), Capacity(N), Size(0), Alloc(Other.Alloc)
+		{
+			Reserve(Other.Size);
+			for (; Size < Other.Size; ++Size)
+			{
+				::new (static_cast<void*>(Data + Size)) T(Other.Data[Size]);
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento. Los elementos en lnea se reubican uno a uno.
+		 */
+		TInlineArray(TInlineArray&& Other) noexcept
+			: Data(InlineData()), Capacity(N), Size(0), Alloc(Other.Alloc)
+		{
+			MoveFrom(Other);
+		}
+
+		/**
+		 * @brief Operador de asignacin por copia.
+		 */
+		TInlineArray& operator=(const TInlineArray& Other)
+		{
+			if (this != &Other)
+			{
+				Empty();
+				Reserve(Other.Size);
+				for (; Size < Other.Size; ++Size)
+				{
+					::new (static_cast<void*>(Data + Size)) T(Other.Data[Size]);
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignacin por movimiento.
+		 */
+		TInlineArray& operator=(TInlineArray&& Other) noexcept
+		{
+			if (this != &Other)
+			{
+				Empty();
+				FreeHeap();
+				Data = InlineData();
+				Capacity = N;
+				Alloc = Other.Alloc;  ///< El bloque robado debe liberarse con la poltica que lo reserv.
+				MoveFrom(Other);
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor que destruye los elementos y libera el bloque del heap si existe.
+		 */
+		~TInlineArray()	{
+			DestroyElements(Data, Data + Size);
+			FreeHeap();
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array.
+		 *
+		 * @param Element El elemento a aadir al array.
+		 */
+		void Add(const T& Element)
+		{
+			Emplace(Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al final del array movindolo.
+		 *
+		 * @param Element El elemento a aadir al array.
+		 */
+		void Add(T&& Element)
+		{
+			Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Construye un nuevo elemento directamente al final del array.
+		 *
+		 * @param Args Argumentos que se reenvan al constructor de T.
+		 * @return Referencia al elemento construido.
+		 */
+		template<typename... Args>
+		T& Emplace(Args&&... args)
+		{
+			if (Size == Capacity)
+			{
+				// Construir primero en el bloque nuevo por si el argumento es un elemento de este array.
+				size_t NewCapacity = Capacity * 2;
+				T* NewData = AllocateElements(NewCapacity);
+				::new (static_cast<void*>(NewData + Size)) T(std::forward<Args>(args)...);
+				RelocateElements(NewData, Data, Size);
+				FreeHeap();
+				Data = NewData;
+				Capacity = NewCapacity;
+			}
+			else
+			{
+				::new (static_cast<void*>(Data + Size)) T(std::forward<Args>(args)...);
+			}
+			return Data[Size++];
+		}
+
+		/**
+		 * @brief Reserva memoria para al menos Number elementos sin cambiar el tamao.
+		 *
+		 * @param Number Nmero de elementos que el array podr contener sin redimensionar.
+		 */
+		void Reserve(size_t Number)
+		{
+			if (Number > Capacity)
+			{
+				Resize(Number);
+			}
+		}
+
+		/**
+		 * @brief Reduce la capacidad al nmero de elementos actual.
+		 *
+		 * Si los elementos caben en la memoria en lnea, el bloque del heap se libera.
+		 */
+		void Shrink()
+		{
+			if (!IsInline() && Capacity > Size)
+			{
+				Resize(Size);
+			}
+		}
+
+		/**
+		 * @brief Cambia el nmero de elementos sin construir los nuevos.
+		 *
+		 * Solo est disponible para tipos trivialmente copiables.
+		 *
+		 * @param NewSize El nuevo nmero de elementos.
+		 */
+		void SetNumUninitialized(size_t NewSize)
+		{
+			static_assert(std::is_trivially_copyable<T>::value,
+			              "SetNumUninitialized requiere un tipo trivialmente copiable");
+			Reserve(NewSize);
+			Size = NewSize;
+		}
+
+		/**
+		 * @brief Elimina el elemento en la posicin especificada conservando el orden.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAt(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				return;
+			}
+			for (size_t i = Index; i < Size - 1; ++i)
+			{
+				Data[i] = std::move(Data[i + 1]);  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
+			}
+			Data[Size - 1].~T();
+			--Size;
+		}
+
+		/**
+		 * @brief Elimina el elemento en la posicin especificada moviendo el ltimo a su lugar.
+		 *
+		 * @param Index La posicin del elemento a eliminar.
+		 */
+		void RemoveAtSwap(size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				return;
+			}
+			if (Index != Size - 1)
+			{
+				Data[Index] = std::move(Data[Size - 1]);
+			}
+			Data[Size - 1].~T();
+			--Size;
+		}
+
+		/**
+		 * @brief Elimina todos los elementos que cumplen un predicado conservando el orden, en O(n).
+		 *
+		 * @param Predicate Funcin que recibe un elemento y devuelve true si debe eliminarse.
+		 * @return El nmero de elementos eliminados.
+		 */
+		template<typename Pred>
+		size_t RemoveAll(Pred Predicate)
+		{
+			size_t Write = 0;
+			for (size_t Read = 0; Read < Size; ++Read)
+			{
+				if (!Predicate(Data[Read]))
+				{
+					if (Write != Read)
+					{
+						Data[Write] = std::move(Data[Read]);
+					}
+					++Write;
+				}
+			}
+			size_t Removed = Size - Write;
+			DestroyElements(Data + Write, Data + Size);
+			Size = Write;
+			return Removed;
+		}
+
+		/**
+		 * @brief Elimina todos los elementos conservando la memoria reservada.
+		 */
+		void Empty()
+		{
+			DestroyElements(Data, Data + Size);
+			Size = 0;
+		}
+
+		/**
+		 * @brief Sobrecarga del operador [] para acceder a elementos por ndice.
+		 *
+		 * @param Index La posicin del elemento a acceder.
+		 * @return Referencia al elemento en la posicin especificada.
+		 */
+		T& operator[](size_t Index)
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				exit(1);  ///< Salir del programa en caso de error.
+			}
+			return Data[Index];
+		}
+
+		/**
+		 * @brief Versin constante de la sobrecarga del operador [] para acceder a elementos por ndice.
+		 *
+		 * @param Index La posicin del elemento a acceder.
+		 * @return Referencia constante al elemento en la posicin especificada.
+		 */
+		const T& operator[](size_t Index) const
+		{
+			if (Index >= Size)
+			{
+				std::cerr << "Index out of range" << std::endl;  ///< Manejar el caso de ndice fuera de rango.
+				exit(1);  ///< Salir del programa en caso de error.
+			}
+			return Data[Index];
+		}
+
+		/**
+		 * @brief Indica si los elementos estn en la memoria en lnea (sin reservas en el heap).
+		 */
+		bool IsInline() const
+		{
+			return Data == reinterpret_cast<const T*>(InlineStorage);
+		}
+
+		T* GetData() { return Data; }
+		const T* GetData() const { return Data; }
+
+		/**
+		 * @brief Devuelve el nmero de elementos actualmente en el array.
+		 */
+		size_t Num() const
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Devuelve la capacidad actual del array (al menos N).
+		 */
+		size_t GetCapacity() const
+		{
+			return Capacity;
+		}
+
+		Iterator begin() { return Data; }
+		Iterator end() { return Data + Size; }
+		ConstIterator begin() const { return Data; }
+		ConstIterator end() const { return Data + Size; }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main() {
+
+		TInlineArray<int, 4> MyArray;  ///< Los primeros 4 elementos no reservan memoria dinmica.
+		MyArray.Add(1);
+		MyArray.Add(2);
+		MyArray.Add(3);
+		std::cout << "Inline: " << MyArray.IsInline() << std::endl;  ///< 1
+
+		MyArray.Add(4);
+		MyArray.Add(5);  ///< El quinto elemento mueve el contenido al heap.
+		std::cout << "Inline: " << MyArray.IsInline() << std::endl;  ///< 0
+
+		MyArray.RemoveAll([](int Value) { return Value > 2; });
+		MyArray.Shrink();  ///< Vuelve a la memoria en lnea.
+
+		for (int Value : MyArray)
+		{
+			std::cout << Value << " ";
+		}
+		std::cout << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
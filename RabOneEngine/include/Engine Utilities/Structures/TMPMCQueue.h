@@ -0,0 +1,263 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Engine Utilities/Memory/TAllocator.h"
+
+namespace EngineUtilities {
+	/**
+	 * @brief Cola acotada y sin bloqueos para varios productores y varios consumidores.
+	 *
+	 * Implementa el algoritmo de Dmitry Vyukov: cada celda guarda un nmero de secuencia que
+	 * indica si est lista para escribirse (Secuencia == Posicin) o para leerse
+	 * (Secuencia == Posicin + 1). Productores y consumidores reservan una posicin con un
+	 * compare-exchange sobre su propio contador y despus solo tocan su celda, as que nunca se
+	 * bloquean entre s. La capacidad se redondea a potencia de dos.
+	 *
+	 * @tparam T El tipo de los elementos de la cola.
+	 * @tparam Allocator Poltica de asignacin del buffer (ver TAllocator.h).
+	 */
+	template<typename T, typename Allocator = THeapAllocator>
+	class TMPMCQueue
+	{
+	private:
+		/**
+		 * @brief Celda del buffer: nmero de secuencia y memoria sin inicializar para el elemento.
+		 */
+		typedef std::atomic<size_t> AtomicIndex;
+
+		struct Cell
+		{
+			AtomicIndex Sequence;
+			alignas(T) unsigned char Storage[sizeof(T)];
+
+			T* Get() { return reinterpret_cast<T*>(Storage); }
+		};
+
+	public:
+		/**
+		 * @brief Crea la cola con capacidad para al menos InCapacity elementos.
+		 *
+		 * @param InCapacity Nmero mnimo de elementos que la cola puede contener.
+		 * @param InAllocator La poltica de asignacin a usar.
+		 */
+		explicit TMPMCQueue(size_t InCapacity, const Allocator& InAllocator = Allocator())
+			: Alloc(InAllocator)
+		{
+			Capacity = 2;
+			while (Capacity < InCapacity)
+			{
+				Capacity *= 2;
+			}
+			Mask = Capacity - 1;
+			Cells = static_cast<Cell*>(Alloc.Allocate(Capacity * sizeof(Cell), alignof(Cell)));
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				::new (static_cast<void*>(&Cells[i].Sequence)) AtomicIndex(i);
+			}
+			EnqueuePos.store(0, std::memory_order_relaxed);
+			DequeuePos.store(0, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Destructor que destruye los elementos pendientes y libera el buffer.
+		 */
+		~TMPMCQueue()
+		{
+			const size_t End = EnqueuePos.load(std::memory_order_relaxed);
+			for (size_t Pos = DequeuePos.load(std::memory_order_relaxed); Pos != End; ++Pos)
+			{
+				Cells[Pos & Mask].Get()->~T();  ///< Elementos que nadie lleg a extraer.
+			}
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				Cells[i].Sequence.~AtomicIndex();
+			}
+			Alloc.Deallocate(Cells, Capacity * sizeof(Cell), alignof(Cell));
+		}
+
+		TMPMCQueue(const TMPMCQueue&) = delete;
+		TMPMCQueue& operator=(const TMPMCQueue&) = delete;
+
+		/**
+		 * @brief Construye un elemento al final de la cola. Puede llamarse desde cualquier hilo.
+		 *
+		 * Si el constructor de T con Args puede lanzar, el elemento se construye antes de
+		 * reservar la celda y luego se mueve a ella: una excepcin tras reservarla dejara la
+		 * celda sin publicar y bloqueara la cola para siempre.
+		 *
+		 * @return true si se insert, false si la cola estaba llena.
+		 */
+		template<typename... Args>
+		bool TryEmplace(Args&&... args)
+		{
+			if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value)
+			{
+				static_assert(std::is_nothrow_move_constructible<T>::value,
+					"TMPMCQueue requiere que T se pueda mover sin lanzar excepciones");
+				T Element(std::forward<Args>(args)...);  ///< Si lanza, la cola no se ha tocado.
+				return TryEmplace(std::move(Element));
+			}
+
+			size_t Pos = EnqueuePos.load(std::memory_order_relaxed);
+			Cell* Target;
+			for (;;)
+			{
+				Target = &Cells[Pos & Mask];
+				const size_t Seq = Target->Sequence.load(std::memory_order_acquire);
+				const intptr_t Diff = static_cast<intptr_t>(Seq) - static_cast<intptr_t>(Pos);
+				if (Diff == 0)
+				{
+					if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					{
+						break;  ///< La celda es nuestra.
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;  ///< La celda an no se ha consumido: la cola est llena.
+				}
+				else
+				{
+					Pos = EnqueuePos.load(std::memory_order_relaxed);  ///< Otro productor se adelant.
+				}
+			}
+			::new (static_cast<void*>(Target->Storage)) T(std::forward<Args>(args)...);
+			Target->Sequence.store(Pos + 1, std::memory_order_release);  ///< Publicar a los consumidores.
+			return true;
+		}
+
+		bool TryPush(const T& Element) { return TryEmplace(Element); }
+		bool TryPush(T&& Element) { return TryEmplace(std::move(Element)); }
+
+		/**
+		 * @brief Extrae el primer elemento de la cola. Puede llamarse desde cualquier hilo.
+		 *
+		 * @param OutElement Recibe el elemento extrado.
+		 * @return true si se extrajo, false si la cola estaba vaca.
+		 */
+		bool TryPop(T& OutElement)
+		{
+			size_t Pos = DequeuePos.load(std::memory_order_relaxed);
+			Cell* Target;
+			for (;;)
+			{
+				Target = &Cells[Pos & Mask];
+				const size_t Seq = Target->Sequence.load(std::memory_order_acquire);
+				const intptr_t Diff = static_cast<intptr_t>(Seq) - static_cast<intptr_t>(Pos + 1);
+				if (Diff == 0)
+				{
+					if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;  ///< La celda an no se ha escrito: la cola est vaca.
+				}
+				else
+				{
+					Pos = DequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+			T* Element = Target->Get();
+			OutElement = std::move(*Element);
+			Element->~T();
+			Target->Sequence.store(Pos + Capacity, std::memory_order_release);  ///< Dejar la celda lista para la siguiente vuelta.
+			return true;
+		}
+
+		/**
+		 * @brief Nmero aproximado de elementos (exacto solo si ningn otro hilo opera a la vez).
+		 */
+		size_t Num() const
+		{
+			const size_t Enqueued = EnqueuePos.load(std::memory_order_acquire);
+			const size_t Dequeued = DequeuePos.load(std::memory_order_acquire);
+			return Enqueued > Dequeued ? Enqueued - Dequeued : 0;
+		}
+
+		bool IsEmpty() const { return Num() == 0; }
+		size_t GetCapacity() const { return Capacity; }
+
+	private:
+		// Datos de solo lectura tras la construccin.
+		Cell* Cells;
+		size_t Capacity;
+		size_t Mask;
+		Allocator Alloc;
+
+		alignas(CacheLineSize) AtomicIndex EnqueuePos;  ///< Contador de los productores.
+		alignas(CacheLineSize) AtomicIndex DequeuePos;  ///< Contador de los consumidores.
+		char Padding[CacheLineSize - sizeof(AtomicIndex)];  ///< Evita compartir lnea con lo que siga en memoria.
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		TMPMCQueue<std::string> Jobs(256);
+
+		std::vector<std::thread> Workers;
+		std::atomic<int> Done(0);
+		for (int w = 0; w < 4; ++w)
+		{
+			Workers.emplace_back([&]()
+			{
+				std::string Job;
+				while (Done.load() < 1000)
+				{
+					if (Jobs.TryPop(Job))
+					{
+						Done.fetch_add(1);  ///< Procesar el trabajo.
+					}
+				}
+			});
+		}
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			while (!Jobs.TryPush("job " + std::to_string(i))) {}
+		}
+
+		for (std::thread& Worker : Workers)
+		{
+			Worker.join();
+		}
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
@@ -27,21 +27,42 @@
  * SOFTWARE.
 */
 #pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "THash.h"
+#include "Engine Utilities/Memory/TAllocator.h"
+
 namespace EngineUtilities {
 	/**
-	 * @brief TMap es una clase de mapa (diccionario) dinmica para almacenar pares clave-valor.
+	 * @brief TMap es una tabla hash de direccionamiento abierto para almacenar pares clave-valor.
+	 *
+	 * Los pares se guardan directamente en un bloque contiguo de ranuras usando el esquema
+	 * Robin Hood: cada ranura recuerda la distancia de sondeo de su par y, al insertar, un par
+	 * que est lejos de su ranura ideal desplaza a uno que est ms cerca de la suya. Esto mantiene
+	 * las secuencias de sondeo cortas y permite terminar una bsqueda fallida en cuanto se encuentra
+	 * una ranura con menor distancia. Al eliminar, los pares siguientes se desplazan una ranura hacia
+	 * atrs, por lo que no se necesitan lpidas (tombstones).
 	 *
-	 * Esta implementacin de TMap proporciona una forma sencilla de almacenar y gestionar
-	 * colecciones de pares clave-valor, con operaciones bsicas como agregar, eliminar y acceder a valores.
-	 * La memoria se gestiona dinmicamente, aumentando la capacidad del mapa segn sea necesario.
+	 * Agregar, eliminar y buscar cuestan O(1) en promedio. La capacidad siempre es potencia de dos
+	 * y la tabla crece al superar un factor de carga de 0.8.
 	 *
-	 * @tparam K El tipo de las claves.
+	 * @tparam K El tipo de las claves. Debe soportar operator==.
 	 * @tparam V El tipo de los valores.
+	 * @tparam Hasher Functor de hash para las claves (THash<K> por defecto).
+	 * @tparam Allocator Poltica de asignacin de las ranuras (ver TAllocator.h).
 	 */
-	template<typename K, typename V>
+	template<typename K, typename V, typename Hasher = THash<K>, typename Allocator = THeapAllocator>
 	class TMap
 	{
-	private:
+	public:
+		/**
+		 * @brief Par clave-valor almacenado en cada ranura ocupada del mapa.
+		 */
 		struct Pair
 		{
 			K Key;
@@ -49,108 +70,496 @@ namespace EngineUtilities {
 
 			Pair() : Key(), Value() {}
 			Pair(const K& Key, const V& Value) : Key(Key), Value(Value) {}
+
+			template<typename KeyArg, typename... ValueArgs>
+			Pair(std::piecewise_construct_t, KeyArg&& InKey, ValueArgs&&... InArgs)
+				: Key(std::forward<KeyArg>(InKey)), Value(std::forward<ValueArgs>(InArgs)...) {}
 		};
 
-		Pair* Data;        ///< Puntero a la memoria donde se almacenan los pares clave-valor.
-		size_t Capacity;   ///< Capacidad actual del mapa (nmero de pares que puede almacenar).
-		size_t Size;       ///< Nmero de pares actualmente en el mapa.
+	private:
+		static constexpr size_t MinCapacity = 8;    ///< Capacidad mnima al reservar la primera ranura.
+		static constexpr size_t BlockAlignment = alignof(Pair) > alignof(uint32_t) ? alignof(Pair) : alignof(uint32_t);
+		static constexpr size_t InvalidIndex = ~static_cast<size_t>(0);
+
+		Pair* Data;            ///< Ranuras del mapa (memoria sin inicializar en las ranuras vacas).
+		uint32_t* Distances;   ///< Distancia de sondeo + 1 de cada ranura; 0 indica ranura vaca.
+		size_t Capacity;       ///< Nmero de ranuras (siempre cero o potencia de dos).
+		size_t Size;           ///< Nmero de pares actualmente en el mapa.
+		Hasher KeyHasher;      ///< Functor usado para calcular el hash de las claves.
+		Allocator Alloc;       ///< Poltica de la que se obtiene el bloque de ranuras.
+
+		/**
+		 * @brief Calcula cuntos bytes ocupan las ranuras antes del arreglo de distancias.
+		 */
+		static size_t DataBytes(size_t InCapacity)
+		{
+			size_t Bytes = InCapacity * sizeof(Pair);
+			return (Bytes + alignof(uint32_t) - 1) & ~(alignof(uint32_t) - 1);
+		}
+
+		/**
+		 * @brief Calcula el tamao total del bloque de ranuras y distancias.
+		 */
+		static size_t SlotBytes(size_t InCapacity)
+		{
+			return DataBytes(InCapacity) + InCapacity * sizeof(uint32_t);
+		}
+
+		/**
+		 * @brief Reserva un bloque nico para las ranuras y sus distancias.
+		 *
+		 * @param NewCapacity Nmero de ranuras a reservar.
+		 */
+		void AllocateSlots(size_t NewCapacity)
+		{
+			void* Block = Alloc.Allocate(SlotBytes(NewCapacity), BlockAlignment);
+			Data = static_cast<Pair*>(Block);
+			Distances = reinterpret_cast<uint32_t*>(static_cast<char*>(Block) + DataBytes(NewCapacity));
+			std::memset(Distances, 0, NewCapacity * sizeof(uint32_t));
+			Capacity = NewCapacity;
+		}
+
+		/**
+		 * @brief Libera un bloque reservado con AllocateSlots (no destruye los pares).
+		 */
+		void FreeSlots(Pair* Block, size_t BlockCapacity)
+		{
+			if (Block)
+			{
+				Alloc.Deallocate(Block, SlotBytes(BlockCapacity), BlockAlignment);
+			}
+		}
+
+		/**
+		 * @brief Destruye todos los pares ocupados sin liberar las ranuras.
+		 */
+		void DestroyPairs()
+		{
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				if (Distances[i] != 0)
+				{
+					Data[i].~Pair();
+					Distances[i] = 0;
+				}
+			}
+			Size = 0;
+		}
+
+		/**
+		 * @brief Busca la ranura que contiene la clave.
+		 *
+		 * @param Key La clave a buscar.
+		 * @param Hash El hash de la clave.
+		 * @return El ndice de la ranura, o InvalidIndex si la clave no est en el mapa.
+		 */
+		size_t FindIndex(const K& Key, size_t Hash) const
+		{
+			if (Size == 0)
+			{
+				return InvalidIndex;
+			}
+			const size_t Mask = Capacity - 1;
+			size_t Index = Hash & Mask;
+			for (uint32_t Dist = 1;; ++Dist)
+			{
+				const uint32_t SlotDist = Distances[Index];
+				if (SlotDist < Dist)
+				{
+					return InvalidIndex;  ///< Ranura vaca o ms "rica": la clave no puede estar ms adelante.
+				}
+				if (SlotDist == Dist && Data[Index].Key == Key)
+				{
+					return Index;
+				}
+				Index = (Index + 1) & Mask;
+			}
+		}
+
+		/**
+		 * @brief Inserta un par cuya clave se sabe que no est en el mapa.
+		 *
+		 * Requiere que haya al menos una ranura libre.
+		 *
+		 * @param Hash El hash de la clave del par.
+		 * @param Incoming El par a insertar.
+		 * @return El ndice de la ranura donde qued el par insertado.
+		 */
+		size_t InsertUnique(size_t Hash, Pair&& Incoming)
+		{
+			const size_t Mask = Capacity - 1;
+			size_t Index = Hash & Mask;
+			uint32_t Dist = 1;
+			for (;; Index = (Index + 1) & Mask, ++Dist)
+			{
+				if (Distances[Index] == 0)
+				{
+					::new (static_cast<void*>(&Data[Index])) Pair(std::move(Incoming));
+					Distances[Index] = Dist;
+					++Size;
+					return Index;
+				}
+				if (Distances[Index] < Dist)
+				{
+					break;  ///< Encontramos un par ms "rico": el nuevo par se queda con su ranura.
+				}
+			}
+
+			// El par nuevo ocupa esta ranura y el desplazado sigue sondeando hacia adelante.
+			const size_t Result = Index;
+			Pair Carry(std::move(Data[Index]));
+			Data[Index].~Pair();
+			::new (static_cast<void*>(&Data[Index])) Pair(std::move(Incoming));
+			std::swap(Dist, Distances[Index]);
+			for (Index = (Index + 1) & Mask, ++Dist;; Index = (Index + 1) & Mask, ++Dist)
+			{
+				if (Distances[Index] == 0)
+				{
+					::new (static_cast<void*>(&Data[Index])) Pair(std::move(Carry));
+					Distances[Index] = Dist;
+					++Size;
+					return Result;
+				}
+				if (Distances[Index] < Dist)
+				{
+					std::swap(Carry, Data[Index]);
+					std::swap(Dist, Distances[Index]);
+				}
+			}
+		}
 
 		/**
-		 * @brief Redimensiona el mapa para tener una nueva capacidad.
+		 * @brief Redimensiona la tabla y reubica todos los pares.
 		 *
-		 * @param NewCapacity La nueva capacidad del mapa.
+		 * @param NewCapacity La nueva capacidad (potencia de dos).
 		 */
-		void Resize(size_t NewCapacity)
+		void Rehash(size_t NewCapacity)
 		{
-			Pair* NewData = new Pair[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			Pair* OldData = Data;
+			uint32_t* OldDistances = Distances;
+			size_t OldCapacity = Capacity;
+
+			AllocateSlots(NewCapacity);
+			Size = 0;
+			for (size_t i = 0; i < OldCapacity; ++i)
 			{
-				NewData[i] = Data[i];  ///< Copiar los pares existentes al nuevo bloque de memoria.
+				if (OldDistances[i] != 0)
+				{
+					InsertUnique(KeyHasher(OldData[i].Key), std::move(OldData[i]));
+					OldData[i].~Pair();
+				}
+			}
+			FreeSlots(OldData, OldCapacity);
+		}
+
+		/**
+		 * @brief Garantiza espacio para un par ms sin superar el factor de carga.
+		 */
+		void GrowIfNeeded()
+		{
+			if ((Size + 1) * 5 > Capacity * 4)
+			{
+				Rehash(Capacity == 0 ? MinCapacity : Capacity * 2);  ///< Redimensionar si es necesario.
 			}
-			delete[] Data;  ///< Liberar la memoria del mapa antiguo.
-			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
-			Capacity = NewCapacity;  ///< Actualizar la capacidad del mapa.
 		}
 
 	public:
+		/**
+		 * @brief Iterador sobre los pares ocupados del mapa.
+		 *
+		 * El orden de iteracin no est definido. La clave de un par no debe modificarse a travs
+		 * del iterador.
+		 */
+		template<bool bConst>
+		class TIterator
+		{
+		public:
+			using MapType = typename std::conditional<bConst, const TMap, TMap>::type;
+			using PairType = typename std::conditional<bConst, const Pair, Pair>::type;
+
+			TIterator(MapType* InMap, size_t InIndex) : Map(InMap), Index(InIndex)
+			{
+				SkipEmpty();
+			}
+
+			PairType& operator*() const { return Map->Data[Index]; }
+			PairType* operator->() const { return &Map->Data[Index]; }
+
+			TIterator& operator++()
+			{
+				++Index;
+				SkipEmpty();
+				return *this;
+			}
+
+			bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+			bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+		private:
+			void SkipEmpty()
+			{
+				while (Index < Map->Capacity && Map->Distances[Index] == 0)
+				{
+					++Index;
+				}
+			}
+
+			MapType* Map;
+			size_t Index;
+		};
+
+		using Iterator = TIterator<false>;
+		using ConstIterator = TIterator<true>;
+
 		/**
 		 * @brief Constructor por defecto que inicializa el mapa con capacidad y tamao cero.
+		 *
+		 * @param InHasher Functor de hash a utilizar.
+		 */
+		explicit TMap(const Hasher& InHasher = Hasher())
+			: Data(nullptr), Distances(nullptr), Capacity(0), Size(0), KeyHasher(InHasher)
+		{
+		}
+
+		/**
+		 * @brief Constructor que usa una poltica de asignacin concreta (por ejemplo una arena).
+		 *
+		 * @param InAllocator La poltica de asignacin a usar.
+		 * @param InHasher Functor de hash a utilizar.
 		 */
-		TMap()
-			: Data(nullptr), Capacity(0), Size(0)
+		explicit TMap(const Allocator& InAllocator, const Hasher& InHasher = Hasher())
+			: Data(nullptr), Distances(nullptr), Capacity(0), Size(0), KeyHasher(InHasher), Alloc(InAllocator)
 		{
 		}
 
+		/**
+		 * @brief Constructor de copia. Copia las ranuras conservando su distribucin.
+		 */
+		TMap(const TMap& Other)
+			: Data(nullptr), Distances(nullptr), Capacity(0), Size(0), KeyHasher(Other.KeyHasher),
+			  Alloc(Other.Alloc)
+		{
+			if (Other.Size == 0)
+			{
+				return;
+			}
+			AllocateSlots(Other.Capacity);
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				if (Other.Distances[i] != 0)
+				{
+					::new (static_cast<void*>(&Data[i])) Pair(Other.Data[i]);
+					Distances[i] = Other.Distances[i];
+					++Size;
+				}
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento. Toma las ranuras del otro mapa sin copiarlas.
+		 */
+		TMap(TMap&& Other) noexcept
+			: Data(Other.Data), Distances(Other.Distances), Capacity(Other.Capacity), Size(Other.Size),
+			  KeyHasher(std::move(Other.KeyHasher)), Alloc(Other.Alloc)
+		{
+			Other.Data = nullptr;
+			Other.Distances = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin (copia o movimiento).
+		 */
+		TMap& operator=(TMap Other) noexcept
+		{
+			std::swap(Data, Other.Data);
+			std::swap(Distances, Other.Distances);
+			std::swap(Capacity, Other.Capacity);
+			std::swap(Size, Other.Size);
+			std::swap(KeyHasher, Other.KeyHasher);
+			std::swap(Alloc, Other.Alloc);
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al mapa.
 		 */
 		~TMap()
 		{
-			delete[] Data;  ///< Liberar la memoria del mapa.
+			DestroyPairs();
+			FreeSlots(Data, Capacity);  ///< Liberar la memoria del mapa.
 		}
 
 		/**
 		 * @brief Aade un nuevo par clave-valor al mapa.
 		 *
+		 * Si la clave ya existe, se sobrescribe su valor.
+		 *
 		 * @param Key La clave del nuevo par.
 		 * @param Value El valor del nuevo par.
+		 * @return Referencia al valor almacenado.
 		 */
-		void Add(const K& Key, const V& Value)
+		V& Add(const K& Key, const V& Value)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			size_t Hash = KeyHasher(Key);
+			size_t Index = FindIndex(Key, Hash);
+			if (Index != InvalidIndex)
 			{
-				if (Data[i].Key == Key)
-				{
-					Data[i].Value = Value;  ///< Actualizar el valor si la clave ya existe.
-					return;
-				}
+				Data[Index].Value = Value;  ///< Actualizar el valor si la clave ya existe.
+				return Data[Index].Value;
+			}
+			// Key o Value pueden referirse a un elemento de este mismo mapa, as que el par se
+			// construye antes de que GrowIfNeeded reubique (y libere) las ranuras.
+			Pair Incoming(Key, Value);
+			GrowIfNeeded();
+			return Data[InsertUnique(Hash, std::move(Incoming))].Value;
+		}
+
+		/**
+		 * @brief Aade un nuevo par clave-valor al mapa moviendo la clave y el valor.
+		 *
+		 * Si la clave ya existe, se sobrescribe su valor.
+		 *
+		 * @param Key La clave del nuevo par.
+		 * @param Value El valor del nuevo par.
+		 * @return Referencia al valor almacenado.
+		 */
+		V& Add(K&& Key, V&& Value)
+		{
+			size_t Hash = KeyHasher(Key);
+			size_t Index = FindIndex(Key, Hash);
+			if (Index != InvalidIndex)
+			{
+				Data[Index].Value = std::move(Value);
+				return Data[Index].Value;
 			}
-			if (Size == Capacity)
+			Pair Incoming(std::piecewise_construct, std::move(Key), std::move(Value));  ///< Antes de crecer, como en Add.
+			GrowIfNeeded();
+			return Data[InsertUnique(Hash, std::move(Incoming))].Value;
+		}
+
+		/**
+		 * @brief Construye un valor en el mapa si la clave no existe.
+		 *
+		 * A diferencia de Add, si la clave ya existe no se modifica su valor.
+		 *
+		 * @param Key La clave del par.
+		 * @param Args Argumentos para construir el valor.
+		 * @return Referencia al valor asociado con la clave (nuevo o existente).
+		 */
+		template<typename... Args>
+		V& Emplace(const K& Key, Args&&... InArgs)
+		{
+			size_t Hash = KeyHasher(Key);
+			size_t Index = FindIndex(Key, Hash);
+			if (Index != InvalidIndex)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				return Data[Index].Value;
 			}
-			Data[Size++] = Pair(Key, Value);  ///< Aadir el nuevo par y aumentar el tamao.
+			Pair Incoming(std::piecewise_construct, Key, std::forward<Args>(InArgs)...);  ///< Antes de crecer, como en Add.
+			GrowIfNeeded();
+			return Data[InsertUnique(Hash, std::move(Incoming))].Value;
 		}
 
 		/**
-		 * @brief Elimina el par clave-valor en la posicin especificada.
+		 * @brief Elimina el par con la clave especificada.
+		 *
+		 * Los pares que siguen en la misma secuencia de sondeo se desplazan una ranura hacia atrs.
 		 *
 		 * @param Key La clave del par a eliminar.
+		 * @return true si se elimin el par, false si la clave no estaba en el mapa.
 		 */
-		void Remove(const K& Key)
+		bool Remove(const K& Key)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			size_t Index = FindIndex(Key, KeyHasher(Key));
+			if (Index == InvalidIndex)
 			{
-				if (Data[i].Key == Key)
-				{
-					for (size_t j = i; j < Size - 1; ++j)
-					{
-						Data[j] = Data[j + 1];  ///< Desplazar los pares hacia la izquierda para llenar el hueco.
-					}
-					--Size;  ///< Disminuir el tamao del mapa.
-					return;
-				}
+				return false;
+			}
+			const size_t Mask = Capacity - 1;
+			Data[Index].~Pair();
+			size_t Next = (Index + 1) & Mask;
+			while (Distances[Next] > 1)
+			{
+				::new (static_cast<void*>(&Data[Index])) Pair(std::move(Data[Next]));
+				Data[Next].~Pair();
+				Distances[Index] = Distances[Next] - 1;
+				Index = Next;
+				Next = (Next + 1) & Mask;
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+			Distances[Index] = 0;
+			--Size;  ///< Disminuir el tamao del mapa.
+			return true;
+		}
+
+		/**
+		 * @brief Busca el valor asociado a una clave.
+		 *
+		 * @param Key La clave a buscar.
+		 * @return Puntero al valor, o nullptr si la clave no est en el mapa.
+		 */
+		V* Find(const K& Key)
+		{
+			size_t Index = FindIndex(Key, KeyHasher(Key));
+			return Index != InvalidIndex ? &Data[Index].Value : nullptr;
+		}
+
+		/**
+		 * @brief Versin constante de Find.
+		 */
+		const V* Find(const K& Key) const
+		{
+			size_t Index = FindIndex(Key, KeyHasher(Key));
+			return Index != InvalidIndex ? &Data[Index].Value : nullptr;
+		}
+
+		/**
+		 * @brief Copia el valor asociado a una clave si existe.
+		 *
+		 * @param Key La clave a buscar.
+		 * @param OutValue Recibe una copia del valor si la clave existe.
+		 * @return true si la clave existe, false en caso contrario.
+		 */
+		bool TryGet(const K& Key, V& OutValue) const
+		{
+			const V* Value = Find(Key);
+			if (!Value)
+			{
+				return false;
+			}
+			OutValue = *Value;
+			return true;
+		}
+
+		/**
+		 * @brief Verifica si el mapa contiene la clave especificada.
+		 *
+		 * @param Key La clave a verificar.
+		 * @return true si la clave existe, false en caso contrario.
+		 */
+		bool Contains(const K& Key) const
+		{
+			return FindIndex(Key, KeyHasher(Key)) != InvalidIndex;
 		}
 
 		/**
 		 * @brief Sobrecarga del operador [] para acceder a valores por clave.
 		 *
+		 * La clave debe existir; para consultas que pueden fallar usar Find o TryGet.
+		 *
 		 * @param Key La clave del valor a acceder.
 		 * @return Referencia al valor asociado con la clave especificada.
 		 */
 		V& operator[](const K& Key)
 		{
-			for (size_t i = 0; i < Size; ++i)
+			V* Value = Find(Key);
+			if (!Value)
 			{
-				if (Data[i].Key == Key)
-				{
-					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
-				}
+				std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+				exit(1);  ///< Salir del programa en caso de error.
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
-			exit(1);  ///< Salir del programa en caso de error.
+			return *Value;  ///< Devolver el valor si la clave se encuentra.
 		}
 
 		/**
@@ -161,15 +570,39 @@ namespace EngineUtilities {
 		 */
 		const V& operator[](const K& Key) const
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const V* Value = Find(Key);
+			if (!Value)
 			{
-				if (Data[i].Key == Key)
-				{
-					return Data[i].Value;  ///< Devolver el valor si la clave se encuentra.
-				}
+				std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
+				exit(1);  ///< Salir del programa en caso de error.
+			}
+			return *Value;  ///< Devolver el valor si la clave se encuentra.
+		}
+
+		/**
+		 * @brief Reserva ranuras suficientes para almacenar al menos Number pares sin redimensionar.
+		 *
+		 * @param Number Nmero de pares esperado.
+		 */
+		void Reserve(size_t Number)
+		{
+			size_t Needed = MinCapacity;
+			while (Number * 5 > Needed * 4)
+			{
+				Needed *= 2;
+			}
+			if (Needed > Capacity)
+			{
+				Rehash(Needed);
 			}
-			std::cerr << "Key not found" << std::endl;  ///< Manejar el caso de clave no encontrada.
-			exit(1);  ///< Salir del programa en caso de error.
+		}
+
+		/**
+		 * @brief Elimina todos los pares conservando la memoria reservada.
+		 */
+		void Empty()
+		{
+			DestroyPairs();
 		}
 
 		/**
@@ -191,6 +624,11 @@ namespace EngineUtilities {
 		{
 			return Capacity;  ///< Devolver la capacidad actual del mapa.
 		}
+
+		Iterator begin() { return Iterator(this, 0); }
+		Iterator end() { return Iterator(this, Capacity); }
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, Capacity); }
 	};
 
 	// EXAMPLE
@@ -201,12 +639,21 @@ namespace EngineUtilities {
 		TMap<int, std::string> MyMap;  ///< Crear una instancia de TMap para claves enteras y valores string.
 		MyMap.Add(1, "One");  ///< Aadir pares clave-valor al mapa.
 		MyMap.Add(2, "Two");
-		MyMap.Add(3, "Three");
+		MyMap.Emplace(3, "Three");
 
 		MyMap.Remove(2);  ///< Eliminar el par con clave 2.
 
 		std::cout << "Key 1: " << MyMap[1] << std::endl;  ///< Acceder e imprimir el valor asociado con la clave 1.
-		std::cout << "Key 3: " << MyMap[3] << std::endl;  ///< Acceder e imprimir el valor asociado con la clave 3.
+
+		if (std::string* Value = MyMap.Find(2))  ///< Find no aborta si la clave no existe.
+		{
+			std::cout << "Key 2: " << *Value << std::endl;
+		}
+
+		for (auto& Pair : MyMap)  ///< Recorrer todos los pares (orden no definido).
+		{
+			std::cout << Pair.Key << " -> " << Pair.Value << std::endl;
+		}
 
 		std::cout << "Size: " << MyMap.Num() << ", Capacity: " << MyMap.GetCapacity() << std::endl;  ///< Imprimir el tamao y la capacidad del mapa.
 
@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include "Engine Utilities/Memory/TAllocator.h"
+
+namespace EngineUtilities {
+	/**
+	 * @brief Cola circular acotada y sin bloqueos para un nico productor y un nico consumidor.
+	 *
+	 * Un hilo llama a TryPush/TryEmplace y otro a TryPop; ninguna operacin espera ni hace
+	 * bucles de reintento (wait-free). La capacidad se redondea a potencia de dos. La cabeza y la
+	 * cola estn en lneas de cach distintas, y cada lado guarda una copia local del ndice del
+	 * otro para no leer la variable atmica compartida en cada operacin.
+	 *
+	 * Usarla con ms de un productor o ms de un consumidor es un error; para eso est TMPMCQueue.
+	 *
+	 * @tparam T El tipo de los elementos de la cola.
+	 * @tparam Allocator Poltica de asignacin del buffer (ver TAllocator.h).
+	 */
+	template<typename T, typename Allocator = THeapAllocator>
+	class TSPSCQueue
+	{
+	public:
+		/**
+		 * @brief Crea la cola con capacidad para al menos InCapacity elementos.
+		 *
+		 * @param InCapacity Nmero mnimo de elementos que la cola puede contener.
+		 * @param InAllocator La poltica de asignacin a usar.
+		 */
+		explicit TSPSCQueue(size_t InCapacity, const Allocator& InAllocator = Allocator())
+			: Alloc(InAllocator)
+		{
+			Capacity = 2;
+			while (Capacity < InCapacity)
+			{
+				Capacity *= 2;
+			}
+			Mask = Capacity - 1;
+			Buffer = static_cast<T*>(Alloc.Allocate(Capacity * sizeof(T), alignof(T)));
+			Head.store(0, std::memory_order_relaxed);
+			Tail.store(0, std::memory_order_relaxed);
+			CachedHead = 0;
+			CachedTail = 0;
+		}
+
+		/**
+		 * @brief Destructor que destruye los elementos pendientes y libera el buffer.
+		 */
+		~TSPSCQueue()
+		{
+			size_t Read = Head.load(std::memory_order_relaxed);
+			size_t Write = Tail.load(std::memory_order_relaxed);
+			for (; Read != Write; ++Read)
+			{
+				Buffer[Read & Mask].~T();
+			}
+			Alloc.Deallocate(Buffer, Capacity * sizeof(T), alignof(T));
+		}
+
+		TSPSCQueue(const TSPSCQueue&) = delete;
+		TSPSCQueue& operator=(const TSPSCQueue&) = delete;
+
+		/**
+		 * @brief Construye un elemento al final de la cola. Solo lo llama el productor.
+		 *
+		 * @return true si se insert, false si la cola estaba llena.
+		 */
+		template<typename... Args>
+		bool TryEmplace(Args&&... args)
+		{
+			const size_t Write = Tail.load(std::memory_order_relaxed);
+			if (Write - CachedHead == Capacity)
+			{
+				CachedHead = Head.load(std::memory_order_acquire);  ///< Refrescar la copia local solo si parece llena.
+				if (Write - CachedHead == Capacity)
+				{
+					return false;
+				}
+			}
+			::new (static_cast<void*>(&Buffer[Write & Mask])) T(std::forward<Args>(args)...);
+			Tail.store(Write + 1, std::memory_order_release);  ///< Publicar el elemento al consumidor.
+			return true;
+		}
+
+		bool TryPush(const T& Element) { return TryEmplace(Element); }
+		bool TryPush(T&& Element) { return TryEmplace(std::move(Element)); }
+
+		/**
+		 * @brief Extrae el primer elemento de la cola. Solo lo llama el consumidor.
+		 *
+		 * @param OutElement Recibe el elemento extrado.
+		 * @return true si se extrajo, false si la cola estaba vaca.
+		 */
+		bool TryPop(T& OutElement)
+		{
+			const size_t Read = Head.load(std::memory_order_relaxed);
+			if (Read == CachedTail)
+			{
+				CachedTail = Tail.load(std::memory_order_acquire);  ///< Refrescar la copia local solo si parece vaca.
+				if (Read == CachedTail)
+				{
+					return false;
+				}
+			}
+			T& Slot = Buffer[Read & Mask];
+			OutElement = std::move(Slot);
+			Slot.~T();
+			Head.store(Read + 1, std::memory_order_release);  ///< Devolver la ranura al productor.
+			return true;
+		}
+
+		/**
+		 * @brief Nmero aproximado de elementos (exacto solo si ningn otro hilo opera a la vez).
+		 */
+		size_t Num() const
+		{
+			return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire);
+		}
+
+		bool IsEmpty() const { return Num() == 0; }
+		size_t GetCapacity() const { return Capacity; }
+
+	private:
+		// Datos de solo lectura tras la construccin.
+		T* Buffer;
+		size_t Capacity;
+		size_t Mask;
+		Allocator Alloc;
+
+		alignas(CacheLineSize) std::atomic<size_t> Head;  ///< Prximo ndice a leer (lo escribe el consumidor).
+		size_t CachedTail;                                ///< Copia de Tail del consumidor.
+
+		alignas(CacheLineSize) std::atomic<size_t> Tail;  ///< Prximo ndice a escribir (lo escribe el productor).
+		size_t CachedHead;                                ///< Copia de Head del productor.
+
+		char Padding[CacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];  ///< Evita compartir lnea con lo que siga en memoria.
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		TSPSCQueue<int> Queue(1024);
+
+		std::thread Producer([&Queue]()
+		{
+			for (int i = 0; i < 100000; ++i)
+			{
+				while (!Queue.TryPush(i)) {}  ///< Reintentar mientras la cola est llena.
+			}
+		});
+
+		long long Sum = 0;
+		for (int Received = 0; Received < 100000;)
+		{
+			int Value;
+			if (Queue.TryPop(Value))
+			{
+				Sum += Value;
+				++Received;
+			}
+		}
+		Producer.join();
+
+		std::cout << "Sum: " << Sum << std::endl;
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
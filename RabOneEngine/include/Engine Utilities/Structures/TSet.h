@@ -27,97 +27,554 @@
  * SOFTWARE.
 */
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "THash.h"
+#include "Engine Utilities/Utilities/SIMD.h"
+#include "Engine Utilities/Memory/TAllocator.h"
 
 namespace EngineUtilities {
 	/**
-	 * @brief TSet es una clase de conjunto dinmica para almacenar elementos nicos.
+	 * @brief TSet es una tabla hash de direccionamiento abierto para almacenar elementos nicos.
 	 *
-	 * Esta implementacin de TSet proporciona una forma sencilla de almacenar y gestionar
-	 * colecciones de elementos nicos, con operaciones bsicas como agregar, eliminar y verificar la existencia de elementos.
-	 * La memoria se gestiona dinmicamente, aumentando la capacidad del conjunto segn sea necesario.
+	 * La tabla sigue el diseo de "bytes de control" (estilo SwissTable): cada ranura tiene un
+	 * byte que indica si est vaca, borrada u ocupada, y en este ltimo caso guarda 7 bits del
+	 * hash del elemento. Las ranuras se agrupan de 16 en 16 y una bsqueda compara los 16 bytes
+	 * de control de un grupo a la vez (una sola comparacin SSE2, o un bucle escalar si SSE2 no
+	 * est disponible), as que casi nunca se compara un elemento que no coincide.
 	 *
-	 * @tparam T El tipo de los elementos almacenados en el conjunto.
+	 * Adems se guarda el hash completo de cada elemento, de modo que redimensionar, Append,
+	 * Union e Intersect entre conjuntos del mismo tipo nunca vuelven a calcular hashes.
+	 *
+	 * Agregar, eliminar y buscar cuestan O(1) en promedio.
+	 *
+	 * @tparam T El tipo de los elementos almacenados en el conjunto. Debe soportar operator==.
+	 * @tparam Hasher Functor de hash para los elementos (THash<T> por defecto).
+	 * @tparam Allocator Poltica de asignacin de las ranuras (ver TAllocator.h).
 	 */
-	template<typename T>
+	template<typename T, typename Hasher = THash<T>, typename Allocator = THeapAllocator>
 	class TSet
 	{
 	private:
-		T* Data;        ///< Puntero a la memoria donde se almacenan los elementos.
-		size_t Capacity;   ///< Capacidad actual del conjunto (nmero de elementos que puede almacenar).
-		size_t Size;       ///< Nmero de elementos actualmente en el conjunto.
+		static constexpr size_t GroupWidth = 16;       ///< Ranuras por grupo (un registro SSE2).
+		static constexpr int8_t CtrlEmpty = -128;      ///< Byte de control de una ranura vaca.
+		static constexpr int8_t CtrlDeleted = -2;      ///< Byte de control de una ranura borrada.
+		static constexpr size_t InvalidIndex = ~static_cast<size_t>(0);
+		static constexpr size_t BlockAlignment = alignof(T) > alignof(size_t) ? alignof(T) : alignof(size_t);
+
+		T* Data;            ///< Ranuras del conjunto (memoria sin inicializar en las ranuras libres).
+		size_t* Hashes;     ///< Hash completo del elemento de cada ranura ocupada.
+		int8_t* Ctrl;       ///< Byte de control de cada ranura.
+		size_t Capacity;    ///< Nmero de ranuras (cero o mltiplo potencia de dos de GroupWidth).
+		size_t Size;        ///< Nmero de elementos actualmente en el conjunto.
+		size_t Deleted;     ///< Nmero de ranuras marcadas como borradas.
+		Hasher ElementHasher; ///< Functor usado para calcular el hash de los elementos.
+		Allocator Alloc;      ///< Poltica de la que se obtiene el bloque de ranuras.
+
+		static int8_t H2(size_t Hash) { return static_cast<int8_t>(Hash & 0x7F); }
+		static size_t H1(size_t Hash) { return Hash >> 7; }
+
+		/**
+		 * @brief Devuelve una mscara con un bit por cada byte de control del grupo igual a Byte.
+		 */
+		static uint32_t MatchByte(const int8_t* Group, int8_t Byte)
+		{
+#if ENGINE_SIMD_SSE2
+			__m128i Ctrls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Group));
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Ctrls, _mm_set1_epi8(Byte))));
+#else
+			uint32_t Mask = 0;
+			for (uint32_t i = 0; i < GroupWidth; ++i)
+			{
+				Mask |= static_cast<uint32_t>(Group[i] == Byte) << i;
+			}
+			return Mask;
+#endif
+		}
+
+		/**
+		 * @brief Devuelve una mscara con las ranuras libres (vacas o borradas) del grupo.
+		 */
+		static uint32_t MatchFree(const int8_t* Group)
+		{
+#if ENGINE_SIMD_SSE2
+			// Las ranuras libres son las nicas con el bit alto activo.
+			__m128i Ctrls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Group));
+			return static_cast<uint32_t>(_mm_movemask_epi8(Ctrls));
+#else
+			uint32_t Mask = 0;
+			for (uint32_t i = 0; i < GroupWidth; ++i)
+			{
+				Mask |= static_cast<uint32_t>(Group[i] < 0) << i;
+			}
+			return Mask;
+#endif
+		}
+
+		/**
+		 * @brief Calcula el tamao en bytes de cada parte del bloque de ranuras.
+		 */
+		static size_t DataBytes(size_t InCapacity)
+		{
+			size_t Bytes = InCapacity * sizeof(T);
+			return (Bytes + alignof(size_t) - 1) & ~(alignof(size_t) - 1);
+		}
+
+		static size_t BlockBytes(size_t InCapacity)
+		{
+			return DataBytes(InCapacity) + InCapacity * sizeof(size_t) + InCapacity;
+		}
 
 		/**
-		 * @brief Redimensiona el conjunto para tener una nueva capacidad.
+		 * @brief Reserva un bloque nico con las ranuras, sus hashes y sus bytes de control.
 		 *
-		 * @param NewCapacity La nueva capacidad del conjunto.
+		 * @param NewCapacity Nmero de ranuras a reservar.
+		 */
+		void AllocateSlots(size_t NewCapacity)
+		{
+			void* Block = Alloc.Allocate(BlockBytes(NewCapacity), BlockAlignment);
+			Data = static_cast<T*>(Block);
+			Hashes = reinterpret_cast<size_t*>(static_cast<char*>(Block) + DataBytes(NewCapacity));
+			Ctrl = reinterpret_cast<int8_t*>(Hashes + NewCapacity);
+			std::memset(Ctrl, CtrlEmpty, NewCapacity);
+			Capacity = NewCapacity;
+			Deleted = 0;
+		}
+
+		void FreeSlots(T* Block, size_t BlockCapacity)
+		{
+			if (Block)
+			{
+				Alloc.Deallocate(Block, BlockBytes(BlockCapacity), BlockAlignment);
+			}
+		}
+
+		/**
+		 * @brief Destruye todos los elementos sin liberar las ranuras.
 		 */
-		void Resize(size_t NewCapacity)
+		void DestroyElements()
 		{
-			T* NewData = new T[NewCapacity];  ///< Crear un nuevo bloque de memoria con la nueva capacidad.
-			for (size_t i = 0; i < Size; ++i)
+			for (size_t i = 0; i < Capacity; ++i)
 			{
-				NewData[i] = Data[i];  ///< Copiar los elementos existentes al nuevo bloque de memoria.
+				if (Ctrl[i] >= 0)
+				{
+					Data[i].~T();
+				}
 			}
-			delete[] Data;  ///< Liberar la memoria del conjunto antiguo.
-			Data = NewData; ///< Actualizar el puntero Data para que apunte al nuevo bloque de memoria.
-			Capacity = NewCapacity;  ///< Actualizar la capacidad del conjunto.
+			if (Capacity)
+			{
+				std::memset(Ctrl, CtrlEmpty, Capacity);
+			}
+			Size = 0;
+			Deleted = 0;
+		}
+
+		/**
+		 * @brief Busca la ranura que contiene el elemento.
+		 *
+		 * Los grupos se recorren con sondeo triangular, que visita todos los grupos cuando su
+		 * nmero es potencia de dos.
+		 *
+		 * @return El ndice de la ranura, o InvalidIndex si el elemento no est en el conjunto.
+		 */
+		size_t FindIndex(const T& Element, size_t Hash) const
+		{
+			if (Size == 0)
+			{
+				return InvalidIndex;
+			}
+			const size_t GroupMask = Capacity / GroupWidth - 1;
+			const int8_t Tag = H2(Hash);
+			size_t Group = H1(Hash) & GroupMask;
+			for (size_t Step = 1;; ++Step)
+			{
+				const int8_t* GroupCtrl = Ctrl + Group * GroupWidth;
+				uint32_t Candidates = MatchByte(GroupCtrl, Tag);
+				while (Candidates)
+				{
+					size_t Index = Group * GroupWidth + CountTrailingZeros(Candidates);
+					if (Hashes[Index] == Hash && Data[Index] == Element)
+					{
+						return Index;
+					}
+					Candidates &= Candidates - 1;
+				}
+				if (MatchByte(GroupCtrl, CtrlEmpty))
+				{
+					return InvalidIndex;  ///< Un grupo con ranuras vacas termina la secuencia de sondeo.
+				}
+				Group = (Group + Step) & GroupMask;
+			}
+		}
+
+		/**
+		 * @brief Busca la primera ranura libre en la secuencia de sondeo de un hash.
+		 */
+		size_t FindFreeSlot(size_t Hash) const
+		{
+			const size_t GroupMask = Capacity / GroupWidth - 1;
+			size_t Group = H1(Hash) & GroupMask;
+			for (size_t Step = 1;; ++Step)
+			{
+				uint32_t Free = MatchFree(Ctrl + Group * GroupWidth);
+				if (Free)
+				{
+					return Group * GroupWidth + CountTrailingZeros(Free);
+				}
+				Group = (Group + Step) & GroupMask;
+			}
+		}
+
+		/**
+		 * @brief Coloca un elemento que se sabe que no est en el conjunto.
+		 *
+		 * Requiere que haya al menos una ranura libre.
+		 */
+		template<typename Arg>
+		void InsertUnique(size_t Hash, Arg&& Element)
+		{
+			size_t Index = FindFreeSlot(Hash);
+			if (Ctrl[Index] == CtrlDeleted)
+			{
+				--Deleted;
+			}
+			::new (static_cast<void*>(&Data[Index])) T(std::forward<Arg>(Element));
+			Hashes[Index] = Hash;
+			Ctrl[Index] = H2(Hash);
+			++Size;
+		}
+
+		/**
+		 * @brief Redimensiona la tabla y reubica todos los elementos usando sus hashes guardados.
+		 *
+		 * @param NewCapacity La nueva capacidad.
+		 */
+		void Rehash(size_t NewCapacity)
+		{
+			T* OldData = Data;
+			size_t* OldHashes = Hashes;
+			int8_t* OldCtrl = Ctrl;
+			size_t OldCapacity = Capacity;
+
+			AllocateSlots(NewCapacity);
+			Size = 0;
+			for (size_t i = 0; i < OldCapacity; ++i)
+			{
+				if (OldCtrl[i] >= 0)
+				{
+					InsertUnique(OldHashes[i], std::move(OldData[i]));
+					OldData[i].~T();
+				}
+			}
+			FreeSlots(OldData, OldCapacity);
+		}
+
+		/**
+		 * @brief Devuelve la capacidad mnima necesaria para Number elementos (factor de carga 7/8).
+		 */
+		static size_t CapacityFor(size_t Number)
+		{
+			size_t Needed = GroupWidth;
+			while (Number * 8 > Needed * 7)
+			{
+				Needed *= 2;
+			}
+			return Needed;
+		}
+
+		/**
+		 * @brief Garantiza espacio para Count elementos ms.
+		 *
+		 * Si la tabla est llena sobre todo de ranuras borradas, se reconstruye con la misma
+		 * capacidad en lugar de crecer. Si los elementos vivos ya ocupan ms de 25/32 de las
+		 * ranuras se duplica la capacidad: reconstruir en el sitio liberara tan pocas ranuras
+		 * que, al alternar Remove y Add, casi cada Add volvera a recorrer toda la tabla.
+		 */
+		void GrowIfNeeded(size_t Count = 1)
+		{
+			if ((Size + Deleted + Count) * 8 <= Capacity * 7)
+			{
+				return;
+			}
+			size_t Needed = CapacityFor(Size + Count);
+			if (Needed <= Capacity)
+			{
+				Needed = (Size + Count) * 32 <= Capacity * 25 ? Capacity : Capacity * 2;
+			}
+			Rehash(Needed);
+		}
+
+		/**
+		 * @brief Inserta un elemento con un hash ya calculado si no existe.
+		 */
+		template<typename Arg>
+		bool AddWithHash(size_t Hash, Arg&& Element)
+		{
+			if (FindIndex(Element, Hash) != InvalidIndex)
+			{
+				return false;  ///< No aadir duplicados.
+			}
+			GrowIfNeeded();
+			InsertUnique(Hash, std::forward<Arg>(Element));
+			return true;
 		}
 
 	public:
+		/**
+		 * @brief Iterador sobre los elementos del conjunto. El orden de iteracin no est definido.
+		 */
+		class ConstIterator
+		{
+		public:
+			ConstIterator(const TSet* InSet, size_t InIndex) : Set(InSet), Index(InIndex)
+			{
+				SkipFree();
+			}
+
+			const T& operator*() const { return Set->Data[Index]; }
+			const T* operator->() const { return &Set->Data[Index]; }
+
+			ConstIterator& operator++()
+			{
+				++Index;
+				SkipFree();
+				return *this;
+			}
+
+			bool operator==(const ConstIterator& Other) const { return Index == Other.Index; }
+			bool operator!=(const ConstIterator& Other) const { return Index != Other.Index; }
+
+		private:
+			void SkipFree()
+			{
+				while (Index < Set->Capacity && Set->Ctrl[Index] < 0)
+				{
+					++Index;
+				}
+			}
+
+			const TSet* Set;
+			size_t Index;
+		};
+
 		/**
 		 * @brief Constructor por defecto que inicializa el conjunto con capacidad y tamao cero.
+		 *
+		 * @param InHasher Functor de hash a utilizar.
+		 */
+		explicit TSet(const Hasher& InHasher = Hasher())
+			: Data(nullptr), Hashes(nullptr), Ctrl(nullptr), Capacity(0), Size(0), Deleted(0),
+			  ElementHasher(InHasher)
+		{
+		}
+
+		/**
+		 * @brief Constructor que usa una poltica de asignacin concreta (por ejemplo una arena).
+		 *
+		 * @param InAllocator La poltica de asignacin a usar.
+		 * @param InHasher Functor de hash a utilizar.
 		 */
-		TSet()
-			: Data(nullptr), Capacity(0), Size(0)
+		explicit TSet(const Allocator& InAllocator, const Hasher& InHasher = Hasher())
+			: Data(nullptr), Hashes(nullptr), Ctrl(nullptr), Capacity(0), Size(0), Deleted(0),
+			  ElementHasher(InHasher), Alloc(InAllocator)
 		{
 		}
 
+		/**
+		 * @brief Constructor de copia. Copia las ranuras conservando su distribucin.
+		 */
+		TSet(const TSet& Other)
+			: Data(nullptr), Hashes(nullptr), Ctrl(nullptr), Capacity(0), Size(0), Deleted(0),
+			  ElementHasher(Other.ElementHasher), Alloc(Other.Alloc)
+		{
+			if (Other.Size == 0)
+			{
+				return;
+			}
+			AllocateSlots(Other.Capacity);
+			for (size_t i = 0; i < Capacity; ++i)
+			{
+				if (Other.Ctrl[i] >= 0)
+				{
+					::new (static_cast<void*>(&Data[i])) T(Other.Data[i]);
+					Hashes[i] = Other.Hashes[i];
+				}
+			}
+			std::memcpy(Ctrl, Other.Ctrl, Capacity);
+			Size = Other.Size;
+			Deleted = Other.Deleted;
+		}
+
+		/**
+		 * @brief Constructor de movimiento. Toma las ranuras del otro conjunto sin copiarlas.
+		 */
+		TSet(TSet&& Other) noexcept
+			: Data(Other.Data), Hashes(Other.Hashes), Ctrl(Other.Ctrl), Capacity(Other.Capacity),
+			  Size(Other.Size), Deleted(Other.Deleted), ElementHasher(std::move(Other.ElementHasher)),
+			  Alloc(Other.Alloc)
+		{
+			Other.Data = nullptr;
+			Other.Hashes = nullptr;
+			Other.Ctrl = nullptr;
+			Other.Capacity = 0;
+			Other.Size = 0;
+			Other.Deleted = 0;
+		}
+
+		/**
+		 * @brief Operador de asignacin (copia o movimiento).
+		 */
+		TSet& operator=(TSet Other) noexcept
+		{
+			std::swap(Data, Other.Data);
+			std::swap(Hashes, Other.Hashes);
+			std::swap(Ctrl, Other.Ctrl);
+			std::swap(Capacity, Other.Capacity);
+			std::swap(Size, Other.Size);
+			std::swap(Deleted, Other.Deleted);
+			std::swap(ElementHasher, Other.ElementHasher);
+			std::swap(Alloc, Other.Alloc);
+			return *this;
+		}
+
 		/**
 		 * @brief Destructor que libera la memoria asignada al conjunto.
 		 */
 		~TSet()
 		{
-			delete[] Data;  ///< Liberar la memoria del conjunto.
+			DestroyElements();
+			FreeSlots(Data, Capacity);  ///< Liberar la memoria del conjunto.
 		}
 
 		/**
 		 * @brief Aade un nuevo elemento al conjunto.
 		 *
 		 * @param Element El elemento a aadir.
+		 * @return true si se aadi, false si el elemento ya exista.
+		 */
+		bool Add(const T& Element)
+		{
+			return AddWithHash(ElementHasher(Element), Element);
+		}
+
+		/**
+		 * @brief Aade un nuevo elemento al conjunto movindolo.
+		 *
+		 * @param Element El elemento a aadir.
+		 * @return true si se aadi, false si el elemento ya exista.
+		 */
+		bool Add(T&& Element)
+		{
+			size_t Hash = ElementHasher(Element);
+			return AddWithHash(Hash, std::move(Element));
+		}
+
+		/**
+		 * @brief Aade varios elementos reservando espacio una sola vez.
+		 *
+		 * @param Elements Puntero al primer elemento.
+		 * @param Count Nmero de elementos.
+		 */
+		void Append(const T* Elements, size_t Count)
+		{
+			Reserve(Size + Count);
+			for (size_t i = 0; i < Count; ++i)
+			{
+				AddWithHash(ElementHasher(Elements[i]), Elements[i]);
+			}
+		}
+
+		/**
+		 * @brief Aade todos los elementos de otro conjunto reutilizando sus hashes guardados.
+		 *
+		 * @param Other El conjunto cuyos elementos se aaden.
 		 */
-		void Add(const T& Element)
+		void Append(const TSet& Other)
 		{
-			if (Contains(Element))
+			if (&Other == this)
 			{
-				return;  ///< No aadir duplicados.
+				return;
 			}
-			if (Size == Capacity)
+			Reserve(Size + Other.Size);
+			for (size_t i = 0; i < Other.Capacity; ++i)
 			{
-				Resize(Capacity == 0 ? 1 : Capacity * 2);  ///< Redimensionar si es necesario.
+				if (Other.Ctrl[i] >= 0)
+				{
+					AddWithHash(Other.Hashes[i], Other.Data[i]);
+				}
 			}
-			Data[Size++] = Element;  ///< Aadir el nuevo elemento y aumentar el tamao.
 		}
 
 		/**
-		 * @brief Elimina el elemento especificado del conjunto.
+		 * @brief Devuelve la unin de este conjunto con otro.
 		 *
-		 * @param Element El elemento a eliminar.
+		 * @param Other El otro conjunto.
+		 * @return Un conjunto con los elementos que estn en cualquiera de los dos.
+		 */
+		TSet Union(const TSet& Other) const
+		{
+			const TSet& Larger = Size >= Other.Size ? *this : Other;
+			const TSet& Smaller = Size >= Other.Size ? Other : *this;
+			TSet Result(Larger);
+			Result.Append(Smaller);
+			return Result;
+		}
+
+		/**
+		 * @brief Devuelve la interseccin de este conjunto con otro.
+		 *
+		 * Recorre el conjunto ms pequeo y busca en el ms grande con los hashes guardados.
+		 *
+		 * @param Other El otro conjunto.
+		 * @return Un conjunto con los elementos que estn en ambos.
 		 */
-		void Remove(const T& Element)
+		TSet Intersect(const TSet& Other) const
 		{
-			for (size_t i = 0; i < Size; ++i)
+			const TSet& Larger = Size >= Other.Size ? *this : Other;
+			const TSet& Smaller = Size >= Other.Size ? Other : *this;
+			TSet Result(Alloc, ElementHasher);
+			Result.Reserve(Smaller.Size);
+			for (size_t i = 0; i < Smaller.Capacity; ++i)
 			{
-				if (Data[i] == Element)
+				if (Smaller.Ctrl[i] >= 0 && Larger.FindIndex(Smaller.Data[i], Smaller.Hashes[i]) != InvalidIndex)
 				{
-					for (size_t j = i; j < Size - 1; ++j)
-					{
-						Data[j] = Data[j + 1];  ///< Desplazar los elementos hacia la izquierda para llenar el hueco.
-					}
-					--Size;  ///< Disminuir el tamao del conjunto.
-					return;
+					Result.InsertUnique(Smaller.Hashes[i], Smaller.Data[i]);
 				}
 			}
-			std::cerr << "Element not found" << std::endl;  ///< Manejar el caso de elemento no encontrado.
+			return Result;
+		}
+
+		/**
+		 * @brief Elimina el elemento especificado del conjunto.
+		 *
+		 * @param Element El elemento a eliminar.
+		 * @return true si se elimin, false si el elemento no estaba en el conjunto.
+		 */
+		bool Remove(const T& Element)
+		{
+			size_t Index = FindIndex(Element, ElementHasher(Element));
+			if (Index == InvalidIndex)
+			{
+				return false;
+			}
+			Data[Index].~T();
+			// Si el grupo ya tiene ranuras vacas ninguna secuencia de sondeo pasa por l,
+			// as que la ranura puede quedar vaca en lugar de borrada.
+			const int8_t* GroupCtrl = Ctrl + (Index & ~(GroupWidth - 1));
+			if (MatchByte(GroupCtrl, CtrlEmpty))
+			{
+				Ctrl[Index] = CtrlEmpty;
+			}
+			else
+			{
+				Ctrl[Index] = CtrlDeleted;
+				++Deleted;
+			}
+			--Size;  ///< Disminuir el tamao del conjunto.
+			return true;
 		}
 
 		/**
@@ -129,14 +586,29 @@ namespace EngineUtilities {
 		 */
 		bool Contains(const T& Element) const
 		{
-			for (size_t i = 0; i < Size; ++i)
+			return FindIndex(Element, ElementHasher(Element)) != InvalidIndex;
+		}
+
+		/**
+		 * @brief Reserva ranuras suficientes para almacenar al menos Number elementos sin redimensionar.
+		 *
+		 * @param Number Nmero de elementos esperado.
+		 */
+		void Reserve(size_t Number)
+		{
+			size_t Needed = CapacityFor(Number);
+			if (Needed > Capacity)
 			{
-				if (Data[i] == Element)
-				{
-					return true;  ///< Devolver true si el elemento se encuentra.
-				}
+				Rehash(Needed);
 			}
-			return false;  ///< Devolver false si el elemento no se encuentra.
+		}
+
+		/**
+		 * @brief Elimina todos los elementos conservando la memoria reservada.
+		 */
+		void Empty()
+		{
+			DestroyElements();
 		}
 
 		/**
@@ -158,6 +630,9 @@ namespace EngineUtilities {
 		{
 			return Capacity;  ///< Devolver la capacidad actual del conjunto.
 		}
+
+		ConstIterator begin() const { return ConstIterator(this, 0); }
+		ConstIterator end() const { return ConstIterator(this, Capacity); }
 	};
 
 	// Example
@@ -175,6 +650,21 @@ namespace EngineUtilities {
 		std::cout << "Contains 1: " << MySet.Contains(1) << std::endl;  ///< Verificar e imprimir si el conjunto contiene el elemento 1.
 		std::cout << "Contains 2: " << MySet.Contains(2) << std::endl;  ///< Verificar e imprimir si el conjunto contiene el elemento 2.
 
+		int More[] = { 3, 4, 5 };
+		MySet.Append(More, 3);  ///< Aadir varios elementos reservando espacio una sola vez.
+
+		TSet<int> Other;
+		Other.Add(4);
+		Other.Add(9);
+		TSet<int> Both = MySet.Intersect(Other);  ///< { 4 }
+		TSet<int> All = MySet.Union(Other);       ///< { 1, 3, 4, 5, 9 }
+
+		for (int Value : All)  ///< Recorrer los elementos (orden no definido).
+		{
+			std::cout << Value << " ";
+		}
+		std::cout << std::endl;
+
 		std::cout << "Size: " << MySet.Num() << ", Capacity: " << MySet.GetCapacity() << std::endl;  ///< Imprimir el tamao y la capacidad del conjunto.
 
 		return 0;
@@ -0,0 +1,333 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+#include <utility>
+#include "TArray.h"
+#include "THash.h"
+
+namespace EngineUtilities {
+	/**
+	 * @brief Handle generacional que identifica un elemento de un TSlotMap.
+	 *
+	 * Index selecciona la ranura y Generation la "versin" de esa ranura. Cada vez que un elemento
+	 * se elimina la generacin de su ranura cambia, as que los handles antiguos dejan de ser
+	 * vlidos aunque la ranura se reutilice. Un handle construido por defecto nunca es vlido.
+	 */
+	struct SlotHandle
+	{
+		uint32_t Index = 0;       ///< Ranura del elemento.
+		uint32_t Generation = 0;  ///< Generacin de la ranura cuando se cre el handle (0 = invlido).
+
+		/**
+		 * @brief Indica si el handle se obtuvo de un TSlotMap (no si el elemento sigue vivo).
+		 */
+		bool IsValid() const { return Generation != 0; }
+
+		/**
+		 * @brief Empaqueta el handle en un entero de 64 bits (generacin en los bits altos).
+		 */
+		uint64_t ToUInt64() const { return (static_cast<uint64_t>(Generation) << 32) | Index; }
+
+		bool operator==(const SlotHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+		bool operator!=(const SlotHandle& Other) const { return !(*this == Other); }
+	};
+
+	/**
+	 * @brief Hash de SlotHandle para usarlo como clave de TMap y TSet.
+	 */
+	template<>
+	struct THash<SlotHandle>
+	{
+		size_t operator()(const SlotHandle& Handle) const
+		{
+			return HashMix(static_cast<size_t>(Handle.ToUInt64()));
+		}
+	};
+
+	/**
+	 * @brief TSlotMap guarda elementos en un array denso y los identifica con handles generacionales.
+	 *
+	 * Insertar, eliminar y buscar cuestan O(1). Los elementos vivos estn siempre contiguos en
+	 * memoria, de modo que recorrerlos es un recorrido lineal de un array. Al eliminar, el ltimo
+	 * elemento se mueve al hueco, as que el orden de iteracin no es estable y los punteros a
+	 * elementos no sobreviven a inserciones o eliminaciones; los handles s.
+	 *
+	 * Las generaciones vivas son impares y las libres pares: una ranura puede reutilizarse
+	 * 2^31 veces antes de que un handle antiguo pueda volver a coincidir.
+	 *
+	 * @tparam T El tipo de los elementos almacenados.
+	 * @tparam Allocator Poltica de asignacin de los arrays internos (ver TAllocator.h).
+	 */
+	template<typename T, typename Allocator = THeapAllocator>
+	class TSlotMap
+	{
+	private:
+		static constexpr uint32_t InvalidIndex = ~static_cast<uint32_t>(0);
+
+		/**
+		 * @brief Ranura indirecta: apunta al elemento denso o, si est libre, a la siguiente libre.
+		 */
+		struct Slot
+		{
+			uint32_t DenseIndexOrNextFree;  ///< ndice en Values si est viva; siguiente ranura libre si no.
+			uint32_t Generation;            ///< Impar si est viva, par si est libre.
+		};
+
+		TArray<T, Allocator> Values;             ///< Elementos vivos, contiguos.
+		TArray<uint32_t, Allocator> DenseToSlot; ///< Ranura de cada elemento de Values.
+		TArray<Slot, Allocator> Slots;           ///< Tabla de ranuras indexada por SlotHandle::Index.
+		uint32_t FreeHead;                       ///< Primera ranura libre (InvalidIndex si no hay).
+
+		/**
+		 * @brief Devuelve la ranura del handle si est viva y su generacin coincide.
+		 *
+		 * Un handle con generacin par (por defecto, reconstruido con otra generacin, o la de
+		 * una ranura libre tras dar la vuelta a 0) nunca apunta a un elemento, as que se
+		 * rechaza antes de compararlo con la ranura.
+		 */
+		const Slot* ResolveSlot(SlotHandle Handle) const
+		{
+			if ((Handle.Generation & 1) == 0 || Handle.Index >= Slots.Num())
+			{
+				return nullptr;
+			}
+			const Slot& S = Slots[Handle.Index];
+			return S.Generation == Handle.Generation ? &S : nullptr;
+		}
+
+		/**
+		 * @brief Toma una ranura libre (o crea una) y la marca como viva para el elemento denso DenseIndex.
+		 */
+		SlotHandle AcquireSlot(uint32_t DenseIndex)
+		{
+			uint32_t Index = FreeHead;
+			if (Index != InvalidIndex)
+			{
+				FreeHead = Slots[Index].DenseIndexOrNextFree;
+			}
+			else
+			{
+				Index = static_cast<uint32_t>(Slots.Num());
+				Slots.Add(Slot{ 0, 0 });
+			}
+			Slot& S = Slots[Index];
+			++S.Generation;  ///< Par -> impar: la ranura pasa a estar viva.
+			S.DenseIndexOrNextFree = DenseIndex;
+			DenseToSlot.Add(Index);
+			return SlotHandle{ Index, S.Generation };
+		}
+
+	public:
+		typedef T* Iterator;
+		typedef const T* ConstIterator;
+
+		/**
+		 * @brief Constructor por defecto que crea un slot map vaco.
+		 */
+		TSlotMap() : FreeHead(InvalidIndex) {}
+
+		/**
+		 * @brief Constructor que usa una poltica de asignacin concreta.
+		 *
+		 * @param InAllocator La poltica de asignacin a usar.
+		 */
+		explicit TSlotMap(const Allocator& InAllocator)
+			: Values(InAllocator), DenseToSlot(InAllocator), Slots(InAllocator), FreeHead(InvalidIndex) {}
+
+		/**
+		 * @brief Inserta una copia del elemento.
+		 *
+		 * @return El handle del nuevo elemento.
+		 */
+		SlotHandle Insert(const T& Element)
+		{
+			return Emplace(Element);
+		}
+
+		/**
+		 * @brief Inserta el elemento movindolo.
+		 *
+		 * @return El handle del nuevo elemento.
+		 */
+		SlotHandle Insert(T&& Element)
+		{
+			return Emplace(std::move(Element));
+		}
+
+		/**
+		 * @brief Construye un elemento directamente en el slot map.
+		 *
+		 * @param Args Argumentos que se reenvan al constructor de T.
+		 * @return El handle del nuevo elemento.
+		 */
+		template<typename... Args>
+		SlotHandle Emplace(Args&&... args)
+		{
+			uint32_t DenseIndex = static_cast<uint32_t>(Values.Num());
+			Values.Emplace(std::forward<Args>(args)...);
+			return AcquireSlot(DenseIndex);
+		}
+
+		/**
+		 * @brief Elimina el elemento del handle. El ltimo elemento denso ocupa su lugar.
+		 *
+		 * @param Handle El handle del elemento a eliminar.
+		 * @return true si se elimin, false si el handle no era vlido o estaba obsoleto.
+		 */
+		bool Remove(SlotHandle Handle)
+		{
+			if (!ResolveSlot(Handle))
+			{
+				return false;
+			}
+			Slot& S = Slots[Handle.Index];
+			uint32_t DenseIndex = S.DenseIndexOrNextFree;
+			uint32_t LastIndex = static_cast<uint32_t>(Values.Num() - 1);
+			if (DenseIndex != LastIndex)
+			{
+				uint32_t MovedSlot = DenseToSlot[LastIndex];
+				Slots[MovedSlot].DenseIndexOrNextFree = DenseIndex;
+				DenseToSlot[DenseIndex] = MovedSlot;
+			}
+			Values.RemoveAtSwap(DenseIndex);
+			DenseToSlot.RemoveAtSwap(LastIndex);
+
+			++S.Generation;  ///< Impar -> par: invalida todos los handles de esta ranura.
+			S.DenseIndexOrNextFree = FreeHead;
+			FreeHead = Handle.Index;
+			return true;
+		}
+
+		/**
+		 * @brief Busca el elemento de un handle.
+		 *
+		 * @return Puntero al elemento, o nullptr si el handle es invlido u obsoleto. El puntero
+		 *         deja de ser vlido tras cualquier insercin o eliminacin.
+		 */
+		T* Find(SlotHandle Handle)
+		{
+			const Slot* S = ResolveSlot(Handle);
+			return S ? &Values[S->DenseIndexOrNextFree] : nullptr;
+		}
+
+		const T* Find(SlotHandle Handle) const
+		{
+			const Slot* S = ResolveSlot(Handle);
+			return S ? &Values[S->DenseIndexOrNextFree] : nullptr;
+		}
+
+		/**
+		 * @brief Indica si el handle apunta a un elemento vivo.
+		 */
+		bool Contains(SlotHandle Handle) const
+		{
+			return ResolveSlot(Handle) != nullptr;
+		}
+
+		/**
+		 * @brief Devuelve el handle del elemento en la posicin densa Index (0 <= Index < Num()).
+		 */
+		SlotHandle GetHandle(size_t Index) const
+		{
+			uint32_t SlotIndex = DenseToSlot[Index];
+			return SlotHandle{ SlotIndex, Slots[SlotIndex].Generation };
+		}
+
+		/**
+		 * @brief Reserva memoria para Number elementos.
+		 */
+		void Reserve(size_t Number)
+		{
+			Values.Reserve(Number);
+			DenseToSlot.Reserve(Number);
+			Slots.Reserve(Number);
+		}
+
+		/**
+		 * @brief Elimina todos los elementos. Todos los handles emitidos quedan obsoletos.
+		 */
+		void Empty()
+		{
+			while (Values.Num() > 0)
+			{
+				Remove(GetHandle(Values.Num() - 1));
+			}
+		}
+
+		/**
+		 * @brief Devuelve el nmero de elementos vivos.
+		 */
+		size_t Num() const
+		{
+			return Values.Num();
+		}
+
+		/**
+		 * @brief Devuelve un puntero al array denso de elementos vivos.
+		 */
+		T* GetData() { return Values.GetData(); }
+		const T* GetData() const { return Values.GetData(); }
+
+		Iterator begin() { return Values.begin(); }
+		Iterator end() { return Values.end(); }
+		ConstIterator begin() const { return Values.begin(); }
+		ConstIterator end() const { return Values.end(); }
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		TSlotMap<std::string> Names;
+		SlotHandle A = Names.Insert("Koro");
+		SlotHandle B = Names.Insert("Shiba");
+
+		Names.Remove(A);
+		std::cout << "A valido: " << Names.Contains(A) << std::endl;  ///< 0, el handle qued obsoleto.
+
+		SlotHandle C = Names.Insert("Rei");  ///< Reutiliza la ranura de A con otra generacin.
+		std::cout << "A == C: " << (A == C) << std::endl;  ///< 0
+
+		if (std::string* Name = Names.Find(B))
+		{
+			std::cout << *Name << std::endl;
+		}
+
+		for (const std::string& Name : Names)  ///< Recorrido lineal sobre los elementos vivos.
+		{
+			std::cout << Name << " ";
+		}
+		std::cout << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
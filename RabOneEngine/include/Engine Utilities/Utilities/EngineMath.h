@@ -27,30 +27,162 @@
  * SOFTWARE.
 */
 #pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "SIMD.h"
+
 namespace EngineUtilities {
 
   // Constantes matemticas
   constexpr float PI = 3.14159265358979323846f;
   constexpr float E = 2.71828182845904523536f;
 
+  // Raz cuadrada evaluable en tiempo de compilacin
+  /**
+   * Calcula la raz cuadrada con el mtodo de Newton en doble precisin.
+   * sqrt() la usa cuando se evala dentro de una expresin constante.
+   * @param value Valor.
+   * @return Raz cuadrada redondeada a float; 0 para valores negativos o NaN.
+   */
+  constexpr float constexprSqrt(float value) {
+    if (!(value > 0.0f)) {
+      return 0.0f;
+    }
+    if (value > 3.40282347e+38f) {
+      return value;
+    }
+    double x = static_cast<double>(value);
+    // Desde un valor inicial mayor que la raz, Newton decrece hasta converger.
+    double y = x > 1.0 ? x : 1.0;
+    while (true) {
+      double next = 0.5 * (y + x / y);
+      if (next >= y) {
+        break;
+      }
+      y = next;
+    }
+    return static_cast<float>(y);
+  }
+
 	/**
-		 * @brief Computes the square root using the Newton-Raphson method.
+		 * @brief Computes the square root with the hardware instruction (sqrtss).
+		 *
+		 * The result is correctly rounded. Negative input returns 0, as before.
+		 * Inside constant expressions it evaluates constexprSqrt instead.
 		 *
 		 * @param value The value to compute the square root of.
 		 * @return The computed square root.
 		 */
-	inline float sqrt(float value) {
-		if (value < 0) {
-			return 0; // Handle negative input gracefully.
+	constexpr float sqrt(float value) {
+		if (!ENGINE_CONSTANT_EVALUATED()) {
+#if ENGINE_SIMD_SSE2
+			return _mm_cvtss_f32(_mm_sqrt_ss(_mm_max_ss(_mm_set_ss(value), _mm_setzero_ps())));
+#else
+			return value > 0.0f ? std::sqrt(value) : 0.0f;
+#endif
 		}
-		float x = value;
-		float y = 1.0f;
-		float epsilon = 0.00001f; // Desired precision.
-		while (x - y > epsilon) {
-			x = (x + y) / 2.0f;
-			y = value / x;
+		return constexprSqrt(value);
+	}
+
+	/**
+		 * @brief Computes 1 / sqrt(value).
+		 *
+		 * Refines the 12-bit rsqrtss estimate with one Newton-Raphson step,
+		 * y' = y * (1.5 - 0.5 * value * y * y), giving a relative error below 5e-7.
+		 * The value must be positive and finite: 0 yields NaN instead of infinity.
+		 *
+		 * @param value The value to compute the reciprocal square root of.
+		 * @return The approximate reciprocal square root.
+		 */
+	inline float rsqrt(float value) {
+#if ENGINE_SIMD_SSE2
+		__m128 x = _mm_set_ss(value);
+		__m128 y = _mm_rsqrt_ss(x);
+		__m128 halfXYY = _mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), x), _mm_mul_ss(y, y));
+		return _mm_cvtss_f32(_mm_mul_ss(y, _mm_sub_ss(_mm_set_ss(1.5f), halfXYY)));
+#else
+		return 1.0f / std::sqrt(value);
+#endif
+	}
+
+#if ENGINE_SIMD_SSE2
+	/**
+		 * @brief Four-wide rsqrt: rsqrtps estimate plus one Newton-Raphson step.
+		 */
+	inline __m128 rsqrt4(__m128 x) {
+		__m128 y = _mm_rsqrt_ps(x);
+		__m128 halfXYY = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(y, y));
+		return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), halfXYY));
+	}
+#endif
+
+#if ENGINE_SIMD_AVX2
+	/**
+		 * @brief Eight-wide rsqrt: vrsqrtps estimate plus one Newton-Raphson step.
+		 */
+	inline __m256 rsqrt8(__m256 x) {
+		__m256 y = _mm256_rsqrt_ps(x);
+		__m256 halfXYY = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), _mm256_mul_ps(y, y));
+		return _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), halfXYY));
+	}
+#endif
+
+	/**
+		 * @brief Computes the square root of every element of an array.
+		 *
+		 * Uses 8-wide AVX2 and 4-wide SSE blocks, then scalar code for the tail.
+		 * Input and output may be the same array.
+		 *
+		 * @param values The input values.
+		 * @param results Receives sqrt(values[i]); negative inputs give 0.
+		 * @param count Number of elements.
+		 */
+	inline void sqrt(const float* values, float* results, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8) {
+			__m256 x = _mm256_max_ps(_mm256_loadu_ps(values + i), _mm256_setzero_ps());
+			_mm256_storeu_ps(results + i, _mm256_sqrt_ps(x));
+		}
+#endif
+#if ENGINE_SIMD_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_max_ps(_mm_loadu_ps(values + i), _mm_setzero_ps());
+			_mm_storeu_ps(results + i, _mm_sqrt_ps(x));
+		}
+#endif
+		for (; i < count; ++i) {
+			results[i] = sqrt(values[i]);
+		}
+	}
+
+	/**
+		 * @brief Computes 1 / sqrt of every element of an array.
+		 *
+		 * Same accuracy and domain as the scalar rsqrt. Input and output may be
+		 * the same array.
+		 *
+		 * @param values The input values (positive and finite).
+		 * @param results Receives rsqrt(values[i]).
+		 * @param count Number of elements.
+		 */
+	inline void rsqrt(const float* values, float* results, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8) {
+			_mm256_storeu_ps(results + i, rsqrt8(_mm256_loadu_ps(values + i)));
+		}
+#endif
+#if ENGINE_SIMD_SSE2
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(results + i, rsqrt4(_mm_loadu_ps(values + i)));
+		}
+#endif
+		for (; i < count; ++i) {
+			results[i] = rsqrt(values[i]);
 		}
-		return x;
 	}
 
   /**
@@ -59,7 +191,7 @@ namespace EngineUtilities {
    * @param value El valor del cual se desea calcular el cuadrado.
    * @return El cuadrado del valor dado.
    */
-  inline float square(float value) {
+  constexpr float square(float value) {
     return value * value;
   }
 
@@ -69,7 +201,7 @@ namespace EngineUtilities {
    * @param value El valor del cual se desea calcular el cubo.
    * @return El cubo del valor dado.
    */
-  inline float cube(float value) {
+  constexpr float cube(float value) {
     return value * value * value;
   }
 
@@ -80,7 +212,7 @@ namespace EngineUtilities {
    * @param exponent El exponente al que se eleva la base.
    * @return La base elevada al exponente.
    */
-  inline float power(float base, int exponent) {
+  constexpr float power(float base, int exponent) {
     if (exponent == 0) return 1;
     if (exponent < 0) return 1.0f / power(base, -exponent);
     float result = 1;
@@ -98,7 +230,7 @@ namespace EngineUtilities {
    * @param value El valor del cual se desea calcular el valor absoluto.
    * @return El valor absoluto del valor dado.
    */
-  inline float abs(float value) {
+  constexpr float abs(float value) {
     return (value < 0) ? -value : value;
   }
 
@@ -109,7 +241,7 @@ namespace EngineUtilities {
    * @param b El segundo valor.
    * @return El mayor de los dos valores dados.
    */
-  inline float EMax(float a, float b) {
+  constexpr float EMax(float a, float b) {
     return (a > b) ? a : b;
   }
 
@@ -120,7 +252,7 @@ namespace EngineUtilities {
    * @param b El segundo valor.
    * @return El menor de los dos valores dados.
    */
-  inline float EMin(float a, float b) {
+  constexpr float EMin(float a, float b) {
     return (a < b) ? a : b;
   }
 
@@ -130,7 +262,7 @@ namespace EngineUtilities {
    * @param value El valor que se desea redondear.
    * @return El valor redondeado al entero ms cercano.
    */
-  inline float round(float value) {
+  constexpr float round(float value) {
     return (value > 0) ? static_cast<int>(value + 0.5f) : static_cast<int>(value - 0.5f);
   }
 
@@ -140,7 +272,7 @@ namespace EngineUtilities {
    * @param value El valor que se desea truncar.
    * @return La parte entera del valor dado, redondeada hacia abajo.
    */
-  inline float floor(float value) {
+  constexpr float floor(float value) {
     int intValue = static_cast<int>(value);
     return (value < intValue) ? intValue - 1 : intValue;
   }
@@ -151,7 +283,7 @@ namespace EngineUtilities {
    * @param value El valor que se desea redondear hacia arriba.
    * @return El valor redondeado hacia arriba al entero ms cercano.
    */
-  inline float ceil(float value) {
+  constexpr float ceil(float value) {
     int intValue = static_cast<int>(value);
     return (value > intValue) ? intValue + 1 : intValue;
   }
@@ -161,170 +293,553 @@ namespace EngineUtilities {
    * @param value Valor flotante.
    * @return Valor absoluto del nmero flotante.
    */
-  inline float fabs(float value) {
+  constexpr float fabs(float value) {
     return value < 0.0f ? -value : value;
   }
 
+  // Utilidades de bits para las funciones trascendentales
+  /**
+   * Reinterpreta los bits de un flotante como un entero sin signo.
+   * @param value Valor flotante.
+   * @return Patrn de bits IEEE-754 del valor.
+   */
+  inline uint32_t floatAsBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  /**
+   * Reinterpreta un patrn de bits IEEE-754 como flotante.
+   * @param bits Patrn de bits.
+   * @return Valor flotante correspondiente.
+   */
+  inline float bitsAsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * Selecciona entre dos valores sin saltos, mediante una mscara de bits.
+   * @param condition Condicin de seleccin.
+   * @param a Valor devuelto si la condicin es verdadera.
+   * @param b Valor devuelto si la condicin es falsa.
+   * @return a o b segn la condicin.
+   */
+  inline float selectFloat(bool condition, float a, float b) {
+    uint32_t mask = 0u - static_cast<uint32_t>(condition);
+    return bitsAsFloat((floatAsBits(a) & mask) | (floatAsBits(b) & ~mask));
+  }
+
+  /**
+   * Versin de selectFloat para dobles.
+   * @param condition Condicin de seleccin.
+   * @param a Valor devuelto si la condicin es verdadera.
+   * @param b Valor devuelto si la condicin es falsa.
+   * @return a o b segn la condicin.
+   */
+  inline double selectDouble(bool condition, double a, double b) {
+    uint64_t bitsA, bitsB;
+    std::memcpy(&bitsA, &a, sizeof(bitsA));
+    std::memcpy(&bitsB, &b, sizeof(bitsB));
+    uint64_t mask = 0ull - static_cast<uint64_t>(condition);
+    uint64_t bits = (bitsA & mask) | (bitsB & ~mask);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * Copia el signo de un valor sobre la magnitud de otro.
+   * @param magnitude Valor del que se toma la magnitud.
+   * @param sign Valor del que se toma el signo.
+   * @return |magnitude| con el signo de sign.
+   */
+  inline float copySign(float magnitude, float sign) {
+    return bitsAsFloat((floatAsBits(magnitude) & 0x7FFFFFFFu) |
+                       (floatAsBits(sign) & 0x80000000u));
+  }
+
+  // Constantes internas de reduccin de rango (Cody-Waite)
+  namespace MathConstants {
+    // 1.5 * 2^23: sumarlo redondea al entero ms cercano y deja el entero
+    // en los bits bajos de la mantisa.
+    constexpr float RoundingMagic = 12582912.0f;
+    constexpr float TwoOverPi = 0.636619772367581343f;
+    constexpr float HalfPi = 1.57079632679489661923f;
+    constexpr float QuarterPi = 0.78539816339744830962f;
+    // PI/2 dividido en dos partes en doble precisin; la primera tiene 33
+    // bits de mantisa para que n * parte sea exacto con |n| < 2^20.
+    constexpr double HalfPiHi = 1.57079632673412561417e+00;
+    constexpr double HalfPiLo = 6.07710050650619224932e-11;
+    constexpr float Log2E = 1.44269504088896341f;
+    // ln(2) dividido en dos partes, con la misma idea.
+    constexpr float Ln2Hi = 0.693359375f;
+    constexpr float Ln2Lo = -2.12194440e-4f;
+    constexpr float ExpMaxInput = 88.7228317f;
+    constexpr float ExpMinInput = -87.3365479f;
+    constexpr float MinNormal = 1.17549435e-38f;
+  }
+
+  // Seno y coseno evaluables en tiempo de compilacin
+  /**
+   * Evala sin(r) o cos(r) con la serie de Taylor en doble precisin, para |r| <= PI/4.
+   * @param r ngulo reducido.
+   * @param cosine Verdadero para el coseno.
+   * @return sin(r) o cos(r).
+   */
+  constexpr double constexprSinCosKernel(double r, bool cosine) {
+    double r2 = r * r;
+    double term = cosine ? 1.0 : r;
+    double sum = term;
+    // Con |r| <= PI/4, el trmino 20 ya es menor que 1e-20.
+    for (int i = cosine ? 1 : 2; i < 20; i += 2) {
+      term *= -r2 / static_cast<double>(i * (i + 1));
+      sum += term;
+    }
+    return sum;
+  }
+
+  /**
+   * Seno evaluable en tiempo de compilacin, pensado para generar tablas.
+   *
+   * Usa la misma reduccin de rango que sincos() y una serie en doble precisin,
+   * por lo que el resultado queda correctamente redondeado para |angle| <= 1e6.
+   * En tiempo de ejecucin es mucho ms lento que sin().
+   * @param angle ngulo en radianes.
+   * @return Seno del ngulo.
+   */
+  constexpr float constexprSin(float angle) {
+    using namespace MathConstants;
+    double x = static_cast<double>(angle);
+    double q = x * 0.63661977236758134308;
+    long long n = static_cast<long long>(q < 0.0 ? q - 0.5 : q + 0.5);
+    double r = (x - static_cast<double>(n) * HalfPiHi) - static_cast<double>(n) * HalfPiLo;
+    switch (n & 3) {
+      case 0: return static_cast<float>(constexprSinCosKernel(r, false));
+      case 1: return static_cast<float>(constexprSinCosKernel(r, true));
+      case 2: return static_cast<float>(-constexprSinCosKernel(r, false));
+      default: return static_cast<float>(-constexprSinCosKernel(r, true));
+    }
+  }
+
+  /**
+   * Coseno evaluable en tiempo de compilacin, pensado para generar tablas.
+   * @param angle ngulo en radianes.
+   * @return Coseno del ngulo.
+   */
+  constexpr float constexprCos(float angle) {
+    using namespace MathConstants;
+    double x = static_cast<double>(angle);
+    double q = x * 0.63661977236758134308;
+    long long n = static_cast<long long>(q < 0.0 ? q - 0.5 : q + 0.5);
+    double r = (x - static_cast<double>(n) * HalfPiHi) - static_cast<double>(n) * HalfPiLo;
+    switch (n & 3) {
+      case 0: return static_cast<float>(constexprSinCosKernel(r, true));
+      case 1: return static_cast<float>(-constexprSinCosKernel(r, false));
+      case 2: return static_cast<float>(-constexprSinCosKernel(r, true));
+      default: return static_cast<float>(constexprSinCosKernel(r, false));
+    }
+  }
+
+  /**
+   * Logaritmo natural en doble precisin para expresiones constantes.
+   * Lleva x a [sqrt(2)/2, sqrt(2)] y suma la serie de atanh.
+   * @param x Valor positivo y finito.
+   * @return ln(x).
+   */
+  constexpr double constexprLogKernel(double x) {
+    int exponent = 0;
+    while (x > 1.41421356237309505) {
+      x *= 0.5;
+      ++exponent;
+    }
+    while (x < 0.70710678118654752) {
+      x *= 2.0;
+      --exponent;
+    }
+    double s = (x - 1.0) / (x + 1.0);
+    double s2 = s * s;
+    double term = s;
+    double sum = s;
+    for (int i = 3; i <= 23; i += 2) {
+      term *= s2;
+      sum += term / static_cast<double>(i);
+    }
+    return 2.0 * sum + static_cast<double>(exponent) * 6.93147180559945309e-1;
+  }
+
+  /**
+   * Exponencial en doble precisin para expresiones constantes.
+   * Separa x = n * ln(2) + r con |r| <= ln(2) / 2 y suma la serie de Taylor de e^r.
+   * @param x Exponente, dentro del rango de double.
+   * @return e^x.
+   */
+  constexpr double constexprExpKernel(double x) {
+    double q = x * 1.44269504088896341;
+    long long n = static_cast<long long>(q < 0.0 ? q - 0.5 : q + 0.5);
+    double r = x - static_cast<double>(n) * 6.93147180559945309e-1;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i <= 17; ++i) {
+      term *= r / static_cast<double>(i);
+      sum += term;
+    }
+    for (; n > 0; --n) {
+      sum *= 2.0;
+    }
+    for (; n < 0; ++n) {
+      sum *= 0.5;
+    }
+    return sum;
+  }
+
+  /**
+   * Potencia con exponente real evaluable en tiempo de compilacin, pensada para
+   * generar tablas (por ejemplo, las curvas sRGB).
+   * @param base Base no negativa.
+   * @param exponent Exponente.
+   * @return base elevada a exponent; 0 si la base es 0 o negativa.
+   */
+  constexpr float constexprPow(float base, float exponent) {
+    if (!(base > 0.0f)) {
+      return 0.0f;
+    }
+    return static_cast<float>(constexprExpKernel(static_cast<double>(exponent) *
+                                                 constexprLogKernel(static_cast<double>(base))));
+  }
+
   // Funciones Trigonomtricas
+  //
+  // Todas reducen el argumento a un intervalo pequeo y evalan un polinomio
+  // minimax de grado fijo, sin bucles ni saltos dependientes de los datos.
+  // El error mximo indicado se midi contra libm en doble precisin.
+  // Las variantes fast* cambian precisin por velocidad: reduccin de rango
+  // en un solo paso y polinomios de menor grado.
+
+  /**
+   * Calcula el seno y el coseno de un ngulo con una sola reduccin de rango.
+   * Error mximo: 2 ULP para |angle| <= 1e6; la precisin se degrada ms all.
+   * @param angle ngulo en radianes.
+   * @param outSin Recibe el seno del ngulo.
+   * @param outCos Recibe el coseno del ngulo.
+   */
+  inline void sincos(float angle, float& outSin, float& outCos) {
+    using namespace MathConstants;
+    float t = angle * TwoOverPi + RoundingMagic;
+    uint32_t quadrant = floatAsBits(t);
+    float n = t - RoundingMagic;
+    float x = static_cast<float>(static_cast<double>(angle) - static_cast<double>(n) * HalfPiHi -
+                                 static_cast<double>(n) * HalfPiLo);
+    float x2 = x * x;
+    float s = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+    float c = 1.0f - 0.5f * x2 +
+              x2 * x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+    // Cuadrante: 0 -> (s, c), 1 -> (c, -s), 2 -> (-s, -c), 3 -> (-c, s)
+    bool swap = (quadrant & 1u) != 0;
+    uint32_t sinSign = ((quadrant >> 1) & 1u) << 31;
+    uint32_t cosSign = (((quadrant + 1u) >> 1) & 1u) << 31;
+    outSin = bitsAsFloat(floatAsBits(selectFloat(swap, c, s)) ^ sinSign);
+    outCos = bitsAsFloat(floatAsBits(selectFloat(swap, s, c)) ^ cosSign);
+  }
+
   /**
    * Calcula el seno de un ngulo en radianes.
+   * Error mximo: 2 ULP para |angle| <= 1e6.
    * @param angle ngulo en radianes.
    * @return Valor del seno del ngulo.
    */
   inline float sin(float angle) {
-    float result = 0.0f;
-    float term = angle;
-    float angle_squared = angle * angle;
-    int n = 1;
-    while (term > 1e-6f || term < -1e-6f) {
-      result += term;
-      term *= -angle_squared / ((2 * n) * (2 * n + 1));
-      ++n;
-    }
-    return result;
+    float s, c;
+    sincos(angle, s, c);
+    return s;
   }
 
   /**
    * Calcula el coseno de un ngulo en radianes.
+   * Error mximo: 2 ULP para |angle| <= 1e6.
    * @param angle ngulo en radianes.
    * @return Valor del coseno del ngulo.
    */
   inline float cos(float angle) {
-    return sin(angle + PI / 2);
+    float s, c;
+    sincos(angle, s, c);
+    return c;
   }
 
   /**
    * Calcula la tangente de un ngulo en radianes.
+   * Error mximo: 4 ULP para |angle| <= 1e6. Cerca de los polos devuelve
+   * valores grandes en lugar de 0.
    * @param angle ngulo en radianes.
    * @return Valor de la tangente del ngulo.
    */
   inline float tan(float angle) {
-    float s = sin(angle);
-    float c = cos(angle);
-    return c != 0.0f ? s / c : 0.0f; // Evita la divisin por cero
+    float s, c;
+    sincos(angle, s, c);
+    return s / c;
   }
 
   /**
    * Calcula el arco seno de un valor.
+   * Para |x| > 0.5 usa asin(x) = PI/2 - 2 * asin(sqrt((1 - |x|) / 2)).
+   * Error mximo: 3 ULP. Fuera de [-1, 1] devuelve NaN.
    * @param value Valor en el rango [-1, 1].
    * @return ngulo en radianes.
    */
   inline float asin(float value) {
-    // Aproximacin con la serie de Taylor
-    float x = value;
-    float result = x;
-    float term = x;
-    for (int n = 1; n < 10; ++n) {
-      term *= x * x * (2 * n - 1) / ((2 * n + 1) * (2 * n));
-      result += term;
-    }
-    return result;
+    using namespace MathConstants;
+    float a = fabs(value);
+    bool large = a > 0.5f;
+    float z = selectFloat(large, 0.5f * (1.0f - a), a * a);
+    float x = selectFloat(large, std::sqrt(z), a);
+    float p = ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z +
+                7.4953002686e-2f) * z + 1.6666752422e-1f) * z * x + x;
+    return copySign(selectFloat(large, HalfPi - 2.0f * p, p), value);
   }
 
   /**
    * Calcula el arco coseno de un valor.
+   * Error mximo: 2 ULP. Fuera de [-1, 1] devuelve NaN.
    * @param value Valor en el rango [-1, 1].
    * @return ngulo en radianes.
    */
   inline float acos(float value) {
-    return PI / 2 - asin(value);
+    using namespace MathConstants;
+    float a = fabs(value);
+    bool large = a > 0.5f;
+    float z = selectFloat(large, 0.5f * (1.0f - a), value * value);
+    float x = selectFloat(large, std::sqrt(z), value);
+    float p = ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z +
+                7.4953002686e-2f) * z + 1.6666752422e-1f) * z * x + x;
+    float largeResult = selectFloat(value < 0.0f, PI - 2.0f * p, 2.0f * p);
+    return selectFloat(large, largeResult, HalfPi - p);
   }
 
   /**
    * Calcula el arco tangente de un valor.
+   * Reduce el argumento con tan(PI/8) y tan(3PI/8) antes del polinomio. La
+   * reduccin y la suma final se hacen en doble precisin: en float, el
+   * redondeo de (a - 1) / (a + 1) y de PI/4 llegaba a casi 3 ULP.
+   * Error mximo: 1 ULP.
    * @param value Valor.
    * @return ngulo en radianes.
    */
   inline float atan(float value) {
-    // Aproximacin de la funcin arcotangente
-    float result = 0.0f;
-    float term = value;
-    for (int n = 0; n < 10; ++n) {
-      result += term / (2 * n + 1);
-      term *= -value * value;
-    }
-    return result;
+    float a = fabs(value);
+    bool big = a > 2.414213562373095f;
+    bool mid = a > 0.4142135623730950f;
+    // x = -1 / a, (a - 1) / (a + 1) o a, con una sola divisin; a +- 1 es exacto en double.
+    double wide = static_cast<double>(a);
+    double numerator = selectDouble(big, -1.0, selectDouble(mid, wide - 1.0, wide));
+    double denominator = selectDouble(big, wide, selectDouble(mid, wide + 1.0, 1.0));
+    double reduced = numerator / denominator;
+    double offset = selectDouble(big, 1.57079632679489661923, selectDouble(mid, 0.78539816339744830962, 0.0));
+    float x = static_cast<float>(reduced);
+    float z = x * x;
+    float p = (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z -
+               3.33329491539e-1f) * z * x;
+    return copySign(static_cast<float>(offset + reduced + static_cast<double>(p)), value);
   }
 
   /**
-   * Calcula el seno hiperblico de un valor.
-   * @param value Valor.
-   * @return Seno hiperblico.
+   * Calcula el arco tangente de y / x usando los signos de ambos para
+   * determinar el cuadrante.
+   * Error mximo: 4 ULP.
+   * @param y Coordenada y.
+   * @param x Coordenada x.
+   * @return ngulo en radianes en el rango [-PI, PI].
    */
-  inline float sinh(float value) {
-    return (exp(value) - exp(-value)) / 2;
+  inline float atan2(float y, float x) {
+    using namespace MathConstants;
+    float ax = fabs(x);
+    float ay = fabs(y);
+    float hi = EMax(ax, ay);
+    float ratio = selectFloat(hi == 0.0f, 0.0f, EMin(ax, ay) / hi);
+    float angle = atan(ratio);
+    angle = selectFloat(ay > ax, HalfPi - angle, angle);
+    angle = selectFloat((floatAsBits(x) >> 31) != 0, PI - angle, angle);
+    return copySign(angle, y);
   }
 
   /**
-   * Calcula el coseno hiperblico de un valor.
-   * @param value Valor.
-   * @return Coseno hiperblico.
+   * Versin rpida de sincos.
+   * Error absoluto mximo: 2e-5 para |angle| <= 100; crece con el ngulo
+   * (1e-4 hacia |angle| = 1e3).
+   * @param angle ngulo en radianes.
+   * @param outSin Recibe el seno aproximado.
+   * @param outCos Recibe el coseno aproximado.
    */
-  inline float cosh(float value) {
-    return (exp(value) + exp(-value)) / 2;
+  inline void fastSincos(float angle, float& outSin, float& outCos) {
+    using namespace MathConstants;
+    float t = angle * TwoOverPi + RoundingMagic;
+    uint32_t quadrant = floatAsBits(t);
+    float n = t - RoundingMagic;
+    float x = angle - n * HalfPi;
+    float x2 = x * x;
+    float s = x * (1.0f + x2 * (-1.6662834e-1f + x2 * 8.152992e-3f));
+    float c = 1.0f + x2 * (-4.9977631e-1f + x2 * 4.048894e-2f);
+    bool swap = (quadrant & 1u) != 0;
+    uint32_t sinSign = ((quadrant >> 1) & 1u) << 31;
+    uint32_t cosSign = (((quadrant + 1u) >> 1) & 1u) << 31;
+    outSin = bitsAsFloat(floatAsBits(selectFloat(swap, c, s)) ^ sinSign);
+    outCos = bitsAsFloat(floatAsBits(selectFloat(swap, s, c)) ^ cosSign);
   }
 
   /**
-   * Calcula la tangente hiperblica de un valor.
-   * @param value Valor.
-   * @return Tangente hiperblica.
+   * Versin rpida del seno.
+   * Error absoluto mximo: 2e-5 para |angle| <= 100.
+   * @param angle ngulo en radianes.
+   * @return Seno aproximado.
    */
-  inline float tanh(float value) {
-    return sinh(value) / cosh(value);
+  inline float fastSin(float angle) {
+    float s, c;
+    fastSincos(angle, s, c);
+    return s;
   }
 
-  // Conversin entre Radianes y Grados
   /**
-   * Convierte grados a radianes.
-   * @param degrees ngulo en grados.
-   * @return ngulo en radianes.
+   * Versin rpida del coseno.
+   * Error absoluto mximo: 2e-5 para |angle| <= 100.
+   * @param angle ngulo en radianes.
+   * @return Coseno aproximado.
    */
-  inline float radians(float degrees) {
-    return degrees * PI / 180.0f;
+  inline float fastCos(float angle) {
+    float s, c;
+    fastSincos(angle, s, c);
+    return c;
   }
 
   /**
-   * Convierte radianes a grados.
-   * @param radians ngulo en radianes.
-   * @return ngulo en grados.
+   * Versin rpida de la tangente.
+   * Error relativo mximo: 2e-5 lejos de los polos.
+   * @param angle ngulo en radianes.
+   * @return Tangente aproximada.
    */
-  inline float degrees(float radians) {
-    return radians * 180.0f / PI;
+  inline float fastTan(float angle) {
+    float s, c;
+    fastSincos(angle, s, c);
+    return s / c;
+  }
+
+  /**
+   * Versin rpida del arco seno (Abramowitz y Stegun 4.4.45).
+   * Error absoluto mximo: 7e-5.
+   * @param value Valor en el rango [-1, 1].
+   * @return ngulo aproximado en radianes.
+   */
+  inline float fastAsin(float value) {
+    using namespace MathConstants;
+    float a = fabs(value);
+    float p = std::sqrt(1.0f - a) *
+              (1.5707288f + a * (-2.121144e-1f + a * (7.42610e-2f + a * -1.87293e-2f)));
+    return copySign(HalfPi - p, value);
+  }
+
+  /**
+   * Versin rpida del arco coseno (Abramowitz y Stegun 4.4.45).
+   * Error absoluto mximo: 7e-5.
+   * @param value Valor en el rango [-1, 1].
+   * @return ngulo aproximado en radianes.
+   */
+  inline float fastAcos(float value) {
+    float a = fabs(value);
+    float p = std::sqrt(1.0f - a) *
+              (1.5707288f + a * (-2.121144e-1f + a * (7.42610e-2f + a * -1.87293e-2f)));
+    return selectFloat(value < 0.0f, PI - p, p);
+  }
+
+  /**
+   * Versin rpida del arco tangente.
+   * Error absoluto mximo: 2e-5.
+   * @param value Valor.
+   * @return ngulo aproximado en radianes.
+   */
+  inline float fastAtan(float value) {
+    using namespace MathConstants;
+    float a = fabs(value);
+    bool invert = a > 1.0f;
+    float x = selectFloat(invert, 1.0f / a, a);
+    float x2 = x * x;
+    float p = x * (9.998663e-1f + x2 * (-3.303048e-1f + x2 * (1.801593e-1f + x2 *
+              (-8.515635e-2f + x2 * 2.084511e-2f))));
+    return copySign(selectFloat(invert, HalfPi - p, p), value);
+  }
+
+  /**
+   * Versin rpida de atan2.
+   * Error absoluto mximo: 2e-5.
+   * @param y Coordenada y.
+   * @param x Coordenada x.
+   * @return ngulo aproximado en radianes en el rango [-PI, PI].
+   */
+  inline float fastAtan2(float y, float x) {
+    using namespace MathConstants;
+    float ax = fabs(x);
+    float ay = fabs(y);
+    float hi = EMax(ax, ay);
+    float ratio = selectFloat(hi == 0.0f, 0.0f, EMin(ax, ay) / hi);
+    float angle = fastAtan(ratio);
+    angle = selectFloat(ay > ax, HalfPi - angle, angle);
+    angle = selectFloat((floatAsBits(x) >> 31) != 0, PI - angle, angle);
+    return copySign(angle, y);
   }
 
   // Funciones Exponenciales y Logartmicas
   /**
    * Calcula la funcin exponencial e^x.
+   * Reduce x = n * ln(2) + r con |r| <= ln(2) / 2 y construye 2^n en el
+   * exponente. Error mximo: 1.03 ULP. Los resultados subnormales se redondean
+   * a 0 y las entradas mayores que ~88.72 devuelven infinito.
    * @param value Exponente.
    * @return Valor de e^x.
    */
   inline float exp(float value) {
-    float result = 1.0f;
-    float term = 1.0f;
-    for (int n = 1; n < 20; ++n) {
-      term *= value / n;
-      result += term;
-    }
-    return result;
+    using namespace MathConstants;
+    float x = EMin(EMax(value, ExpMinInput), ExpMaxInput);
+    float t = x * Log2E + RoundingMagic;
+    int32_t n = static_cast<int32_t>(floatAsBits(t) - floatAsBits(RoundingMagic));
+    float fn = t - RoundingMagic;
+    x = x - fn * Ln2Hi - fn * Ln2Lo;
+    float p = (((((1.9875691500e-4f * x + 1.3981999507e-3f) * x + 8.3334519073e-3f) * x +
+                 4.1665795894e-2f) * x + 1.6666665459e-1f) * x + 5.0000001201e-1f) * x * x + x + 1.0f;
+    // 2^n se aplica en dos factores para que n = 128 no desborde el exponente.
+    int32_t half = n >> 1;
+    p *= bitsAsFloat(static_cast<uint32_t>(half + 127) << 23);
+    p *= bitsAsFloat(static_cast<uint32_t>(n - half + 127) << 23);
+    p = selectFloat(value > ExpMaxInput, bitsAsFloat(0x7F800000u), p);
+    p = selectFloat(value < ExpMinInput, 0.0f, p);
+    return selectFloat(value != value, value, p);
   }
 
   /**
    * Calcula el logaritmo natural de un valor.
+   * Separa exponente y mantisa (m en [sqrt(0.5), sqrt(2))) y aproxima
+   * log(m) con un polinomio. Error mximo: 1 ULP.
    * @param value Valor.
-   * @return Logaritmo natural.
+   * @return Logaritmo natural; -infinito para 0 y NaN para valores negativos.
    */
   inline float log(float value) {
-    // Aproximacin usando la serie de Taylor
-    if (value <= 0) return 0;
-    float x = (value - 1) / (value + 1);
-    float x2 = x * x;
-    float result = 0.0f;
-    float term = x;
-    for (int n = 1; n < 20; ++n) {
-      result += term / (2 * n - 1);
-      term *= x2;
-    }
-    return 2 * result;
+    using namespace MathConstants;
+    bool subnormal = value < MinNormal;
+    uint32_t bits = floatAsBits(selectFloat(subnormal, value * 8388608.0f, value));
+    int32_t e = static_cast<int32_t>((bits >> 23) & 0xFFu) - 126 - (subnormal ? 23 : 0);
+    float m = bitsAsFloat((bits & 0x007FFFFFu) | 0x3F000000u);
+    bool below = m < 0.707106781186547524f;
+    e -= below ? 1 : 0;
+    float x = selectFloat(below, m + m - 1.0f, m - 1.0f);
+    float fe = static_cast<float>(e);
+    float z = x * x;
+    float y = ((((((((7.0376836292e-2f * x - 1.1514610310e-1f) * x + 1.1676998740e-1f) * x -
+                   1.2420140846e-1f) * x + 1.4249322787e-1f) * x - 1.6668057665e-1f) * x +
+                 2.0000714765e-1f) * x - 2.4999993993e-1f) * x + 3.3333331174e-1f) * x * z;
+    y += fe * Ln2Lo;
+    y -= 0.5f * z;
+    float result = x + y + fe * Ln2Hi;
+    result = selectFloat(value == 0.0f, bitsAsFloat(0xFF800000u), result);
+    result = selectFloat(value == bitsAsFloat(0x7F800000u), value, result);
+    return selectFloat((value < 0.0f) | (value != value), bitsAsFloat(0x7FC00000u), result);
   }
 
   /**
@@ -333,7 +848,88 @@ namespace EngineUtilities {
    * @return Logaritmo en base 10.
    */
   inline float log10(float value) {
-    return log(value) / log(10);
+    return log(value) * 0.434294481903251828f;
+  }
+
+  /**
+   * Versin rpida de e^x: polinomio de grado 4 para 2^f.
+   * Error relativo mximo: 1e-5.
+   * @param value Exponente.
+   * @return Valor aproximado de e^x.
+   */
+  inline float fastExp(float value) {
+    using namespace MathConstants;
+    float x = EMin(EMax(value * Log2E, -126.0f), 127.0f);
+    float t = x + RoundingMagic;
+    int32_t n = static_cast<int32_t>(floatAsBits(t) - floatAsBits(RoundingMagic));
+    float f = x - (t - RoundingMagic);
+    float p = 1.0f + f * (6.931242e-1f + f * (2.402410e-1f + f * (5.590642e-2f + f * 9.582853e-3f)));
+    return p * bitsAsFloat(static_cast<uint32_t>(n + 127) << 23);
+  }
+
+  /**
+   * Versin rpida del logaritmo natural. No trata 0, negativos ni
+   * subnormales.
+   * Error absoluto mximo: 2e-5.
+   * @param value Valor positivo.
+   * @return Logaritmo natural aproximado.
+   */
+  inline float fastLog(float value) {
+    uint32_t bits = floatAsBits(value);
+    int32_t e = static_cast<int32_t>(bits >> 23) - 126;
+    float m = bitsAsFloat((bits & 0x007FFFFFu) | 0x3F000000u);
+    bool below = m < 0.707106781186547524f;
+    e -= below ? 1 : 0;
+    float x = selectFloat(below, m + m - 1.0f, m - 1.0f);
+    float p = x * (9.999189e-1f + x * (-4.992336e-1f + x * (3.373451e-1f + x *
+              (-2.734988e-1f + x * 1.751307e-1f))));
+    return p + static_cast<float>(e) * 6.93147180559945309e-1f;
+  }
+
+  /**
+   * Calcula el seno hiperblico de un valor.
+   * @param value Valor.
+   * @return Seno hiperblico.
+   */
+  inline float sinh(float value) {
+    return (exp(value) - exp(-value)) / 2;
+  }
+
+  /**
+   * Calcula el coseno hiperblico de un valor.
+   * @param value Valor.
+   * @return Coseno hiperblico.
+   */
+  inline float cosh(float value) {
+    return (exp(value) + exp(-value)) / 2;
+  }
+
+  /**
+   * Calcula la tangente hiperblica de un valor.
+   * @param value Valor.
+   * @return Tangente hiperblica.
+   */
+  inline float tanh(float value) {
+    return sinh(value) / cosh(value);
+  }
+
+  // Conversin entre Radianes y Grados
+  /**
+   * Convierte grados a radianes.
+   * @param degrees ngulo en grados.
+   * @return ngulo en radianes.
+   */
+  constexpr float radians(float degrees) {
+    return degrees * PI / 180.0f;
+  }
+
+  /**
+   * Convierte radianes a grados.
+   * @param radians ngulo en radianes.
+   * @return ngulo en grados.
+   */
+  constexpr float degrees(float radians) {
+    return radians * 180.0f / PI;
   }
 
   // Operaciones de Redondeo Avanzadas
@@ -343,7 +939,7 @@ namespace EngineUtilities {
    * @param b Divisor.
    * @return Mdulo.
    */
-  inline float mod(float a, float b) {
+  constexpr float mod(float a, float b) {
     return a - b * static_cast<int>(a / b);
   }
 
@@ -353,7 +949,7 @@ namespace EngineUtilities {
    * @param radius Radio del crculo.
    * @return rea del crculo.
    */
-  inline float circleArea(float radius) {
+  constexpr float circleArea(float radius) {
     return PI * radius * radius;
   }
 
@@ -362,7 +958,7 @@ namespace EngineUtilities {
    * @param radius Radio del crculo.
    * @return Circunferencia del crculo.
    */
-  inline float circleCircumference(float radius) {
+  constexpr float circleCircumference(float radius) {
     return 2 * PI * radius;
   }
 
@@ -372,7 +968,7 @@ namespace EngineUtilities {
    * @param height Alto del rectngulo.
    * @return rea del rectngulo.
    */
-  inline float rectangleArea(float width, float height) {
+  constexpr float rectangleArea(float width, float height) {
     return width * height;
   }
 
@@ -382,7 +978,7 @@ namespace EngineUtilities {
    * @param height Alto del rectngulo.
    * @return Permetro del rectngulo.
    */
-  inline float rectanglePerimeter(float width, float height) {
+  constexpr float rectanglePerimeter(float width, float height) {
     return 2 * (width + height);
   }
 
@@ -392,7 +988,7 @@ namespace EngineUtilities {
    * @param height Altura del tringulo.
    * @return rea del tringulo.
    */
-  inline float triangleArea(float base, float height) {
+  constexpr float triangleArea(float base, float height) {
     return 0.5f * base * height;
   }
 
@@ -404,7 +1000,7 @@ namespace EngineUtilities {
    * @param y2 Coordenada y del segundo punto.
    * @return Distancia entre los dos puntos.
    */
-  inline float distance(float x1, float y1, float x2, float y2) {
+  constexpr float distance(float x1, float y1, float x2, float y2) {
     float dx = x2 - x1;
     float dy = y2 - y1;
     return sqrt(dx * dx + dy * dy);
@@ -418,7 +1014,7 @@ namespace EngineUtilities {
    * @param t Parmetro de interpolacin entre 0 y 1.
    * @return Valor interpolado.
    */
-  inline float lerp(float a, float b, float t) {
+  constexpr float lerp(float a, float b, float t) {
     return a + t * (b - a);
   }
 
@@ -427,7 +1023,7 @@ namespace EngineUtilities {
    * @param n Nmero entero no negativo.
    * @return Factorial de n.
    */
-  inline int factorial(int n) {
+  constexpr int factorial(int n) {
     int result = 1;
     for (int i = 2; i <= n; ++i) {
       result *= i;
@@ -442,7 +1038,7 @@ namespace EngineUtilities {
    * @param epsilon Margen de error.
    * @return Verdadero si los valores son aproximadamente iguales.
    */
-  inline bool approxEqual(float a, float b, float epsilon) {
+  constexpr bool approxEqual(float a, float b, float epsilon) {
     return fabs(a - b) < epsilon;
   }
 
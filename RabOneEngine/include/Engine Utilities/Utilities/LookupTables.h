@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+#include "EngineMath.h"
+
+/**
+ * @file LookupTables.h
+ * @brief Lookup tables built at compile time from the constexpr math functions.
+ *
+ * The tables are inline constexpr variables, so they are generated by the compiler
+ * and live in read-only data; nothing runs at startup. Hot paths can index the
+ * tables directly or use the small accessors below instead of calling sin, cos or pow.
+ * Only translation units that include this header pay for generating them.
+ */
+
+namespace EngineUtilities {
+  /**
+   * @brief Number of sin samples per full turn; a power of two so indices wrap with a mask.
+   */
+  constexpr int SinTableSize = 1024;
+
+  /**
+   * @brief sin(2 * PI * i / SinTableSize) for i in [0, SinTableSize].
+   *
+   * The extra last entry repeats the first one so interpolation never wraps.
+   * cos(2 * PI * i / SinTableSize) is values[(i + SinTableSize / 4) & (SinTableSize - 1)].
+   */
+  struct SinTable {
+    float values[SinTableSize + 1];
+  };
+
+  /**
+   * @brief Builds SinTable from one quarter wave and its symmetries.
+   */
+  constexpr SinTable makeSinTable() {
+    SinTable table{};
+    constexpr int quarter = SinTableSize / 4;
+    constexpr int half = SinTableSize / 2;
+    for (int i = 0; i <= quarter; ++i) {
+      table.values[i] = constexprSin(static_cast<float>(2.0 * 3.14159265358979323846 * i / SinTableSize));
+    }
+    for (int i = quarter + 1; i <= half; ++i) {
+      table.values[i] = table.values[half - i];
+    }
+    for (int i = half + 1; i <= SinTableSize; ++i) {
+      table.values[i] = -table.values[i - half];
+    }
+    return table;
+  }
+
+  inline constexpr SinTable SinTableData = makeSinTable();
+
+  /**
+   * @brief Sine from the table with linear interpolation.
+   *
+   * The absolute error is below 5e-6 for |angle| <= 2 * PI and 1e-5 up to 100;
+   * past that it grows with |angle| as the float index loses fractional bits.
+   * Use sin() when more accuracy is needed; this costs one multiply, two loads
+   * and a lerp.
+   *
+   * @param angle Angle in radians.
+   * @return The interpolated sine.
+   */
+  constexpr float tableSin(float angle) {
+    float position = angle * (SinTableSize / (2.0f * PI));
+    float base = floor(position);
+    int index = static_cast<int>(base) & (SinTableSize - 1);
+    float a = SinTableData.values[index];
+    float b = SinTableData.values[index + 1];
+    return a + (b - a) * (position - base);
+  }
+
+  /**
+   * @brief Cosine from the table with linear interpolation; same error as tableSin.
+   *
+   * @param angle Angle in radians.
+   * @return The interpolated cosine.
+   */
+  constexpr float tableCos(float angle) {
+    float position = angle * (SinTableSize / (2.0f * PI));
+    float base = floor(position);
+    int index = (static_cast<int>(base) + SinTableSize / 4) & (SinTableSize - 1);
+    float a = SinTableData.values[index];
+    float b = SinTableData.values[index + 1];
+    return a + (b - a) * (position - base);
+  }
+
+  /**
+   * @brief Decodes an sRGB-encoded value in [0, 1] to linear light (IEC 61966-2-1).
+   *
+   * @param srgb The encoded value.
+   * @return The linear value.
+   */
+  constexpr float srgbToLinear(float srgb) {
+    return srgb <= 0.04045f ? srgb / 12.92f : constexprPow((srgb + 0.055f) / 1.055f, 2.4f);
+  }
+
+  /**
+   * @brief Encodes a linear value in [0, 1] to sRGB (IEC 61966-2-1).
+   *
+   * @param linear The linear value.
+   * @return The encoded value.
+   */
+  constexpr float linearToSrgb(float linear) {
+    return linear <= 0.0031308f ? linear * 12.92f : 1.055f * constexprPow(linear, 1.0f / 2.4f) - 0.055f;
+  }
+
+  /**
+   * @brief srgbToLinear(i / 255) for every 8-bit code i.
+   */
+  struct SrgbToLinearTable {
+    float values[256];
+  };
+
+  constexpr SrgbToLinearTable makeSrgbToLinearTable() {
+    SrgbToLinearTable table{};
+    for (int i = 0; i < 256; ++i) {
+      table.values[i] = srgbToLinear(static_cast<float>(i) / 255.0f);
+    }
+    return table;
+  }
+
+  inline constexpr SrgbToLinearTable SrgbToLinearTableData = makeSrgbToLinearTable();
+
+  /**
+   * @brief Number of entries in LinearToSrgbTable; the linear input is quantized to 12 bits.
+   */
+  constexpr int LinearToSrgbTableSize = 4096;
+
+  /**
+   * @brief The 8-bit sRGB code nearest to linearToSrgb(i / (LinearToSrgbTableSize - 1)).
+   */
+  struct LinearToSrgbTable {
+    uint8_t values[LinearToSrgbTableSize];
+  };
+
+  /**
+   * @brief Builds LinearToSrgbTable by walking the decision thresholds once.
+   *
+   * Code k + 1 starts where the encoded value crosses k + 0.5, i.e. at linear value
+   * srgbToLinear((k + 0.5) / 255), so only 255 pow evaluations are needed instead of
+   * one per entry.
+   */
+  constexpr LinearToSrgbTable makeLinearToSrgbTable() {
+    LinearToSrgbTable table{};
+    int code = 0;
+    float threshold = srgbToLinear(0.5f / 255.0f);
+    for (int i = 0; i < LinearToSrgbTableSize; ++i) {
+      float linear = static_cast<float>(i) / (LinearToSrgbTableSize - 1);
+      while (code < 255 && linear >= threshold) {
+        ++code;
+        threshold = srgbToLinear((static_cast<float>(code) + 0.5f) / 255.0f);
+      }
+      table.values[i] = static_cast<uint8_t>(code);
+    }
+    return table;
+  }
+
+  inline constexpr LinearToSrgbTable LinearToSrgbTableData = makeLinearToSrgbTable();
+
+  /**
+   * @brief Decodes an 8-bit sRGB code to linear light with one table load.
+   *
+   * @param code The 8-bit sRGB value.
+   * @return The linear value in [0, 1].
+   */
+  constexpr float srgb8ToLinear(uint8_t code) {
+    return SrgbToLinearTableData.values[code];
+  }
+
+  /**
+   * @brief Encodes a linear value to an 8-bit sRGB code with one table load.
+   *
+   * Input is clamped to [0, 1] (NaN maps to 0). The result is within one code of
+   * the exactly rounded encoding, and exact at the 4096 table sample points.
+   *
+   * @param linear The linear value.
+   * @return The 8-bit sRGB value.
+   */
+  constexpr uint8_t linearToSrgb8(float linear) {
+    float clamped = linear > 0.0f ? (linear < 1.0f ? linear : 1.0f) : 0.0f;
+    return LinearToSrgbTableData.values[static_cast<int>(clamped * (LinearToSrgbTableSize - 1) + 0.5f)];
+  }
+}
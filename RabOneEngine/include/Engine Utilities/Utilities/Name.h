@@ -0,0 +1,353 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include "Engine Utilities/Structures/THash.h"
+
+namespace EngineUtilities {
+  /**
+   * @brief Entrada de la tabla de nombres: hash, longitud y texto terminado en '\0'.
+   */
+  struct NameEntry {
+    size_t Hash;       ///< Hash del texto (HashBytes).
+    uint32_t Length;   ///< Longitud del texto sin el terminador.
+    char Text[1];      ///< Texto; la entrada se reserva con espacio para Length + 1 caracteres.
+  };
+
+  /**
+   * @brief Tabla global que guarda una sola copia de cada cadena usada como Name.
+   *
+   * Las entradas nunca se mueven ni se eliminan mientras la tabla existe, as que un ndice
+   * identifica su cadena para siempre. Las lecturas (buscar un nombre existente u obtener el
+   * texto de un ndice) no toman ningn lock: la tabla hash se publica con un puntero atmico
+   * y cada ranura es un ndice atmico. Solo aadir un nombre nuevo toma el mutex; al crecer
+   * se publica una tabla hash nueva y la antigua se retira hasta la destruccin, para que los
+   * lectores que an la recorren sigan siendo vlidos.
+   */
+  class NameTable {
+  public:
+    /**
+     * @brief Devuelve la tabla global (se crea en el primer uso, de forma segura entre hilos).
+     */
+    static NameTable&
+    Get() {
+      static NameTable Instance;
+      return Instance;
+    }
+
+    /**
+     * @brief Devuelve el ndice de una cadena, aadindola si no exista.
+     *
+     * @param Text Puntero al texto (no necesita terminar en '\0').
+     * @param Length Longitud del texto.
+     * @return El ndice de la cadena; 0 para la cadena vaca.
+     */
+    uint32_t
+    FindOrAdd(const char* Text, size_t Length) {
+      if (Length == 0) {
+        return 0;
+      }
+      const size_t Hash = HashBytes(Text, Length);
+      uint32_t Index = Find(Text, Length, Hash);
+      if (Index != 0) {
+        return Index;  ///< Camino rpido sin lock.
+      }
+
+      std::lock_guard<std::mutex> Lock(m_writeMutex);
+      Index = Find(Text, Length, Hash);  ///< Otro hilo pudo aadirla mientras esperbamos.
+      if (Index != 0) {
+        return Index;
+      }
+
+      Index = m_count.load(std::memory_order_relaxed);
+      if (Index >= ChunkSize * MaxChunks) {
+        std::abort();  ///< Se agot el espacio de ndices de la tabla.
+      }
+      const NameEntry** Chunk = m_chunks[Index >> ChunkBits].load(std::memory_order_relaxed);
+      if (!Chunk) {
+        Chunk = new const NameEntry*[ChunkSize];
+        m_chunks[Index >> ChunkBits].store(Chunk, std::memory_order_release);
+      }
+      Chunk[Index & (ChunkSize - 1)] = CreateEntry(Text, Length, Hash);
+
+      HashTable* Table = m_table.load(std::memory_order_relaxed);
+      if ((Index + 1) * 2 > Table->Mask + 1) {
+        Table = Grow(Table);
+      }
+      InsertSlot(Table, Hash, Index);  ///< Publica la entrada a los lectores.
+      m_count.store(Index + 1, std::memory_order_release);
+      return Index;
+    }
+
+    /**
+     * @brief Devuelve la entrada de un ndice vlido.
+     */
+    const NameEntry*
+    GetEntry(uint32_t Index) const {
+      const NameEntry** Chunk = m_chunks[Index >> ChunkBits].load(std::memory_order_acquire);
+      return Chunk[Index & (ChunkSize - 1)];
+    }
+
+    /**
+     * @brief Nmero de nombres distintos registrados (incluida la cadena vaca).
+     */
+    size_t
+    Num() const {
+      return m_count.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr uint32_t ChunkBits = 12;
+    static constexpr uint32_t ChunkSize = 1u << ChunkBits;  ///< Entradas por bloque de ndices.
+    static constexpr uint32_t MaxChunks = 1024;             ///< Hasta ~4 millones de nombres.
+    static constexpr size_t BlockSize = 64 * 1024;           ///< Tamao de los bloques de texto.
+
+    /**
+     * @brief Tabla hash de direccionamiento abierto con ndices de nombre (0 = vaca).
+     */
+    struct HashTable {
+      uint32_t Mask;
+      std::atomic<uint32_t>* Slots;
+      HashTable* Retired;  ///< Tabla anterior, que se libera al destruir NameTable.
+    };
+
+    NameTable() : m_count(1), m_blockHead(nullptr), m_blockUsed(BlockSize) {
+      for (uint32_t i = 0; i < MaxChunks; ++i) {
+        m_chunks[i].store(nullptr, std::memory_order_relaxed);
+      }
+      const NameEntry** Chunk = new const NameEntry*[ChunkSize];
+      Chunk[0] = CreateEntry("", 0, 0);  ///< El ndice 0 es siempre la cadena vaca.
+      m_chunks[0].store(Chunk, std::memory_order_relaxed);
+      m_table.store(CreateTable(256, nullptr), std::memory_order_release);
+    }
+
+    ~NameTable() {
+      for (HashTable* Table = m_table.load(); Table;) {
+        HashTable* Retired = Table->Retired;
+        delete[] Table->Slots;
+        delete Table;
+        Table = Retired;
+      }
+      for (uint32_t i = 0; i < MaxChunks; ++i) {
+        delete[] m_chunks[i].load();
+      }
+      while (m_blockHead) {
+        char* Next = *reinterpret_cast<char**>(m_blockHead);
+        std::free(m_blockHead);
+        m_blockHead = Next;
+      }
+    }
+
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+
+    /**
+     * @brief Busca una cadena sin tomar el lock.
+     *
+     * @return Su ndice, o 0 si no est registrada.
+     */
+    uint32_t
+    Find(const char* Text, size_t Length, size_t Hash) const {
+      const HashTable* Table = m_table.load(std::memory_order_acquire);
+      for (size_t i = Hash & Table->Mask;; i = (i + 1) & Table->Mask) {
+        const uint32_t Index = Table->Slots[i].load(std::memory_order_acquire);
+        if (Index == 0) {
+          return 0;
+        }
+        const NameEntry* Entry = GetEntry(Index);
+        if (Entry->Hash == Hash && Entry->Length == Length && std::memcmp(Entry->Text, Text, Length) == 0) {
+          return Index;
+        }
+      }
+    }
+
+    static HashTable*
+    CreateTable(uint32_t Capacity, HashTable* Retired) {
+      HashTable* Table = new HashTable;
+      Table->Mask = Capacity - 1;
+      Table->Slots = new std::atomic<uint32_t>[Capacity];
+      for (uint32_t i = 0; i < Capacity; ++i) {
+        Table->Slots[i].store(0, std::memory_order_relaxed);
+      }
+      Table->Retired = Retired;
+      return Table;
+    }
+
+    static void
+    InsertSlot(HashTable* Table, size_t Hash, uint32_t Index) {
+      size_t i = Hash & Table->Mask;
+      while (Table->Slots[i].load(std::memory_order_relaxed) != 0) {
+        i = (i + 1) & Table->Mask;
+      }
+      Table->Slots[i].store(Index, std::memory_order_release);
+    }
+
+    /**
+     * @brief Crea una tabla hash del doble de tamao con todos los nombres y la publica.
+     */
+    HashTable*
+    Grow(HashTable* Old) {
+      HashTable* Table = CreateTable((Old->Mask + 1) * 2, Old);
+      const uint32_t Count = m_count.load(std::memory_order_relaxed);
+      for (uint32_t Index = 1; Index < Count; ++Index) {
+        InsertSlot(Table, GetEntry(Index)->Hash, Index);
+      }
+      m_table.store(Table, std::memory_order_release);
+      return Table;
+    }
+
+    /**
+     * @brief Copia el texto a un bloque propio y devuelve la entrada.
+     */
+    const NameEntry*
+    CreateEntry(const char* Text, size_t Length, size_t Hash) {
+      size_t Bytes = offsetof(NameEntry, Text) + Length + 1;
+      Bytes = (Bytes + alignof(NameEntry) - 1) & ~(alignof(NameEntry) - 1);
+      const size_t Header = (sizeof(char*) + alignof(NameEntry) - 1) & ~(alignof(NameEntry) - 1);
+      if (m_blockUsed + Bytes > BlockSize) {
+        // Bloque nuevo; los bloques forman una lista para liberarlos al final.
+        const size_t NewBlockSize = Header + Bytes > BlockSize ? Header + Bytes : BlockSize;
+        char* Block = static_cast<char*>(std::malloc(NewBlockSize));
+        *reinterpret_cast<char**>(Block) = m_blockHead;
+        m_blockHead = Block;
+        m_blockUsed = Header;
+      }
+      NameEntry* Entry = reinterpret_cast<NameEntry*>(m_blockHead + m_blockUsed);
+      m_blockUsed += Bytes;
+      Entry->Hash = Hash;
+      Entry->Length = static_cast<uint32_t>(Length);
+      std::memcpy(Entry->Text, Text, Length);
+      Entry->Text[Length] = '\0';
+      return Entry;
+    }
+
+    std::atomic<const NameEntry**> m_chunks[MaxChunks];  ///< Bloques de punteros a entradas por ndice.
+    std::atomic<HashTable*> m_table;                      ///< Tabla hash actual.
+    std::atomic<uint32_t> m_count;                        ///< Prximo ndice libre.
+    std::mutex m_writeMutex;                              ///< Serializa las inserciones.
+    char* m_blockHead;                                    ///< Bloque de texto actual (cabeza de la lista).
+    size_t m_blockUsed;                                   ///< Bytes usados del bloque actual.
+  };
+
+  /**
+   * @brief Nombre internado: un ndice de 32 bits a una cadena nica de la NameTable global.
+   *
+   * Comparar y calcular el hash de dos Name es una operacin sobre enteros. Crear un Name a
+   * partir de texto busca la cadena en la tabla (sin lock si ya existe). El texto es
+   * inmutable y el puntero de c_str() es vlido durante toda la ejecucin.
+   *
+   * Un Name construido por defecto es la cadena vaca y no accede a la tabla, as que puede
+   * usarse en objetos globales.
+   */
+  class Name {
+  public:
+    Name() : m_index(0) {}
+    Name(const char* Text) : m_index(NameTable::Get().FindOrAdd(Text, std::strlen(Text))) {}
+    Name(const char* Text, size_t Length) : m_index(NameTable::Get().FindOrAdd(Text, Length)) {}
+    Name(const std::string& Text) : m_index(NameTable::Get().FindOrAdd(Text.data(), Text.size())) {}
+
+    /**
+     * @brief Devuelve el texto del nombre, terminado en '\0'.
+     */
+    const char*
+    c_str() const {
+      return m_index ? NameTable::Get().GetEntry(m_index)->Text : "";
+    }
+
+    /**
+     * @brief Devuelve una copia del texto como std::string.
+     */
+    std::string
+    ToString() const {
+      return m_index ? std::string(NameTable::Get().GetEntry(m_index)->Text, Length()) : std::string();
+    }
+
+    /**
+     * @brief Devuelve la longitud del texto.
+     */
+    size_t
+    Length() const {
+      return m_index ? NameTable::Get().GetEntry(m_index)->Length : 0;
+    }
+
+    /**
+     * @brief Indica si el nombre es la cadena vaca.
+     */
+    bool IsEmpty() const { return m_index == 0; }
+
+    /**
+     * @brief Devuelve el ndice del nombre en la tabla global.
+     */
+    uint32_t GetIndex() const { return m_index; }
+
+    bool operator==(const Name& Other) const { return m_index == Other.m_index; }
+    bool operator!=(const Name& Other) const { return m_index != Other.m_index; }
+
+    /**
+     * @brief Orden por ndice (orden de registro), no alfabtico.
+     */
+    bool operator<(const Name& Other) const { return m_index < Other.m_index; }
+
+  private:
+    uint32_t m_index;  ///< ndice en NameTable; 0 es la cadena vaca.
+  };
+
+  /**
+   * @brief Hash de Name para usarlo como clave de TMap y TSet.
+   */
+  template<>
+  struct THash<Name> {
+    size_t operator()(const Name& Value) const {
+      return HashMix(Value.GetIndex());
+    }
+  };
+
+  // EXAMPLE
+
+  /*
+  int main() {
+    Name A("Koro");
+    Name B(std::string("Ko") + "ro");  ///< Misma cadena: mismo ndice.
+    std::cout << (A == B) << std::endl;  ///< 1, comparacin de enteros.
+
+    TMap<Name, int> Scores;
+    Scores.Add(A, 10);
+    std::cout << *Scores.Find(Name("Koro")) << std::endl;  ///< 10
+
+    std::cout << A.c_str() << " (" << A.Length() << ")" << std::endl;
+    return 0;
+  }
+  */
+}
\ No newline at end of file
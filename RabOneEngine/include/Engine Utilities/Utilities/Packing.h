@@ -0,0 +1,719 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "EngineMath.h"
+#include "Engine Utilities/Vectors/Vector2.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "Engine Utilities/Vectors/Vector4.h"
+
+/**
+ * @file Packing.h
+ * @brief Conversions that shrink vertex attributes: half floats, normalized integers,
+ * octahedral normals and 10-10-10-2.
+ *
+ * Every format has a scalar pack/unpack pair and an array version. The array versions
+ * use F16C or SSE2 when available and give bit-identical results to the scalar code
+ * (the unpacked octahedral normals, which are renormalized with rsqrt, agree to 1e-6,
+ * and F16C keeps the payload of a NaN where floatToHalf returns 0x7E00).
+ * Rounding is round-to-nearest-even throughout, matching the GPU's float to UNORM/SNORM
+ * conversion rules; NaN packs to the low end of a normalized format's range.
+ *
+ * A float3 position + float2 UV vertex (20 bytes) becomes half4 + half2 (12 bytes),
+ * or 8 bytes with unorm16 UVs; a float3 normal becomes 4 bytes with either
+ * packOctahedral16 or packUnorm1010102.
+ */
+
+namespace EngineUtilities {
+  /**
+   * @brief Rounds to the nearest integer, ties to even, like the SIMD conversions.
+   */
+  inline int32_t roundToInt(float value) {
+#if ENGINE_SIMD_SSE2
+    return _mm_cvtss_si32(_mm_set_ss(value));
+#else
+    return static_cast<int32_t>(std::nearbyint(value));
+#endif
+  }
+
+  /**
+   * @brief Clamps to [low, high]; NaN returns low.
+   */
+  inline float clampPacked(float value, float low, float high) {
+    return value > low ? (value < high ? value : high) : low;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Half floats (IEEE 754 binary16)
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Converts a float to a half float with round-to-nearest-even.
+   *
+   * Values past the half range become infinity, values below it become subnormals
+   * or zero, and NaN becomes a quiet NaN.
+   *
+   * @param value The float to convert.
+   * @return The half float bits.
+   */
+  inline uint16_t floatToHalf(float value) {
+    uint32_t bits = floatAsBits(value);
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7FFFFFFFu;
+    uint32_t result;
+    if (bits >= 0x47800000u) {
+      // 2^16 and above: infinity, or NaN.
+      result = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+    }
+    else if (bits < 0x38800000u) {
+      // Below 2^-14: adding 0.5 lines the half subnormal mantissa up with the low
+      // float mantissa bits and lets the FPU do the rounding.
+      result = floatAsBits(bitsAsFloat(bits) + 0.5f) - 0x3F000000u;
+    }
+    else {
+      // Rebias the exponent and round the 13 dropped mantissa bits to even.
+      uint32_t mantissaOdd = (bits >> 13) & 1u;
+      bits += 0xC8000FFFu + mantissaOdd;
+      result = bits >> 13;
+    }
+    return static_cast<uint16_t>(result | sign);
+  }
+
+  /**
+   * @brief Converts a half float to a float; exact for every input, NaNs come back quiet
+   * like they do from F16C.
+   *
+   * @param half The half float bits.
+   * @return The float value.
+   */
+  inline float halfToFloat(uint16_t half) {
+    uint32_t bits = static_cast<uint32_t>(half & 0x7FFFu) << 13;
+    uint32_t exponent = bits & 0x0F800000u;
+    bits += 0x38000000u;
+    if (exponent == 0x0F800000u) {
+      // Infinity or NaN: move the exponent the rest of the way to 255.
+      bits += 0x38000000u;
+      if (bits & 0x007FFFFFu) {
+        bits |= 0x00400000u;
+      }
+    }
+    else if (exponent == 0) {
+      // Subnormal: renormalize through the FPU.
+      bits = floatAsBits(bitsAsFloat(bits + 0x00800000u) - bitsAsFloat(0x38800000u));
+    }
+    return bitsAsFloat(bits | (static_cast<uint32_t>(half & 0x8000u) << 16));
+  }
+
+#if ENGINE_SIMD_SSE2
+  /**
+   * @brief Software float to half for four lanes; each 32-bit lane holds the result.
+   */
+  inline __m128i floatToHalf4(__m128 value) {
+    const __m128i signMask = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    __m128i bits = _mm_castps_si128(value);
+    __m128i sign = _mm_and_si128(bits, signMask);
+    __m128i absBits = _mm_xor_si128(bits, sign);
+    __m128 absValue = _mm_castsi128_ps(absBits);
+
+    __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32(0x47800000), absBits);
+    __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), absBits);
+    __m128i isNaN = _mm_castps_si128(_mm_cmpunord_ps(absValue, absValue));
+    __m128i special = _mm_or_si128(_mm_and_si128(isNaN, _mm_set1_epi32(0x0200)), _mm_set1_epi32(0x7C00));
+
+    __m128i subnormal = _mm_sub_epi32(
+      _mm_castps_si128(_mm_add_ps(absValue, _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+    __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_srli_epi32(
+      _mm_add_epi32(_mm_add_epi32(absBits, _mm_set1_epi32(static_cast<int>(0xC8000FFFu))), mantissaOdd), 13);
+
+    __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+    __m128i result = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, special));
+    return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+  }
+
+  /**
+   * @brief Software half to float for four lanes; each 32-bit lane holds one half.
+   *
+   * Subnormal halves go through a float multiply, so they read as zero if the
+   * denormals-are-zero flag is set.
+   */
+  inline __m128 halfToFloat4(__m128i half) {
+    __m128i magnitude = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+    __m128i sign = _mm_slli_epi32(_mm_xor_si128(half, magnitude), 16);
+    // Scaling by 2^112 rebiases the exponent and normalizes subnormals in one step.
+    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(magnitude, 13)), _mm_set1_ps(5.192296858534828e+33f));
+    __m128i infNaN = _mm_and_si128(_mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF)), _mm_set1_epi32(0x7F800000));
+    __m128i quiet = _mm_and_si128(_mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7C00)), _mm_set1_epi32(0x00400000));
+    infNaN = _mm_or_si128(infNaN, quiet);
+    return _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(_mm_castps_si128(scaled), infNaN), sign));
+  }
+
+  /**
+   * @brief Narrows four 32-bit lanes holding 16-bit values and stores them.
+   */
+  inline void storeLow16x4(uint16_t* output, __m128i values) {
+    // Sign-extend first so the saturating pack keeps all 16 bits.
+    __m128i extended = _mm_srai_epi32(_mm_slli_epi32(values, 16), 16);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(extended, extended));
+  }
+#endif
+
+  /**
+   * @brief Converts an array of floats to half floats.
+   *
+   * Eight at a time with F16C, four at a time with the SSE2 version of floatToHalf,
+   * then one at a time.
+   *
+   * @param input The floats.
+   * @param output Receives the half floats.
+   * @param count Number of values.
+   */
+  inline void floatToHalf(const float* input, uint16_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_F16C
+    for (; i + 8 <= count; i += 8) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    for (; i + 4 <= count; i += 4) {
+      storeLow16x4(output + i, floatToHalf4(_mm_loadu_ps(input + i)));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = floatToHalf(input[i]);
+    }
+  }
+
+  /**
+   * @brief Converts an array of half floats to floats.
+   *
+   * @param input The half floats.
+   * @param output Receives the floats.
+   * @param count Number of values.
+   */
+  inline void halfToFloat(const uint16_t* input, float* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_F16C
+    for (; i + 8 <= count; i += 8) {
+      _mm256_storeu_ps(output + i,
+                       _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))));
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    for (; i + 4 <= count; i += 4) {
+      __m128i half = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i));
+      _mm_storeu_ps(output + i, halfToFloat4(_mm_unpacklo_epi16(half, _mm_setzero_si128())));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = halfToFloat(input[i]);
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Normalized integers
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Packs [0, 1] into 8 bits: round(clamp(value, 0, 1) * 255).
+   */
+  inline uint8_t packUnorm8(float value) {
+    return static_cast<uint8_t>(roundToInt(clampPacked(value * 255.0f, 0.0f, 255.0f)));
+  }
+
+  /**
+   * @brief Unpacks an 8-bit unorm to [0, 1].
+   */
+  inline float unpackUnorm8(uint8_t value) {
+    return static_cast<float>(value) * (1.0f / 255.0f);
+  }
+
+  /**
+   * @brief Packs [-1, 1] into 8 bits: round(clamp(value, -1, 1) * 127).
+   */
+  inline int8_t packSnorm8(float value) {
+    return static_cast<int8_t>(roundToInt(clampPacked(value * 127.0f, -127.0f, 127.0f)));
+  }
+
+  /**
+   * @brief Unpacks an 8-bit snorm to [-1, 1]; -128 maps to -1 like on the GPU.
+   */
+  inline float unpackSnorm8(int8_t value) {
+    return EMax(static_cast<float>(value) * (1.0f / 127.0f), -1.0f);
+  }
+
+  /**
+   * @brief Packs [0, 1] into 16 bits: round(clamp(value, 0, 1) * 65535).
+   */
+  inline uint16_t packUnorm16(float value) {
+    return static_cast<uint16_t>(roundToInt(clampPacked(value * 65535.0f, 0.0f, 65535.0f)));
+  }
+
+  /**
+   * @brief Unpacks a 16-bit unorm to [0, 1].
+   */
+  inline float unpackUnorm16(uint16_t value) {
+    return static_cast<float>(value) * (1.0f / 65535.0f);
+  }
+
+  /**
+   * @brief Packs [-1, 1] into 16 bits: round(clamp(value, -1, 1) * 32767).
+   */
+  inline int16_t packSnorm16(float value) {
+    return static_cast<int16_t>(roundToInt(clampPacked(value * 32767.0f, -32767.0f, 32767.0f)));
+  }
+
+  /**
+   * @brief Unpacks a 16-bit snorm to [-1, 1]; -32768 maps to -1.
+   */
+  inline float unpackSnorm16(int16_t value) {
+    return EMax(static_cast<float>(value) * (1.0f / 32767.0f), -1.0f);
+  }
+
+#if ENGINE_SIMD_SSE2
+  /**
+   * @brief Scales, clamps (NaN to low) and rounds four lanes to 32-bit integers.
+   */
+  inline __m128i quantize4(__m128 value, __m128 scale, __m128 low, __m128 high) {
+    return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(value, scale), low), high));
+  }
+
+  /**
+   * @brief Loads four bytes into the low 32 bits of a register.
+   */
+  inline __m128i loadBytes4(const void* source) {
+    int32_t bytes;
+    std::memcpy(&bytes, source, sizeof(bytes));
+    return _mm_cvtsi32_si128(bytes);
+  }
+#endif
+
+  /**
+   * @brief Packs an array of [0, 1] floats into 8-bit unorms, 16 per SSE2 iteration.
+   */
+  inline void packUnorm8(const float* input, uint8_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 low = _mm_setzero_ps();
+    for (; i + 16 <= count; i += 16) {
+      __m128i a = quantize4(_mm_loadu_ps(input + i), scale, low, scale);
+      __m128i b = quantize4(_mm_loadu_ps(input + i + 4), scale, low, scale);
+      __m128i c = quantize4(_mm_loadu_ps(input + i + 8), scale, low, scale);
+      __m128i d = quantize4(_mm_loadu_ps(input + i + 12), scale, low, scale);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packUnorm8(input[i]);
+    }
+  }
+
+  /**
+   * @brief Unpacks an array of 8-bit unorms to floats.
+   */
+  inline void unpackUnorm8(const uint8_t* input, float* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+      __m128i values = _mm_unpacklo_epi16(_mm_unpacklo_epi8(loadBytes4(input + i), zero), zero);
+      _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(values), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackUnorm8(input[i]);
+    }
+  }
+
+  /**
+   * @brief Packs an array of [-1, 1] floats into 8-bit snorms, 16 per SSE2 iteration.
+   */
+  inline void packSnorm8(const float* input, int8_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(127.0f);
+    const __m128 low = _mm_set1_ps(-127.0f);
+    for (; i + 16 <= count; i += 16) {
+      __m128i a = quantize4(_mm_loadu_ps(input + i), scale, low, scale);
+      __m128i b = quantize4(_mm_loadu_ps(input + i + 4), scale, low, scale);
+      __m128i c = quantize4(_mm_loadu_ps(input + i + 8), scale, low, scale);
+      __m128i d = quantize4(_mm_loadu_ps(input + i + 12), scale, low, scale);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packSnorm8(input[i]);
+    }
+  }
+
+  /**
+   * @brief Unpacks an array of 8-bit snorms to floats.
+   */
+  inline void unpackSnorm8(const int8_t* input, float* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(1.0f / 127.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for (; i + 4 <= count; i += 4) {
+      // Duplicating each byte into the high half and shifting back sign-extends it.
+      __m128i bytes = loadBytes4(input + i);
+      __m128i words = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+      __m128i values = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+      _mm_storeu_ps(output + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(values), scale), minusOne));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackSnorm8(input[i]);
+    }
+  }
+
+  /**
+   * @brief Packs an array of [0, 1] floats into 16-bit unorms, 8 per SSE2 iteration.
+   */
+  inline void packUnorm16(const float* input, uint16_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(65535.0f);
+    const __m128 low = _mm_setzero_ps();
+    const __m128i bias = _mm_set1_epi32(32768);
+    for (; i + 8 <= count; i += 8) {
+      // SSE2 only has a signed 32-to-16 pack, so shift into the signed range and back.
+      __m128i a = _mm_sub_epi32(quantize4(_mm_loadu_ps(input + i), scale, low, scale), bias);
+      __m128i b = _mm_sub_epi32(quantize4(_mm_loadu_ps(input + i + 4), scale, low, scale), bias);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_xor_si128(_mm_packs_epi32(a, b), _mm_set1_epi16(-32768)));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packUnorm16(input[i]);
+    }
+  }
+
+  /**
+   * @brief Unpacks an array of 16-bit unorms to floats, 16 per AVX2 or 8 per SSE2 iteration.
+   */
+  inline void unpackUnorm16(const uint16_t* input, float* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_AVX2
+    const __m256 wideScale = _mm256_set1_ps(1.0f / 65535.0f);
+    for (; i + 16 <= count; i += 16) {
+      __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+      _mm256_storeu_ps(output + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(low)), wideScale));
+      _mm256_storeu_ps(output + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(high)), wideScale));
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(1.0f / 65535.0f);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+      __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      _mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero)), scale));
+      _mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero)), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackUnorm16(input[i]);
+    }
+  }
+
+  /**
+   * @brief Packs an array of [-1, 1] floats into 16-bit snorms, 8 per SSE2 iteration.
+   */
+  inline void packSnorm16(const float* input, int16_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 low = _mm_set1_ps(-32767.0f);
+    for (; i + 8 <= count; i += 8) {
+      __m128i a = quantize4(_mm_loadu_ps(input + i), scale, low, scale);
+      __m128i b = quantize4(_mm_loadu_ps(input + i + 4), scale, low, scale);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(a, b));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packSnorm16(input[i]);
+    }
+  }
+
+  /**
+   * @brief Unpacks an array of 16-bit snorms to floats, 16 per AVX2 or 8 per SSE2 iteration.
+   */
+  inline void unpackSnorm16(const int16_t* input, float* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_AVX2
+    const __m256 wideScale = _mm256_set1_ps(1.0f / 32767.0f);
+    const __m256 wideMinusOne = _mm256_set1_ps(-1.0f);
+    for (; i + 16 <= count; i += 16) {
+      __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+      _mm256_storeu_ps(output + i,
+                       _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(low)), wideScale), wideMinusOne));
+      _mm256_storeu_ps(output + i + 8,
+                       _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(high)), wideScale), wideMinusOne));
+    }
+#endif
+#if ENGINE_SIMD_SSE2
+    const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for (; i + 8 <= count; i += 8) {
+      __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+      __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16);
+      _mm_storeu_ps(output + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(low), scale), minusOne));
+      _mm_storeu_ps(output + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(high), scale), minusOne));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackSnorm16(input[i]);
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Octahedral normals
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Maps a unit vector onto the [-1, 1] square of the octahedral encoding.
+   *
+   * The upper hemisphere projects straight down onto the octahedron; the lower one
+   * is folded over the diagonals. A zero vector encodes as (0, 0), i.e. +Z.
+   *
+   * @param normal A unit (or at least non-negative length) vector.
+   * @return The encoded coordinates.
+   */
+  inline Vector2 octahedralEncode(const Vector3& normal) {
+    float l1 = fabs(normal.x) + fabs(normal.y) + fabs(normal.z);
+    float invL1 = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+    float x = normal.x * invL1;
+    float y = normal.y * invL1;
+    if (normal.z < 0.0f) {
+      float foldedX = (1.0f - fabs(y)) * copySign(1.0f, x);
+      float foldedY = (1.0f - fabs(x)) * copySign(1.0f, y);
+      x = foldedX;
+      y = foldedY;
+    }
+    return Vector2(x, y);
+  }
+
+  /**
+   * @brief Inverse of octahedralEncode.
+   *
+   * @param encoded Coordinates in [-1, 1].
+   * @return The unit vector.
+   */
+  inline Vector3 octahedralDecode(const Vector2& encoded) {
+    float z = 1.0f - fabs(encoded.x) - fabs(encoded.y);
+    float fold = EMax(-z, 0.0f);
+    return Vector3(encoded.x - copySign(fold, encoded.x),
+                   encoded.y - copySign(fold, encoded.y), z).normalize();
+  }
+
+  /**
+   * @brief Encodes a unit vector as two 16-bit snorms in one 32-bit word (x in the low half).
+   *
+   * The worst-case angular error is below 0.04 degrees.
+   */
+  inline uint32_t packOctahedral16(const Vector3& normal) {
+    Vector2 encoded = octahedralEncode(normal);
+    return static_cast<uint16_t>(packSnorm16(encoded.x)) |
+           (static_cast<uint32_t>(static_cast<uint16_t>(packSnorm16(encoded.y))) << 16);
+  }
+
+  /**
+   * @brief Decodes a packOctahedral16 word.
+   */
+  inline Vector3 unpackOctahedral16(uint32_t packed) {
+    return octahedralDecode(Vector2(unpackSnorm16(static_cast<int16_t>(packed & 0xFFFFu)),
+                                    unpackSnorm16(static_cast<int16_t>(packed >> 16))));
+  }
+
+  /**
+   * @brief Encodes an array of unit vectors with packOctahedral16, four per SSE2 iteration.
+   */
+  inline void packOctahedral16(const Vector3* input, uint32_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 low = _mm_set1_ps(-32767.0f);
+    for (; i + 4 <= count; i += 4) {
+      const float* in = &input[i].x;
+      __m128 x, y, z;
+      SimdDeinterleave3(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+      __m128 l1 = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)),
+                             _mm_andnot_ps(signMask, z));
+      __m128 invL1 = _mm_and_ps(_mm_div_ps(one, l1), _mm_cmpgt_ps(l1, zero));
+      x = _mm_mul_ps(x, invL1);
+      y = _mm_mul_ps(y, invL1);
+      __m128 foldedX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_or_ps(_mm_and_ps(x, signMask), one));
+      __m128 foldedY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_or_ps(_mm_and_ps(y, signMask), one));
+      __m128 lower = _mm_cmplt_ps(z, zero);
+      x = _mm_or_ps(_mm_and_ps(lower, foldedX), _mm_andnot_ps(lower, x));
+      y = _mm_or_ps(_mm_and_ps(lower, foldedY), _mm_andnot_ps(lower, y));
+      __m128i packedX = _mm_and_si128(quantize4(x, scale, low, scale), _mm_set1_epi32(0xFFFF));
+      __m128i packedY = _mm_slli_epi32(quantize4(y, scale, low, scale), 16);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_or_si128(packedX, packedY));
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packOctahedral16(input[i]);
+    }
+  }
+
+  /**
+   * @brief Decodes an array of packOctahedral16 words, four per SSE2 iteration.
+   */
+  inline void unpackOctahedral16(const uint32_t* input, Vector3* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for (; i + 4 <= count; i += 4) {
+      __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128 x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 16), 16));
+      __m128 y = _mm_cvtepi32_ps(_mm_srai_epi32(packed, 16));
+      x = _mm_max_ps(_mm_mul_ps(x, scale), minusOne);
+      y = _mm_max_ps(_mm_mul_ps(y, scale), minusOne);
+      __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y));
+      __m128 fold = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+      x = _mm_sub_ps(x, _mm_or_ps(fold, _mm_and_ps(x, signMask)));
+      y = _mm_sub_ps(y, _mm_or_ps(fold, _mm_and_ps(y, signMask)));
+      __m128 invLength = rsqrt4(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+      __m128 a, b, c;
+      SimdInterleave3(_mm_mul_ps(x, invLength), _mm_mul_ps(y, invLength), _mm_mul_ps(z, invLength), a, b, c);
+      float* out = &output[i].x;
+      _mm_storeu_ps(out, a);
+      _mm_storeu_ps(out + 4, b);
+      _mm_storeu_ps(out + 8, c);
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackOctahedral16(input[i]);
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // 10-10-10-2 (DXGI_FORMAT_R10G10B10A2_UNORM)
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Packs x, y, z into 10-bit and w into 2-bit unorms, x in the low bits.
+   *
+   * Store normals or tangents biased to [0, 1] (n * 0.5 + 0.5); the w bits can hold
+   * the bitangent sign.
+   *
+   * @param value Components in [0, 1].
+   * @return The packed word.
+   */
+  inline uint32_t packUnorm1010102(const Vector4& value) {
+    uint32_t x = static_cast<uint32_t>(roundToInt(clampPacked(value.x * 1023.0f, 0.0f, 1023.0f)));
+    uint32_t y = static_cast<uint32_t>(roundToInt(clampPacked(value.y * 1023.0f, 0.0f, 1023.0f)));
+    uint32_t z = static_cast<uint32_t>(roundToInt(clampPacked(value.z * 1023.0f, 0.0f, 1023.0f)));
+    uint32_t w = static_cast<uint32_t>(roundToInt(clampPacked(value.w * 3.0f, 0.0f, 3.0f)));
+    return x | (y << 10) | (z << 20) | (w << 30);
+  }
+
+  /**
+   * @brief Unpacks a packUnorm1010102 word to [0, 1] components.
+   */
+  inline Vector4 unpackUnorm1010102(uint32_t packed) {
+    return Vector4(static_cast<float>(packed & 0x3FFu) * (1.0f / 1023.0f),
+                   static_cast<float>((packed >> 10) & 0x3FFu) * (1.0f / 1023.0f),
+                   static_cast<float>((packed >> 20) & 0x3FFu) * (1.0f / 1023.0f),
+                   static_cast<float>(packed >> 30) * (1.0f / 3.0f));
+  }
+
+  /**
+   * @brief Packs an array with packUnorm1010102; four vectors are transposed per SSE2 iteration.
+   */
+  inline void packUnorm1010102(const Vector4* input, uint32_t* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 scale10 = _mm_set1_ps(1023.0f);
+    const __m128 scale2 = _mm_set1_ps(3.0f);
+    for (; i + 4 <= count; i += 4) {
+      __m128 x = input[i].toSimd();
+      __m128 y = input[i + 1].toSimd();
+      __m128 z = input[i + 2].toSimd();
+      __m128 w = input[i + 3].toSimd();
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+      __m128i packed = quantize4(x, scale10, zero, scale10);
+      packed = _mm_or_si128(packed, _mm_slli_epi32(quantize4(y, scale10, zero, scale10), 10));
+      packed = _mm_or_si128(packed, _mm_slli_epi32(quantize4(z, scale10, zero, scale10), 20));
+      packed = _mm_or_si128(packed, _mm_slli_epi32(quantize4(w, scale2, zero, scale2), 30));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = packUnorm1010102(input[i]);
+    }
+  }
+
+  /**
+   * @brief Unpacks an array of packUnorm1010102 words, four per SSE2 iteration.
+   */
+  inline void unpackUnorm1010102(const uint32_t* input, Vector4* output, size_t count) {
+    size_t i = 0;
+#if ENGINE_SIMD_SSE2
+    const __m128i mask10 = _mm_set1_epi32(0x3FF);
+    const __m128 scale10 = _mm_set1_ps(1.0f / 1023.0f);
+    const __m128 scale2 = _mm_set1_ps(1.0f / 3.0f);
+    for (; i + 4 <= count; i += 4) {
+      __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(packed, mask10)), scale10);
+      __m128 y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 10), mask10)), scale10);
+      __m128 z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 20), mask10)), scale10);
+      __m128 w = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(packed, 30)), scale2);
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+      output[i] = Vector4(x);
+      output[i + 1] = Vector4(y);
+      output[i + 2] = Vector4(z);
+      output[i + 3] = Vector4(w);
+    }
+#endif
+    for (; i < count; ++i) {
+      output[i] = unpackUnorm1010102(input[i]);
+    }
+  }
+}
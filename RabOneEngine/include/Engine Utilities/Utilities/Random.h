@@ -0,0 +1,815 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "EngineMath.h"
+#include "Engine Utilities/Vectors/Vector2.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+
+/**
+ * @file Random.h
+ * @brief Pseudo-random number generators for simulation and content generation.
+ *
+ * Xoshiro256 (xoshiro256**) and PCG32 are small, fast, statistically strong
+ * generators; neither is suitable for cryptography. Both satisfy the standard
+ * UniformRandomBitGenerator requirements, so they also work with <random>
+ * distributions and std::shuffle. For per-thread streams, copy one seeded
+ * generator and call jump() (Xoshiro256) or pick a different stream (PCG32) for
+ * each thread.
+ *
+ * BatchRandom runs four xoshiro256** streams in lockstep in SIMD registers and
+ * fills arrays with uniform floats, unit vectors and points in shapes. Its output
+ * sequence depends only on the seed, not on whether AVX2, SSE2 or the scalar code
+ * generated it (shape points may differ in the last bit where the compiler
+ * contracts multiply-adds).
+ */
+
+namespace EngineUtilities {
+  /**
+   * @brief SplitMix64, used to expand a 64-bit seed into generator state.
+   *
+   * @param state The running state; advanced on each call.
+   * @return The next output.
+   */
+  constexpr uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  /**
+   * @brief Maps the high 24 bits of a 32-bit value to a float in [0, 1).
+   */
+  constexpr float uintToUnitFloat(uint32_t bits) {
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+  }
+
+  /**
+   * @brief xoshiro256** by Blackman and Vigna: 256 bits of state, period 2^256 - 1.
+   */
+  class Xoshiro256 {
+  public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Seeds the generator; any seed, including 0, gives a valid state.
+     *
+     * @param seed The seed, expanded with SplitMix64.
+     */
+    constexpr explicit Xoshiro256(uint64_t seed = 0x853C49E6748FEA9Bull) : m_state{} {
+      for (int i = 0; i < 4; ++i) {
+        m_state[i] = splitMix64(seed);
+      }
+    }
+
+    /**
+     * @brief Smallest value the generator returns.
+     */
+    static constexpr result_type (min)() { return 0; }
+
+    /**
+     * @brief Largest value the generator returns.
+     */
+    static constexpr result_type (max)() { return ~static_cast<uint64_t>(0); }
+
+    /**
+     * @brief Returns the next 64 random bits.
+     */
+    constexpr uint64_t next() {
+      uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+      uint64_t t = m_state[1] << 17;
+      m_state[2] ^= m_state[0];
+      m_state[3] ^= m_state[1];
+      m_state[1] ^= m_state[2];
+      m_state[0] ^= m_state[3];
+      m_state[2] ^= t;
+      m_state[3] = rotl(m_state[3], 45);
+      return result;
+    }
+
+    /**
+     * @brief Same as next(), for use with <random>.
+     */
+    constexpr result_type operator()() {
+      return next();
+    }
+
+    /**
+     * @brief Returns a uniform integer in [0, bound) without modulo bias (Lemire's method).
+     *
+     * @param bound The exclusive upper bound; must be non-zero.
+     */
+    constexpr uint32_t nextUInt(uint32_t bound) {
+      uint64_t product = (next() >> 32) * bound;
+      if (static_cast<uint32_t>(product) < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while (static_cast<uint32_t>(product) < threshold) {
+          product = (next() >> 32) * bound;
+        }
+      }
+      return static_cast<uint32_t>(product >> 32);
+    }
+
+    /**
+     * @brief Returns a uniform float in [0, 1) with 24 random bits.
+     */
+    constexpr float nextFloat() {
+      return uintToUnitFloat(static_cast<uint32_t>(next() >> 32));
+    }
+
+    /**
+     * @brief Returns a uniform float in [low, high).
+     */
+    constexpr float nextFloat(float low, float high) {
+      return low + (high - low) * nextFloat();
+    }
+
+    /**
+     * @brief Advances the generator by 2^128 steps.
+     *
+     * Calling jump() on successive copies gives 2^128 non-overlapping streams, one
+     * per thread or per SIMD lane.
+     */
+    constexpr void jump() {
+      constexpr uint64_t polynomial[4] = {
+        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+      };
+      applyJump(polynomial);
+    }
+
+    /**
+     * @brief Advances the generator by 2^192 steps, for a second level of streams
+     * (for example one per machine, each split further with jump()).
+     */
+    constexpr void longJump() {
+      constexpr uint64_t polynomial[4] = {
+        0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull
+      };
+      applyJump(polynomial);
+    }
+
+    /**
+     * @brief Returns one of the four 64-bit words of the state.
+     */
+    constexpr uint64_t stateWord(int index) const {
+      return m_state[index];
+    }
+
+  private:
+    static constexpr uint64_t rotl(uint64_t value, int shift) {
+      return (value << shift) | (value >> (64 - shift));
+    }
+
+    constexpr void applyJump(const uint64_t (&polynomial)[4]) {
+      uint64_t s[4] = {};
+      for (int i = 0; i < 4; ++i) {
+        for (int bit = 0; bit < 64; ++bit) {
+          if (polynomial[i] & (static_cast<uint64_t>(1) << bit)) {
+            for (int k = 0; k < 4; ++k) {
+              s[k] ^= m_state[k];
+            }
+          }
+          next();
+        }
+      }
+      for (int k = 0; k < 4; ++k) {
+        m_state[k] = s[k];
+      }
+    }
+
+    uint64_t m_state[4]; ///< Generator state; never all zero.
+  };
+
+  /**
+   * @brief PCG32 (XSH RR) by O'Neill: 64-bit LCG state, 32-bit output, period 2^64.
+   *
+   * Each odd increment selects one of 2^63 independent streams, and advance()
+   * skips ahead any number of steps in O(log n).
+   */
+  class PCG32 {
+  public:
+    using result_type = uint32_t;
+
+    /**
+     * @brief Seeds the generator (pcg32_srandom_r).
+     *
+     * @param seed The starting state.
+     * @param stream The stream selector; generators with different streams never overlap.
+     */
+    constexpr explicit PCG32(uint64_t seed = 0x853C49E6748FEA9Bull, uint64_t stream = 0xDA3E39CB94B95BDBull)
+      : m_state(0), m_increment((stream << 1) | 1u) {
+      next();
+      m_state += seed;
+      next();
+    }
+
+    /**
+     * @brief Smallest value the generator returns.
+     */
+    static constexpr result_type (min)() { return 0; }
+
+    /**
+     * @brief Largest value the generator returns.
+     */
+    static constexpr result_type (max)() { return ~static_cast<uint32_t>(0); }
+
+    /**
+     * @brief Returns the next 32 random bits.
+     */
+    constexpr uint32_t next() {
+      uint64_t old = m_state;
+      m_state = old * Multiplier + m_increment;
+      uint32_t xorShifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+      uint32_t rotation = static_cast<uint32_t>(old >> 59);
+      return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    /**
+     * @brief Same as next(), for use with <random>.
+     */
+    constexpr result_type operator()() {
+      return next();
+    }
+
+    /**
+     * @brief Returns a uniform integer in [0, bound) without modulo bias (Lemire's method).
+     *
+     * @param bound The exclusive upper bound; must be non-zero.
+     */
+    constexpr uint32_t nextUInt(uint32_t bound) {
+      uint64_t product = static_cast<uint64_t>(next()) * bound;
+      if (static_cast<uint32_t>(product) < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while (static_cast<uint32_t>(product) < threshold) {
+          product = static_cast<uint64_t>(next()) * bound;
+        }
+      }
+      return static_cast<uint32_t>(product >> 32);
+    }
+
+    /**
+     * @brief Returns a uniform float in [0, 1) with 24 random bits.
+     */
+    constexpr float nextFloat() {
+      return uintToUnitFloat(next());
+    }
+
+    /**
+     * @brief Returns a uniform float in [low, high).
+     */
+    constexpr float nextFloat(float low, float high) {
+      return low + (high - low) * nextFloat();
+    }
+
+    /**
+     * @brief Advances the generator by delta steps in O(log delta) (Brown's method).
+     *
+     * Advancing by 2^64 - n steps goes back n steps.
+     *
+     * @param delta Number of steps to skip.
+     */
+    constexpr void advance(uint64_t delta) {
+      uint64_t multiplier = Multiplier;
+      uint64_t increment = m_increment;
+      uint64_t accumulatedMultiplier = 1;
+      uint64_t accumulatedIncrement = 0;
+      while (delta > 0) {
+        if (delta & 1u) {
+          accumulatedMultiplier *= multiplier;
+          accumulatedIncrement = accumulatedIncrement * multiplier + increment;
+        }
+        increment = (multiplier + 1) * increment;
+        multiplier *= multiplier;
+        delta >>= 1;
+      }
+      m_state = accumulatedMultiplier * m_state + accumulatedIncrement;
+    }
+
+  private:
+    static constexpr uint64_t Multiplier = 6364136223846793005ull;
+
+    uint64_t m_state;     ///< LCG state.
+    uint64_t m_increment; ///< Stream selector; always odd.
+  };
+
+  /**
+   * @brief Four xoshiro256** streams, 2^128 steps apart, advanced together in SIMD registers.
+   *
+   * Each step yields 4 x 64 = 256 random bits, read as eight 32-bit words (lane 0
+   * low, lane 0 high, lane 1 low, ...). The fill functions consume whole steps and
+   * drop the unused words of the last one, so the sequence is the same on every
+   * instruction set. Uniform floats take 8 words per step with AVX2 and two
+   * 4-wide halves with SSE2.
+   */
+  class alignas(32) BatchRandom {
+  public:
+    /**
+     * @brief Seeds the four streams from one seed.
+     *
+     * @param seed The seed for the first stream; the others are jump()s of it.
+     */
+    explicit BatchRandom(uint64_t seed = 0x853C49E6748FEA9Bull) : BatchRandom(Xoshiro256(seed)) {}
+
+    /**
+     * @brief Seeds the four streams from a generator (for example a jump() of a
+     * per-thread generator); the generator itself is left unchanged.
+     */
+    explicit BatchRandom(const Xoshiro256& generator) : m_state{} {
+      Xoshiro256 stream = generator;
+      for (int lane = 0; lane < 4; ++lane) {
+        for (int word = 0; word < 4; ++word) {
+          m_state[word][lane] = stream.stateWord(word);
+        }
+        stream.jump();
+      }
+    }
+
+    /**
+     * @brief Fills an array with random 32-bit words.
+     */
+    void fillUInt(uint32_t* output, size_t count) {
+      uint32_t words[8];
+      size_t i = 0;
+      for (; i + 8 <= count; i += 8) {
+        step(output + i);
+      }
+      if (i < count) {
+        step(words);
+        std::memcpy(output + i, words, (count - i) * sizeof(uint32_t));
+      }
+    }
+
+    /**
+     * @brief Fills an array with uniform floats in [0, 1), 24 random bits each.
+     */
+    void fillUniform(float* output, size_t count) {
+      fillUniform(output, count, 0.0f, 1.0f);
+    }
+
+    /**
+     * @brief Fills an array with uniform floats in [low, high).
+     */
+    void fillUniform(float* output, size_t count, float low, float high) {
+      float block[8];
+      size_t i = 0;
+#if ENGINE_SIMD_AVX2
+      // Keeping the state in registers for the whole loop is about 1.5x faster;
+      // the compiler cannot do it alone because the stores to output may alias m_state.
+      __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[0]));
+      __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[1]));
+      __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[2]));
+      __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[3]));
+      const __m256 scale = _mm256_set1_ps((high - low) * (1.0f / 16777216.0f));
+      const __m256 offset = _mm256_set1_ps(low);
+      for (; i + 8 <= count; i += 8) {
+        __m256 bits = _mm256_cvtepi32_ps(_mm256_srli_epi32(advance4(s0, s1, s2, s3), 8));
+        _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(bits, scale), offset));
+      }
+      storeState(s0, s1, s2, s3);
+#endif
+      for (; i + 8 <= count; i += 8) {
+        uniformBlock(output + i, low, high - low);
+      }
+      if (i < count) {
+        uniformBlock(block, low, high - low);
+        std::memcpy(output + i, block, (count - i) * sizeof(float));
+      }
+    }
+
+    /**
+     * @brief Fills an array with unit vectors uniformly distributed on the sphere.
+     *
+     * Uses Archimedes' projection: z is uniform in [-1, 1) and the azimuth uniform;
+     * the azimuth's sine and cosine come from a short polynomial on [-pi/4, pi/4]
+     * rotated by a random quarter turn, so no trigonometric call is needed. Lengths
+     * are 1 within 1e-6.
+     */
+    void fillUnitVectors(Vector3* output, size_t count) {
+      fillBlocks(output, count, [this](Vector3* block) { unitVectorBlock(block, false); });
+    }
+
+    /**
+     * @brief Fills an array with points uniformly distributed inside a sphere.
+     *
+     * A unit vector scaled by radius * cbrt(u); the cube root makes the density
+     * uniform in volume.
+     */
+    void fillPointsInSphere(Vector3* output, size_t count, const Vector3& center, float radius) {
+      fillBlocks(output, count, [this, &center, radius](Vector3* block) {
+        unitVectorBlock(block, true);
+        for (int k = 0; k < 4; ++k) {
+          block[k] = center + block[k] * radius;
+        }
+      });
+    }
+
+    /**
+     * @brief Fills an array with points uniformly distributed inside an axis-aligned box.
+     */
+    void fillPointsInBox(Vector3* output, size_t count, const Vector3& minimum, const Vector3& maximum) {
+      Vector3 block[8];
+      Vector3 size = maximum - minimum;
+      size_t i = 0;
+      for (; i + 8 <= count; i += 8) {
+        boxBlock(output + i, minimum, size);
+      }
+      if (i < count) {
+        boxBlock(block, minimum, size);
+        std::memcpy(output + i, block, (count - i) * sizeof(Vector3));
+      }
+    }
+
+    /**
+     * @brief Fills an array with points uniformly distributed inside a disk
+     * (radius sqrt(u) times a random unit direction).
+     */
+    void fillPointsInDisk(Vector2* output, size_t count, const Vector2& center, float radius) {
+      Vector2 block[4];
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4) {
+        diskBlock(output + i, center, radius);
+      }
+      if (i < count) {
+        diskBlock(block, center, radius);
+        std::memcpy(output + i, block, (count - i) * sizeof(Vector2));
+      }
+    }
+
+  private:
+    /**
+     * @brief Runs blockFunction over groups of four vectors, the last one through a buffer.
+     */
+    template<typename BlockFunction>
+    static void fillBlocks(Vector3* output, size_t count, BlockFunction blockFunction) {
+      Vector3 block[4];
+      size_t i = 0;
+      for (; i + 4 <= count; i += 4) {
+        blockFunction(output + i);
+      }
+      if (i < count) {
+        blockFunction(block);
+        std::memcpy(output + i, block, (count - i) * sizeof(Vector3));
+      }
+    }
+
+#if ENGINE_SIMD_AVX2
+    /**
+     * @brief One xoshiro256** step on four streams held in registers.
+     *
+     * @return The four 64-bit outputs, read as eight 32-bit words.
+     */
+    static __m256i advance4(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3) {
+      // AVX2 has no 64-bit multiply, but * 5 and * 9 are a shift and an add.
+      __m256i times5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+      __m256i rotated = _mm256_or_si256(_mm256_slli_epi64(times5, 7), _mm256_srli_epi64(times5, 57));
+      __m256i result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+      __m256i t = _mm256_slli_epi64(s1, 17);
+      s2 = _mm256_xor_si256(s2, s0);
+      s3 = _mm256_xor_si256(s3, s1);
+      s1 = _mm256_xor_si256(s1, s2);
+      s0 = _mm256_xor_si256(s0, s3);
+      s2 = _mm256_xor_si256(s2, t);
+      s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+      return result;
+    }
+
+    /**
+     * @brief Advances the four streams and returns their outputs as eight 32-bit words.
+     */
+    __m256i nextWords8() {
+      __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[0]));
+      __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[1]));
+      __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[2]));
+      __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_state[3]));
+      __m256i result = advance4(s0, s1, s2, s3);
+      storeState(s0, s1, s2, s3);
+      return result;
+    }
+
+    /**
+     * @brief Writes the four state registers back to m_state.
+     */
+    void storeState(__m256i s0, __m256i s1, __m256i s2, __m256i s3) {
+      _mm256_store_si256(reinterpret_cast<__m256i*>(m_state[0]), s0);
+      _mm256_store_si256(reinterpret_cast<__m256i*>(m_state[1]), s1);
+      _mm256_store_si256(reinterpret_cast<__m256i*>(m_state[2]), s2);
+      _mm256_store_si256(reinterpret_cast<__m256i*>(m_state[3]), s3);
+    }
+#endif
+
+#if ENGINE_SIMD_SSE2
+    /**
+     * @brief Advances the streams; low receives words 0-3 (lanes 0-1), high words 4-7.
+     */
+    void nextWords(__m128i& low, __m128i& high) {
+#if ENGINE_SIMD_AVX2
+      __m256i words = nextWords8();
+      low = _mm256_castsi256_si128(words);
+      high = _mm256_extracti128_si256(words, 1);
+#else
+      low = nextWords2(0);
+      high = nextWords2(2);
+#endif
+    }
+
+    /**
+     * @brief Advances lanes firstLane and firstLane + 1 with SSE2.
+     */
+    __m128i nextWords2(int firstLane) {
+      __m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state[0] + firstLane));
+      __m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state[1] + firstLane));
+      __m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state[2] + firstLane));
+      __m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state[3] + firstLane));
+      __m128i times5 = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+      __m128i rotated = _mm_or_si128(_mm_slli_epi64(times5, 7), _mm_srli_epi64(times5, 57));
+      __m128i result = _mm_add_epi64(_mm_slli_epi64(rotated, 3), rotated);
+      __m128i t = _mm_slli_epi64(s1, 17);
+      s2 = _mm_xor_si128(s2, s0);
+      s3 = _mm_xor_si128(s3, s1);
+      s1 = _mm_xor_si128(s1, s2);
+      s0 = _mm_xor_si128(s0, s3);
+      s2 = _mm_xor_si128(s2, t);
+      s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+      _mm_store_si128(reinterpret_cast<__m128i*>(m_state[0] + firstLane), s0);
+      _mm_store_si128(reinterpret_cast<__m128i*>(m_state[1] + firstLane), s1);
+      _mm_store_si128(reinterpret_cast<__m128i*>(m_state[2] + firstLane), s2);
+      _mm_store_si128(reinterpret_cast<__m128i*>(m_state[3] + firstLane), s3);
+      return result;
+    }
+
+    /**
+     * @brief Four uniform floats in [0, 1) from four 32-bit words.
+     */
+    static __m128 toUnitFloat4(__m128i words) {
+      return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(words, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+    }
+
+    /**
+     * @brief Cosine and sine of a uniform azimuth, see unitVectorBlock.
+     */
+    static void azimuth4(__m128i words, __m128& cosine, __m128& sine) {
+      const __m128 quarterPi = _mm_set1_ps(0.78539816339744831f);
+      __m128 x = _mm_sub_ps(_mm_mul_ps(toUnitFloat4(words), _mm_set1_ps(1.5707963267948966f)), quarterPi);
+      __m128 x2 = _mm_mul_ps(x, x);
+      __m128 s = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(-1.0f / 5040.0f)), _mm_set1_ps(1.0f / 120.0f));
+      s = _mm_add_ps(_mm_mul_ps(s, x2), _mm_set1_ps(-1.0f / 6.0f));
+      s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, x2), x), x);
+      __m128 c = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(1.0f / 40320.0f)), _mm_set1_ps(-1.0f / 720.0f));
+      c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(1.0f / 24.0f));
+      c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(-0.5f));
+      c = _mm_add_ps(_mm_mul_ps(c, x2), _mm_set1_ps(1.0f));
+      // The low two bits pick the quarter turn: (c, s), (-s, c), (-c, -s), (s, -c).
+      __m128i quadrant = _mm_and_si128(words, _mm_set1_epi32(3));
+      __m128 swap = _mm_castsi128_ps(_mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(quadrant, _mm_set1_epi32(1))));
+      __m128 signX = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+      __m128 signY = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+      cosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), signX);
+      sine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), signY);
+    }
+
+    /**
+     * @brief Cube root of values in [0, 1): exponent estimate plus three Newton steps.
+     */
+    static __m128 cbrt4(__m128 value) {
+      // Dividing the bit pattern by 3 divides the exponent by 3 (Kahan's estimate);
+      // SSE2 has no integer divide, so the division happens in float.
+      __m128i bits = _mm_castps_si128(value);
+      __m128 estimate = _mm_castsi128_ps(_mm_add_epi32(
+        _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(bits), _mm_set1_ps(1.0f / 3.0f))),
+        _mm_set1_epi32(0x2A5137A0)));
+      const __m128 third = _mm_set1_ps(1.0f / 3.0f);
+      for (int i = 0; i < 3; ++i) {
+        __m128 quotient = _mm_div_ps(value, _mm_mul_ps(estimate, estimate));
+        estimate = _mm_mul_ps(_mm_add_ps(_mm_add_ps(estimate, estimate), quotient), third);
+      }
+      return estimate;
+    }
+#else
+    /**
+     * @brief Advances the four streams and writes their outputs as eight 32-bit words.
+     */
+    void nextWords(uint32_t* words) {
+      for (int lane = 0; lane < 4; ++lane) {
+        uint64_t s1 = m_state[1][lane];
+        uint64_t times5 = s1 * 5;
+        uint64_t result = ((times5 << 7) | (times5 >> 57)) * 9;
+        uint64_t t = s1 << 17;
+        m_state[2][lane] ^= m_state[0][lane];
+        m_state[3][lane] ^= s1;
+        m_state[1][lane] ^= m_state[2][lane];
+        m_state[0][lane] ^= m_state[3][lane];
+        m_state[2][lane] ^= t;
+        m_state[3][lane] = (m_state[3][lane] << 45) | (m_state[3][lane] >> 19);
+        words[lane * 2] = static_cast<uint32_t>(result);
+        words[lane * 2 + 1] = static_cast<uint32_t>(result >> 32);
+      }
+    }
+
+    /**
+     * @brief Scalar version of azimuth4.
+     */
+    static void azimuth(uint32_t word, float& cosine, float& sine) {
+      float x = uintToUnitFloat(word) * 1.5707963267948966f - 0.78539816339744831f;
+      float x2 = x * x;
+      float s = ((x2 * (-1.0f / 5040.0f) + 1.0f / 120.0f) * x2 + -1.0f / 6.0f) * x2 * x + x;
+      float c = (((x2 * (1.0f / 40320.0f) + -1.0f / 720.0f) * x2 + 1.0f / 24.0f) * x2 + -0.5f) * x2 + 1.0f;
+      uint32_t quadrant = word & 3u;
+      float swappedX = (quadrant & 1u) ? s : c;
+      float swappedY = (quadrant & 1u) ? c : s;
+      cosine = bitsAsFloat(floatAsBits(swappedX) ^ (((quadrant + 1u) & 2u) << 30));
+      sine = bitsAsFloat(floatAsBits(swappedY) ^ ((quadrant & 2u) << 30));
+    }
+#endif
+
+    /**
+     * @brief Writes eight 32-bit words from one step.
+     */
+    void step(uint32_t* output) {
+#if ENGINE_SIMD_AVX2
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), nextWords8());
+#elif ENGINE_SIMD_SSE2
+      __m128i low, high;
+      nextWords(low, high);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output), low);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4), high);
+#else
+      nextWords(output);
+#endif
+    }
+
+    /**
+     * @brief Eight uniform floats in [low, low + range) from one step.
+     */
+    void uniformBlock(float* output, float low, float range) {
+#if ENGINE_SIMD_AVX2
+      __m256 unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(nextWords8(), 8)),
+                                  _mm256_set1_ps(1.0f / 16777216.0f));
+      _mm256_storeu_ps(output, _mm256_add_ps(_mm256_mul_ps(unit, _mm256_set1_ps(range)), _mm256_set1_ps(low)));
+#elif ENGINE_SIMD_SSE2
+      __m128i wordsLow, wordsHigh;
+      nextWords(wordsLow, wordsHigh);
+      __m128 scale = _mm_set1_ps(range);
+      __m128 offset = _mm_set1_ps(low);
+      _mm_storeu_ps(output, _mm_add_ps(_mm_mul_ps(toUnitFloat4(wordsLow), scale), offset));
+      _mm_storeu_ps(output + 4, _mm_add_ps(_mm_mul_ps(toUnitFloat4(wordsHigh), scale), offset));
+#else
+      uint32_t words[8];
+      nextWords(words);
+      for (int k = 0; k < 8; ++k) {
+        output[k] = uintToUnitFloat(words[k]) * range + low;
+      }
+#endif
+    }
+
+    /**
+     * @brief Four unit vectors from one step (z from words 0-3, azimuth from words
+     * 4-7); with scaleByCbrt set, a second step's words 0-3 scale them by cbrt(u).
+     */
+    void unitVectorBlock(Vector3* output, bool scaleByCbrt) {
+#if ENGINE_SIMD_SSE2
+      __m128i zWords, azimuthWords;
+      nextWords(zWords, azimuthWords);
+      __m128 z = _mm_sub_ps(_mm_add_ps(toUnitFloat4(zWords), toUnitFloat4(zWords)), _mm_set1_ps(1.0f));
+      __m128 ring = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)), _mm_setzero_ps()));
+      __m128 cosine, sine;
+      azimuth4(azimuthWords, cosine, sine);
+      __m128 x = _mm_mul_ps(ring, cosine);
+      __m128 y = _mm_mul_ps(ring, sine);
+      if (scaleByCbrt) {
+        __m128i radiusWords, unused;
+        nextWords(radiusWords, unused);
+        __m128 radius = cbrt4(toUnitFloat4(radiusWords));
+        x = _mm_mul_ps(x, radius);
+        y = _mm_mul_ps(y, radius);
+        z = _mm_mul_ps(z, radius);
+      }
+      __m128 a, b, c;
+      SimdInterleave3(x, y, z, a, b, c);
+      float* out = &output[0].x;
+      _mm_storeu_ps(out, a);
+      _mm_storeu_ps(out + 4, b);
+      _mm_storeu_ps(out + 8, c);
+#else
+      uint32_t words[8];
+      nextWords(words);
+      float radius[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+      if (scaleByCbrt) {
+        uint32_t radiusWords[8];
+        nextWords(radiusWords);
+        for (int k = 0; k < 4; ++k) {
+          float u = uintToUnitFloat(radiusWords[k]);
+          float estimate = bitsAsFloat(static_cast<uint32_t>(static_cast<int32_t>(
+            static_cast<float>(floatAsBits(u)) * (1.0f / 3.0f))) + 0x2A5137A0u);
+          for (int i = 0; i < 3; ++i) {
+            estimate = (estimate + estimate + u / (estimate * estimate)) * (1.0f / 3.0f);
+          }
+          radius[k] = estimate;
+        }
+      }
+      for (int k = 0; k < 4; ++k) {
+        float z = uintToUnitFloat(words[k]) + uintToUnitFloat(words[k]) - 1.0f;
+        float ring = sqrt(EMax(1.0f - z * z, 0.0f));
+        float cosine, sine;
+        azimuth(words[k + 4], cosine, sine);
+        output[k] = Vector3(ring * cosine * radius[k], ring * sine * radius[k], z * radius[k]);
+      }
+#endif
+    }
+
+    /**
+     * @brief Eight points in a box from three steps (x, y and z words).
+     */
+    void boxBlock(Vector3* output, const Vector3& minimum, const Vector3& size) {
+#if ENGINE_SIMD_SSE2
+      __m128i xLow, xHigh, yLow, yHigh, zLow, zHigh;
+      nextWords(xLow, xHigh);
+      nextWords(yLow, yHigh);
+      nextWords(zLow, zHigh);
+      const __m128 minX = _mm_set1_ps(minimum.x), minY = _mm_set1_ps(minimum.y), minZ = _mm_set1_ps(minimum.z);
+      const __m128 sizeX = _mm_set1_ps(size.x), sizeY = _mm_set1_ps(size.y), sizeZ = _mm_set1_ps(size.z);
+      float* out = &output[0].x;
+      __m128 a, b, c;
+      SimdInterleave3(_mm_add_ps(_mm_mul_ps(toUnitFloat4(xLow), sizeX), minX),
+                      _mm_add_ps(_mm_mul_ps(toUnitFloat4(yLow), sizeY), minY),
+                      _mm_add_ps(_mm_mul_ps(toUnitFloat4(zLow), sizeZ), minZ), a, b, c);
+      _mm_storeu_ps(out, a);
+      _mm_storeu_ps(out + 4, b);
+      _mm_storeu_ps(out + 8, c);
+      SimdInterleave3(_mm_add_ps(_mm_mul_ps(toUnitFloat4(xHigh), sizeX), minX),
+                      _mm_add_ps(_mm_mul_ps(toUnitFloat4(yHigh), sizeY), minY),
+                      _mm_add_ps(_mm_mul_ps(toUnitFloat4(zHigh), sizeZ), minZ), a, b, c);
+      _mm_storeu_ps(out + 12, a);
+      _mm_storeu_ps(out + 16, b);
+      _mm_storeu_ps(out + 20, c);
+#else
+      uint32_t x[8], y[8], z[8];
+      nextWords(x);
+      nextWords(y);
+      nextWords(z);
+      for (int k = 0; k < 8; ++k) {
+        output[k] = Vector3(uintToUnitFloat(x[k]) * size.x + minimum.x,
+                            uintToUnitFloat(y[k]) * size.y + minimum.y,
+                            uintToUnitFloat(z[k]) * size.z + minimum.z);
+      }
+#endif
+    }
+
+    /**
+     * @brief Four points in a disk from one step (radius words 0-3, azimuth words 4-7).
+     */
+    void diskBlock(Vector2* output, const Vector2& center, float radius) {
+#if ENGINE_SIMD_SSE2
+      __m128i radiusWords, azimuthWords;
+      nextWords(radiusWords, azimuthWords);
+      __m128 distance = _mm_mul_ps(_mm_sqrt_ps(toUnitFloat4(radiusWords)), _mm_set1_ps(radius));
+      __m128 cosine, sine;
+      azimuth4(azimuthWords, cosine, sine);
+      __m128 x = _mm_add_ps(_mm_mul_ps(distance, cosine), _mm_set1_ps(center.x));
+      __m128 y = _mm_add_ps(_mm_mul_ps(distance, sine), _mm_set1_ps(center.y));
+      float* out = &output[0].x;
+      _mm_storeu_ps(out, _mm_unpacklo_ps(x, y));
+      _mm_storeu_ps(out + 4, _mm_unpackhi_ps(x, y));
+#else
+      uint32_t words[8];
+      nextWords(words);
+      for (int k = 0; k < 4; ++k) {
+        float distance = sqrt(uintToUnitFloat(words[k])) * radius;
+        float cosine, sine;
+        azimuth(words[k + 4], cosine, sine);
+        output[k] = Vector2(distance * cosine + center.x, distance * sine + center.y);
+      }
+#endif
+    }
+
+    alignas(32) uint64_t m_state[4][4]; ///< State word w of stream l at [w][l] (SoA).
+  };
+}
@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+
+/**
+ * @file SIMD.h
+ * @brief Compile-time detection of the SIMD instruction sets available to EngineUtilities.
+ *
+ * Each ENGINE_SIMD_* macro is defined to 1 when the compiler is allowed to emit that
+ * instruction set (from /arch on MSVC or -m flags on GCC/Clang), and to 0 otherwise.
+ * Define ENGINE_NO_SIMD before including any EngineUtilities header to force the scalar paths.
+ */
+
+#if !defined(ENGINE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ENGINE_SIMD_SSE2 1
+#else
+#define ENGINE_SIMD_SSE2 0
+#endif
+
+#if ENGINE_SIMD_SSE2 && (defined(__SSE4_1__) || defined(__AVX__))
+#define ENGINE_SIMD_SSE41 1
+#else
+#define ENGINE_SIMD_SSE41 0
+#endif
+
+#if ENGINE_SIMD_SSE2 && defined(__AVX2__)
+#define ENGINE_SIMD_AVX2 1
+#else
+#define ENGINE_SIMD_AVX2 0
+#endif
+
+// F16C (half-float conversion) ships with every AVX2 CPU; MSVC exposes it under /arch:AVX2,
+// GCC and Clang only with -mf16c or a -march that includes it.
+#if ENGINE_SIMD_AVX2 && (defined(__F16C__) || defined(_MSC_VER))
+#define ENGINE_SIMD_F16C 1
+#else
+#define ENGINE_SIMD_F16C 0
+#endif
+
+#if ENGINE_SIMD_AVX2
+#include <immintrin.h>
+#elif ENGINE_SIMD_SSE41
+#include <smmintrin.h>
+#elif ENGINE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * ENGINE_CONSTANT_EVALUATED() is true while the compiler evaluates a constant expression.
+ * constexpr functions test it to skip their intrinsic paths, which cannot run at compile
+ * time, and fall through to their scalar code. Compilers without the builtin get false,
+ * so they keep the fast runtime paths but cannot use those functions in constant expressions.
+ */
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define ENGINE_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define ENGINE_CONSTANT_EVALUATED() false
+#endif
+
+namespace EngineUtilities {
+  /**
+   * @brief Returns the index of the lowest set bit.
+   *
+   * @param value A non-zero 32-bit mask.
+   * @return The zero-based index of the least significant set bit.
+   */
+  inline uint32_t CountTrailingZeros(uint32_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+  }
+
+#if ENGINE_SIMD_SSE2
+  /**
+   * @brief Reorders the lanes of a vector: result = (v[X], v[Y], v[Z], v[W]).
+   */
+  template<int X, int Y, int Z, int W>
+  inline __m128 SimdSwizzle(__m128 v) {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+  }
+
+  /**
+   * @brief Picks two lanes from each vector: result = (a[X], a[Y], b[Z], b[W]).
+   */
+  template<int X, int Y, int Z, int W>
+  inline __m128 SimdShuffle(__m128 a, __m128 b) {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+  }
+
+  /**
+   * @brief Sum of the four lanes, broadcast to every lane.
+   */
+  inline __m128 SimdHorizontalSum(__m128 v) {
+    __m128 pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    return _mm_add_ps(SimdSwizzle<0, 0, 0, 0>(pairs), SimdSwizzle<1, 1, 1, 1>(pairs));
+  }
+
+  /**
+   * @brief Splits four packed float3s into x, y and z registers.
+   *
+   * The input is a = [x0 y0 z0 x1], b = [y1 z1 x2 y2], c = [z2 x3 y3 z3], which is
+   * what three consecutive loads from a tightly packed float3 array produce.
+   */
+  inline void SimdDeinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) {
+    x = SimdShuffle<0, 3, 0, 2>(a, SimdShuffle<2, 2, 1, 1>(b, c));
+    y = SimdShuffle<0, 2, 0, 2>(SimdShuffle<1, 1, 0, 0>(a, b), SimdShuffle<3, 3, 2, 2>(b, c));
+    z = SimdShuffle<0, 2, 0, 2>(SimdShuffle<2, 2, 1, 1>(a, b), SimdShuffle<0, 0, 3, 3>(c, c));
+  }
+
+  /**
+   * @brief Inverse of SimdDeinterleave3: packs x, y and z registers into four float3s.
+   */
+  inline void SimdInterleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) {
+    __m128 xyLow = _mm_unpacklo_ps(x, y);
+    __m128 xyHigh = _mm_unpackhi_ps(x, y);
+    a = SimdShuffle<0, 1, 0, 2>(xyLow, SimdShuffle<0, 0, 1, 1>(z, x));
+    b = SimdShuffle<0, 2, 0, 1>(SimdShuffle<1, 1, 1, 1>(y, z), xyHigh);
+    c = SimdShuffle<0, 2, 0, 2>(SimdShuffle<2, 2, 3, 3>(z, x), SimdShuffle<3, 3, 3, 3>(y, z));
+  }
+#endif
+}
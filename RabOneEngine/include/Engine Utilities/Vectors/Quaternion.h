@@ -28,8 +28,10 @@
 */
 #pragma once
 
-#include "Utilities/EngineMath.h"
+#include <cstddef>
+#include "Engine Utilities/Utilities/EngineMath.h"
 #include "Vector3.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
 namespace EngineUtilities {
 	/**
  * @brief A quaternion class.
@@ -49,7 +51,7 @@ namespace EngineUtilities {
 		 *
 		 * Initializes the quaternion to (1, 0, 0, 0).
 		 */
-		Quaternion() : w(1), x(0), y(0), z(0) {}
+		constexpr Quaternion() : w(1), x(0), y(0), z(0) {}
 
 		/**
 		 * @brief Parameterized constructor.
@@ -61,7 +63,7 @@ namespace EngineUtilities {
 		 * @param y The j component.
 		 * @param z The k component.
 		 */
-		Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
+		constexpr Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
 
 		/**
 		 * @brief Adds another quaternion to this quaternion.
@@ -69,7 +71,7 @@ namespace EngineUtilities {
 		 * @param other The quaternion to add.
 		 * @return The result of the addition.
 		 */
-		Quaternion operator+(const Quaternion& other) const {
+		constexpr Quaternion operator+(const Quaternion& other) const {
 			return Quaternion(w + other.w, x + other.x, y + other.y, z + other.z);
 		}
 
@@ -79,7 +81,7 @@ namespace EngineUtilities {
 		 * @param other The quaternion to subtract.
 		 * @return The result of the subtraction.
 		 */
-		Quaternion operator-(const Quaternion& other) const {
+		constexpr Quaternion operator-(const Quaternion& other) const {
 			return Quaternion(w - other.w, x - other.x, y - other.y, z - other.z);
 		}
 
@@ -89,7 +91,7 @@ namespace EngineUtilities {
 		 * @param scalar The scalar to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Quaternion operator*(float scalar) const {
+		constexpr Quaternion operator*(float scalar) const {
 			return Quaternion(w * scalar, x * scalar, y * scalar, z * scalar);
 		}
 
@@ -99,7 +101,7 @@ namespace EngineUtilities {
 		 * @param other The quaternion to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Quaternion operator*(const Quaternion& other) const {
+		constexpr Quaternion operator*(const Quaternion& other) const {
 			return Quaternion(
 				w * other.w - x * other.x - y * other.y - z * other.z,
 				w * other.x + x * other.w + y * other.z - z * other.y,
@@ -114,7 +116,7 @@ namespace EngineUtilities {
 		 * @param other The quaternion to compare with.
 		 * @return True if the quaternions are equal, false otherwise.
 		 */
-		bool operator==(const Quaternion& other) const {
+		constexpr bool operator==(const Quaternion& other) const {
 			return (w == other.w && x == other.x && y == other.y && z == other.z);
 		}
 
@@ -124,7 +126,7 @@ namespace EngineUtilities {
 		 * @param other The quaternion to compare with.
 		 * @return True if the quaternions are not equal, false otherwise.
 		 */
-		bool operator!=(const Quaternion& other) const {
+		constexpr bool operator!=(const Quaternion& other) const {
 			return !(*this == other);
 		}
 
@@ -133,7 +135,7 @@ namespace EngineUtilities {
 		 *
 		 * @return The magnitude of the quaternion.
 		 */
-		float magnitude() const {
+		constexpr float magnitude() const {
 			return EngineUtilities::sqrt(w * w + x * x + y * y + z * z);
 		}
 
@@ -142,7 +144,7 @@ namespace EngineUtilities {
 		 *
 		 * @return The normalized quaternion.
 		 */
-		Quaternion normalize() const {
+		constexpr Quaternion normalize() const {
 			float mag = magnitude();
 			if (mag == 0) {
 				return Quaternion(1, 0, 0, 0);
@@ -155,7 +157,7 @@ namespace EngineUtilities {
 		 *
 		 * @return The conjugated quaternion.
 		 */
-		Quaternion conjugate() const {
+		constexpr Quaternion conjugate() const {
 			return Quaternion(w, -x, -y, -z);
 		}
 
@@ -164,7 +166,7 @@ namespace EngineUtilities {
 		 *
 		 * @return The inverted quaternion.
 		 */
-		Quaternion inverse() const {
+		constexpr Quaternion inverse() const {
 			float magSquared = w * w + x * x + y * y + z * z;
 			if (magSquared == 0) {
 				// Handling division by zero
@@ -173,16 +175,30 @@ namespace EngineUtilities {
 			return conjugate() * (1.0f / magSquared);
 		}
 
+		/**
+		 * @brief Computes the 4D dot product with another quaternion.
+		 *
+		 * @param other The other quaternion.
+		 * @return The dot product.
+		 */
+		constexpr float dot(const Quaternion& other) const {
+			return w * other.w + x * other.x + y * other.y + z * other.z;
+		}
+
 		/**
 		 * @brief Rotates a vector by this quaternion.
 		 *
+		 * Uses v + 2w(u x v) + 2u x (u x v), with u = (x, y, z), which costs two cross
+		 * products instead of the two full products and the division of q * v * q^-1.
+		 * The quaternion must be normalized.
+		 *
 		 * @param v The vector to rotate.
 		 * @return The rotated vector.
 		 */
-		Vector3 rotate(const Vector3& v) const {
-			Quaternion qv(0, v.x, v.y, v.z);
-			Quaternion result = (*this) * qv * this->inverse();
-			return Vector3(result.x, result.y, result.z);
+		constexpr Vector3 rotate(const Vector3& v) const {
+			Vector3 u(x, y, z);
+			Vector3 t = u.cross(v) * 2.0f;
+			return v + t * w + u.cross(t);
 		}
 
 		/**
@@ -193,10 +209,10 @@ namespace EngineUtilities {
 		 * @return The quaternion representing the rotation.
 		 */
 		static Quaternion fromAxisAngle(const Vector3& axis, float angle) {
-			float halfAngle = angle * 0.5f;
-			float sinHalfAngle = EngineUtilities::sin(halfAngle);
+			float sinHalfAngle, cosHalfAngle;
+			EngineUtilities::sincos(angle * 0.5f, sinHalfAngle, cosHalfAngle);
 			return Quaternion(
-				EngineUtilities::cos(halfAngle),
+				cosHalfAngle,
 				axis.x * sinHalfAngle,
 				axis.y * sinHalfAngle,
 				axis.z * sinHalfAngle
@@ -204,32 +220,356 @@ namespace EngineUtilities {
 		}
 
 		/**
-		 * @brief Returns a pointer to the quaternion's data.
+		 * @brief Constructs a quaternion from Euler angles: roll (Z), then pitch (X), then yaw (Y).
 		 *
-		 * @return Pointer to the first element (w, x, y, z).
+		 * Produces the same rotation as Matrix4x4::rotationRollPitchYaw.
+		 *
+		 * @param pitch Rotation about X in radians.
+		 * @param yaw Rotation about Y in radians.
+		 * @param roll Rotation about Z in radians.
+		 * @return The quaternion representing the rotation.
 		 */
-		const float* data() const {
-			return &w;
+		static Quaternion fromEuler(float pitch, float yaw, float roll) {
+			float sp, cp, sy, cy, sr, cr;
+			EngineUtilities::sincos(pitch * 0.5f, sp, cp);
+			EngineUtilities::sincos(yaw * 0.5f, sy, cy);
+			EngineUtilities::sincos(roll * 0.5f, sr, cr);
+			return Quaternion(
+				cy * cp * cr + sy * sp * sr,
+				cy * sp * cr + sy * cp * sr,
+				sy * cp * cr - cy * sp * sr,
+				cy * cp * sr - sy * sp * cr
+			);
+		}
+
+		/**
+		 * @brief Constructs a quaternion from Euler angles stored as (pitch, yaw, roll).
+		 *
+		 * @param rotation Euler angles in radians, laid out like Transform::rotation.
+		 * @return The quaternion representing the rotation.
+		 */
+		static Quaternion fromEuler(const Vector3& rotation) {
+			return fromEuler(rotation.x, rotation.y, rotation.z);
+		}
+
+		/**
+		 * @brief Extracts the rotation of a matrix.
+		 *
+		 * The upper 3x3 block must be a pure rotation; remove any scale first
+		 * (for example with Matrix4x4::decompose).
+		 *
+		 * @param matrix The rotation matrix (row-vector convention).
+		 * @return The normalized quaternion representing the rotation.
+		 */
+		static Quaternion fromMatrix(const Matrix4x4& matrix) {
+			const float (&m)[4][4] = matrix.m;
+			float trace = m[0][0] + m[1][1] + m[2][2];
+			Quaternion result;
+			// Branch on the largest diagonal term so the square root never sees a tiny value.
+			if (trace > 0.0f) {
+				float s = 0.5f * EngineUtilities::rsqrt(trace + 1.0f);
+				result = Quaternion(0.25f / s, (m[1][2] - m[2][1]) * s, (m[2][0] - m[0][2]) * s, (m[0][1] - m[1][0]) * s);
+			}
+			else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+				float s = 0.5f * EngineUtilities::rsqrt(1.0f + m[0][0] - m[1][1] - m[2][2]);
+				result = Quaternion((m[1][2] - m[2][1]) * s, 0.25f / s, (m[0][1] + m[1][0]) * s, (m[2][0] + m[0][2]) * s);
+			}
+			else if (m[1][1] > m[2][2]) {
+				float s = 0.5f * EngineUtilities::rsqrt(1.0f + m[1][1] - m[0][0] - m[2][2]);
+				result = Quaternion((m[2][0] - m[0][2]) * s, (m[0][1] + m[1][0]) * s, 0.25f / s, (m[1][2] + m[2][1]) * s);
+			}
+			else {
+				float s = 0.5f * EngineUtilities::rsqrt(1.0f + m[2][2] - m[0][0] - m[1][1]);
+				result = Quaternion((m[0][1] - m[1][0]) * s, (m[2][0] + m[0][2]) * s, (m[1][2] + m[2][1]) * s, 0.25f / s);
+			}
+			return result.normalize();
 		}
 
 		/**
 		 * @brief Converts the quaternion to a 4x4 rotation matrix.
 		 *
+		 * The matrix follows the row-vector convention of Matrix4x4, so
+		 * toMatrix().transformVector(v) equals rotate(v). The quaternion must be normalized.
+		 *
 		 * @return The 4x4 matrix representing the rotation.
 		 */
-		/*Matrix4x4 toMatrix() const {
-			Matrix4x4 result;
-			result[0][0] = 1 - 2 * (y * y + z * z);
-			result[0][1] = 2 * (x * y - z * w);
-			result[0][2] = 2 * (x * z + y * w);
-			result[1][0] = 2 * (x * y + z * w);
-			result[1][1] = 1 - 2 * (x * x + z * z);
-			result[1][2] = 2 * (y * z - x * w);
-			result[2][0] = 2 * (x * z - y * w);
-			result[2][1] = 2 * (y * z + x * w);
-			result[2][2] = 1 - 2 * (x * x + y * y);
-			result[3][3] = 1;
-			return result;
-		}*/
+		constexpr Matrix4x4 toMatrix() const {
+			float x2 = x + x, y2 = y + y, z2 = z + z;
+			float xx = x * x2, yy = y * y2, zz = z * z2;
+			float xy = x * y2, xz = x * z2, yz = y * z2;
+			float wx = w * x2, wy = w * y2, wz = w * z2;
+			return Matrix4x4(
+				1.0f - yy - zz, xy + wz, xz - wy, 0.0f,
+				xy - wz, 1.0f - xx - zz, yz + wx, 0.0f,
+				xz + wy, yz - wx, 1.0f - xx - yy, 0.0f,
+				0.0f, 0.0f, 0.0f, 1.0f);
+		}
+
+		/**
+		 * @brief Normalized linear interpolation along the shortest arc.
+		 *
+		 * Cheaper than slerp and exact at t = 0 and t = 1, but the angular speed is not
+		 * constant; the deviation from slerp grows with the angle between the inputs.
+		 *
+		 * @param from The start rotation (normalized).
+		 * @param to The end rotation (normalized).
+		 * @param t Interpolation factor in [0, 1].
+		 * @return The interpolated, normalized quaternion.
+		 */
+		static constexpr Quaternion nlerp(const Quaternion& from, const Quaternion& to, float t) {
+			Quaternion end = from.dot(to) < 0.0f ? to * -1.0f : to;
+			return (from + (end - from) * t).normalize();
+		}
+
+		/**
+		 * @brief Spherical linear interpolation along the shortest arc.
+		 *
+		 * The angle comes from 2 * atan2(|a - b|, |a + b|) instead of acos(dot), which
+		 * keeps full precision when the inputs are almost equal. Below an angle of
+		 * about 1e-4 radians it falls back to nlerp, which is then exact in float.
+		 *
+		 * @param from The start rotation (normalized).
+		 * @param to The end rotation (normalized).
+		 * @param t Interpolation factor in [0, 1].
+		 * @return The interpolated quaternion.
+		 */
+		static Quaternion slerp(const Quaternion& from, const Quaternion& to, float t) {
+			Quaternion end = from.dot(to) < 0.0f ? to * -1.0f : to;
+			float angle = 2.0f * EngineUtilities::atan2((end - from).magnitude(), (end + from).magnitude());
+			float sinAngle = EngineUtilities::sin(angle);
+			if (sinAngle < 1e-4f) {
+				return nlerp(from, end, t);
+			}
+			float invSin = 1.0f / sinAngle;
+			return from * (EngineUtilities::sin((1.0f - t) * angle) * invSin) +
+				end * (EngineUtilities::sin(t * angle) * invSin);
+		}
+
+		/**
+		 * @brief Approximate slerp without trigonometry.
+		 *
+		 * Evaluates the slerp weights with an 8-term polynomial in cos(angle) and t
+		 * (Eberly, "A Fast and Accurate Algorithm for Computing SLERP"). The weights
+		 * stay within 2e-5 of the exact ones along the shortest arc, and the code is
+		 * branch free, which is what the batch version vectorizes.
+		 *
+		 * @param from The start rotation (normalized).
+		 * @param to The end rotation (normalized).
+		 * @param t Interpolation factor in [0, 1].
+		 * @return The interpolated quaternion.
+		 */
+		static constexpr Quaternion slerpFast(const Quaternion& from, const Quaternion& to, float t) {
+			float cosAngle = from.dot(to);
+			float sign = cosAngle < 0.0f ? -1.0f : 1.0f;
+			float weightFrom = 0.0f;
+			float weightTo = 0.0f;
+			slerpWeights(cosAngle * sign, t, weightFrom, weightTo);
+			return from * weightFrom + to * (weightTo * sign);
+		}
+
+		/**
+		 * @brief Returns a pointer to the quaternion's data.
+		 *
+		 * @return Pointer to the first element (w, x, y, z).
+		 */
+		constexpr const float* data() const {
+			return &w;
+		}
+
+		/**
+		 * @brief Coefficients of the slerpFast polynomial: u[i] = 1 / (i (2i + 1)) and
+		 * v[i] = i / (2i + 1) for i = 1..8, with the last term scaled to minimize the
+		 * truncation error.
+		 */
+		struct SlerpCoefficients {
+			static constexpr float OnePlusMu = 1.85298109240830f;
+			static constexpr float u[8] = {
+				1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+				1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), OnePlusMu / (8 * 17)
+			};
+			static constexpr float v[8] = {
+				1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+				5.0f / 11, 6.0f / 13, 7.0f / 15, OnePlusMu * 8 / 17
+			};
+		};
+
+	private:
+		/**
+		 * @brief Computes the two slerpFast weights for a non-negative cos(angle).
+		 */
+		static constexpr void slerpWeights(float cosAngle, float t, float& weightFrom, float& weightTo) {
+			float xm1 = cosAngle - 1.0f;
+			float d = 1.0f - t;
+			float sqrT = t * t;
+			float sqrD = d * d;
+			float seriesT = 1.0f;
+			float seriesD = 1.0f;
+			for (int i = 7; i >= 0; --i) {
+				seriesT = 1.0f + (SlerpCoefficients::u[i] * sqrT - SlerpCoefficients::v[i]) * xm1 * seriesT;
+				seriesD = 1.0f + (SlerpCoefficients::u[i] * sqrD - SlerpCoefficients::v[i]) * xm1 * seriesD;
+			}
+			weightFrom = d * seriesD;
+			weightTo = t * seriesT;
+		}
 	};
+
+	static_assert(sizeof(Quaternion) == 16, "Quaternion must stay four packed floats (w, x, y, z)");
+
+#if ENGINE_SIMD_SSE2
+	/**
+	 * @brief Loads four quaternions and transposes them into w, x, y and z registers.
+	 */
+	inline void loadQuaternions4(const Quaternion* q, __m128& w, __m128& x, __m128& y, __m128& z) {
+		w = _mm_loadu_ps(q[0].data());
+		x = _mm_loadu_ps(q[1].data());
+		y = _mm_loadu_ps(q[2].data());
+		z = _mm_loadu_ps(q[3].data());
+		_MM_TRANSPOSE4_PS(w, x, y, z);
+	}
+
+	/**
+	 * @brief Transposes w, x, y and z registers back and stores four quaternions.
+	 */
+	inline void storeQuaternions4(Quaternion* q, __m128 w, __m128 x, __m128 y, __m128 z) {
+		_MM_TRANSPOSE4_PS(w, x, y, z);
+		_mm_storeu_ps(&q[0].w, w);
+		_mm_storeu_ps(&q[1].w, x);
+		_mm_storeu_ps(&q[2].w, y);
+		_mm_storeu_ps(&q[3].w, z);
+	}
+#endif
+
+	/**
+	 * @brief Rotates each input vector by the matching quaternion.
+	 *
+	 * Four pairs at a time with SSE (quaternions and vectors are transposed to SoA),
+	 * then one at a time. In-place operation (output == input) is allowed.
+	 *
+	 * @param rotations Normalized quaternions, one per vector.
+	 * @param input The vectors to rotate.
+	 * @param output Receives the rotated vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void rotate(const Quaternion* rotations, const Vector3* input, Vector3* output, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_SSE2
+		const __m128 two = _mm_set1_ps(2.0f);
+		for (; i + 4 <= count; i += 4) {
+			__m128 qw, qx, qy, qz;
+			loadQuaternions4(rotations + i, qw, qx, qy, qz);
+			const float* in = &input[i].x;
+			__m128 vx, vy, vz;
+			SimdDeinterleave3(_mm_loadu_ps(in), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), vx, vy, vz);
+			// t = 2 (u x v)
+			__m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy)));
+			__m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz)));
+			__m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx)));
+			// v + w t + u x t
+			__m128 rx = _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(qw, tx)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+			__m128 ry = _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(qw, ty)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+			__m128 rz = _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(qw, tz)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+			__m128 a, b, c;
+			SimdInterleave3(rx, ry, rz, a, b, c);
+			float* out = &output[i].x;
+			_mm_storeu_ps(out, a);
+			_mm_storeu_ps(out + 4, b);
+			_mm_storeu_ps(out + 8, c);
+		}
+#endif
+		for (; i < count; ++i) {
+			output[i] = rotations[i].rotate(input[i]);
+		}
+	}
+
+	/**
+	 * @brief Runs Quaternion::nlerp on each pair of inputs with a shared factor.
+	 *
+	 * Four pairs at a time with SSE, normalizing with the refined rsqrt estimate
+	 * (about 1e-7 relative error), then one at a time.
+	 *
+	 * @param from The start rotations.
+	 * @param to The end rotations.
+	 * @param t Interpolation factor in [0, 1].
+	 * @param output Receives the interpolated rotations; may alias from or to.
+	 * @param count Number of pairs.
+	 */
+	inline void nlerp(const Quaternion* from, const Quaternion* to, float t, Quaternion* output, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_SSE2
+		const __m128 factor = _mm_set1_ps(t);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		for (; i + 4 <= count; i += 4) {
+			__m128 aw, ax, ay, az, bw, bx, by, bz;
+			loadQuaternions4(from + i, aw, ax, ay, az);
+			loadQuaternions4(to + i, bw, bx, by, bz);
+			__m128 cosAngle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)),
+				_mm_add_ps(_mm_mul_ps(ay, by), _mm_mul_ps(az, bz)));
+			__m128 sign = _mm_and_ps(cosAngle, signMask);
+			__m128 rw = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bw, sign), aw), factor));
+			__m128 rx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bx, sign), ax), factor));
+			__m128 ry = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(by, sign), ay), factor));
+			__m128 rz = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bz, sign), az), factor));
+			__m128 invLength = rsqrt4(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rw, rw), _mm_mul_ps(rx, rx)),
+				_mm_add_ps(_mm_mul_ps(ry, ry), _mm_mul_ps(rz, rz))));
+			storeQuaternions4(output + i, _mm_mul_ps(rw, invLength), _mm_mul_ps(rx, invLength),
+				_mm_mul_ps(ry, invLength), _mm_mul_ps(rz, invLength));
+		}
+#endif
+		for (; i < count; ++i) {
+			output[i] = Quaternion::nlerp(from[i], to[i], t);
+		}
+	}
+
+	/**
+	 * @brief Runs Quaternion::slerpFast on each pair of inputs with a shared factor.
+	 *
+	 * The weights depend on t only through t^2 and (1 - t)^2, so those are hoisted out
+	 * of the loop; four pairs go through the polynomial per SSE iteration.
+	 *
+	 * @param from The start rotations.
+	 * @param to The end rotations.
+	 * @param t Interpolation factor in [0, 1].
+	 * @param output Receives the interpolated rotations; may alias from or to.
+	 * @param count Number of pairs.
+	 */
+	inline void slerpFast(const Quaternion* from, const Quaternion* to, float t, Quaternion* output, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_SSE2
+		const float d = 1.0f - t;
+		__m128 termT[8], termD[8];
+		for (int k = 0; k < 8; ++k) {
+			termT[k] = _mm_set1_ps(Quaternion::SlerpCoefficients::u[k] * t * t - Quaternion::SlerpCoefficients::v[k]);
+			termD[k] = _mm_set1_ps(Quaternion::SlerpCoefficients::u[k] * d * d - Quaternion::SlerpCoefficients::v[k]);
+		}
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 factorT = _mm_set1_ps(t);
+		const __m128 factorD = _mm_set1_ps(d);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		for (; i + 4 <= count; i += 4) {
+			__m128 aw, ax, ay, az, bw, bx, by, bz;
+			loadQuaternions4(from + i, aw, ax, ay, az);
+			loadQuaternions4(to + i, bw, bx, by, bz);
+			__m128 cosAngle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)),
+				_mm_add_ps(_mm_mul_ps(ay, by), _mm_mul_ps(az, bz)));
+			__m128 sign = _mm_and_ps(cosAngle, signMask);
+			__m128 xm1 = _mm_sub_ps(_mm_xor_ps(cosAngle, sign), one);
+			__m128 seriesT = one;
+			__m128 seriesD = one;
+			for (int k = 7; k >= 0; --k) {
+				seriesT = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(termT[k], xm1), seriesT));
+				seriesD = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(termD[k], xm1), seriesD));
+			}
+			__m128 weightFrom = _mm_mul_ps(factorD, seriesD);
+			__m128 weightTo = _mm_xor_ps(_mm_mul_ps(factorT, seriesT), sign);
+			storeQuaternions4(output + i,
+				_mm_add_ps(_mm_mul_ps(aw, weightFrom), _mm_mul_ps(bw, weightTo)),
+				_mm_add_ps(_mm_mul_ps(ax, weightFrom), _mm_mul_ps(bx, weightTo)),
+				_mm_add_ps(_mm_mul_ps(ay, weightFrom), _mm_mul_ps(by, weightTo)),
+				_mm_add_ps(_mm_mul_ps(az, weightFrom), _mm_mul_ps(bz, weightTo)));
+		}
+#endif
+		for (; i < count; ++i) {
+			output[i] = Quaternion::slerpFast(from[i], to[i], t);
+		}
+	}
 }
@@ -48,7 +48,7 @@ namespace EngineUtilities {
 		 *
 		 * Initializes the vector to (0, 0, 0).
 		 */
-		Vector3() : x(0), y(0), z(0) {}
+		constexpr Vector3() : x(0), y(0), z(0) {}
 
 		/**
 		 * @brief Parameterized constructor.
@@ -59,7 +59,7 @@ namespace EngineUtilities {
 		 * @param y The y-coordinate.
 		 * @param z The z-coordinate.
 		 */
-		Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+		constexpr Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
 
 		/**
 		 * @brief Adds another vector to this vector.
@@ -67,7 +67,7 @@ namespace EngineUtilities {
 		 * @param other The vector to add.
 		 * @return The result of the addition.
 		 */
-		Vector3 operator+(const Vector3& other) const {
+		constexpr Vector3 operator+(const Vector3& other) const {
 			return Vector3(x + other.x, y + other.y, z + other.z);
 		}
 
@@ -77,7 +77,7 @@ namespace EngineUtilities {
 		 * @param other The vector to subtract.
 		 * @return The result of the subtraction.
 		 */
-		Vector3 operator-(const Vector3& other) const {
+		constexpr Vector3 operator-(const Vector3& other) const {
 			return Vector3(x - other.x, y - other.y, z - other.z);
 		}
 
@@ -87,16 +87,36 @@ namespace EngineUtilities {
 		 * @param scalar The scalar to multiply by.
 		 * @return The result of the multiplication.
 		 */
-		Vector3 operator*(float scalar) const {
+		constexpr Vector3 operator*(float scalar) const {
 			return Vector3(x * scalar, y * scalar, z * scalar);
 		}
 
+		/**
+		 * @brief Computes the dot product with another vector.
+		 *
+		 * @param other The other vector.
+		 * @return The dot product.
+		 */
+		constexpr float dot(const Vector3& other) const {
+			return x * other.x + y * other.y + z * other.z;
+		}
+
+		/**
+		 * @brief Computes the cross product with another vector.
+		 *
+		 * @param other The other vector.
+		 * @return This vector crossed with other.
+		 */
+		constexpr Vector3 cross(const Vector3& other) const {
+			return Vector3(y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x);
+		}
+
 		/**
 		 * @brief Calculates the magnitude (length) of the vector.
 		 *
 		 * @return The magnitude of the vector.
 		 */
-		float magnitude() const {
+		constexpr float magnitude() const {
 			return EngineUtilities::sqrt(x * x + y * y + z * z);
 		}
 
@@ -105,7 +125,7 @@ namespace EngineUtilities {
 		 *
 		 * @return The normalized vector.
 		 */
-		Vector3 normalize() const {
+		constexpr Vector3 normalize() const {
 			float mag = magnitude();
 			if (mag == 0) {
 				return Vector3(0, 0, 0);
@@ -115,7 +135,101 @@ namespace EngineUtilities {
 
 		// Mtodo para obtener un puntero a los datos como un arreglo
 		// @return: Puntero a los componentes del vector
-		float* data() { return &x; }
-		const float* data() const { return &x; }
+		constexpr float* data() { return &x; }
+		constexpr const float* data() const { return &x; }
 	};
+
+	static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be tightly packed for the batch kernels");
+
+#if ENGINE_SIMD_SSE2
+	/**
+	 * @brief Normalizes four packed Vector3s held in three registers.
+	 *
+	 * a = [x0 y0 z0 x1], b = [y1 z1 x2 y2], c = [z2 x3 y3 z3]. The squared lengths
+	 * are gathered with shuffles, and the per-vector scale is spread back over the
+	 * same AoS layout, so the data is never fully transposed.
+	 */
+	inline void normalizePacked4(__m128& a, __m128& b, __m128& c) {
+		__m128 vx, vy, vz;
+		SimdDeinterleave3(a, b, c, vx, vy, vz);
+		__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+		__m128 scale = _mm_and_ps(rsqrt4(lengthSq), _mm_cmpgt_ps(lengthSq, _mm_setzero_ps()));
+		a = _mm_mul_ps(a, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(1, 0, 0, 0)));
+		b = _mm_mul_ps(b, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(2, 2, 1, 1)));
+		c = _mm_mul_ps(c, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(3, 3, 3, 2)));
+	}
+#endif
+
+#if ENGINE_SIMD_AVX2
+	/**
+	 * @brief Eight-vector version of normalizePacked4.
+	 *
+	 * Each 128-bit lane holds one group of four vectors in the same layout as
+	 * normalizePacked4, so the in-lane shuffles are identical.
+	 */
+	inline void normalizePacked8(__m256& a, __m256& b, __m256& c) {
+		__m256 vx = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		__m256 vy = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+		                              _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 vz = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+		                              _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		__m256 lengthSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)),
+		                                _mm256_mul_ps(vz, vz));
+		__m256 scale = _mm256_and_ps(rsqrt8(lengthSq), _mm256_cmp_ps(lengthSq, _mm256_setzero_ps(), _CMP_GT_OQ));
+		a = _mm256_mul_ps(a, _mm256_shuffle_ps(scale, scale, _MM_SHUFFLE(1, 0, 0, 0)));
+		b = _mm256_mul_ps(b, _mm256_shuffle_ps(scale, scale, _MM_SHUFFLE(2, 2, 1, 1)));
+		c = _mm256_mul_ps(c, _mm256_shuffle_ps(scale, scale, _MM_SHUFFLE(3, 3, 3, 2)));
+	}
+#endif
+
+	/**
+	 * @brief Normalizes an array of vectors.
+	 *
+	 * Uses rsqrt with one Newton-Raphson step (relative error below 5e-7) instead
+	 * of a division per component. Zero-length vectors become (0, 0, 0), matching
+	 * Vector3::normalize. Input and output may be the same array.
+	 *
+	 * @param vectors The vectors to normalize.
+	 * @param results Receives the normalized vectors.
+	 * @param count Number of vectors.
+	 */
+	inline void normalize(const Vector3* vectors, Vector3* results, size_t count) {
+		size_t i = 0;
+#if ENGINE_SIMD_AVX2
+		for (; i + 8 <= count; i += 8) {
+			const float* src = reinterpret_cast<const float*>(vectors + i);
+			__m256 m0 = _mm256_loadu_ps(src);
+			__m256 m1 = _mm256_loadu_ps(src + 8);
+			__m256 m2 = _mm256_loadu_ps(src + 16);
+			// Regroup so that lane 0 holds vectors 0-3 and lane 1 holds vectors 4-7.
+			__m256 a = _mm256_blend_ps(m0, m1, 0xF0);
+			__m256 b = _mm256_permute2f128_ps(m0, m2, 0x21);
+			__m256 c = _mm256_blend_ps(m1, m2, 0xF0);
+			normalizePacked8(a, b, c);
+			float* dst = reinterpret_cast<float*>(results + i);
+			_mm256_storeu_ps(dst, _mm256_permute2f128_ps(a, b, 0x20));
+			_mm256_storeu_ps(dst + 8, _mm256_blend_ps(c, a, 0xF0));
+			_mm256_storeu_ps(dst + 16, _mm256_permute2f128_ps(b, c, 0x31));
+		}
+#endif
+#if ENGINE_SIMD_SSE2
+		for (; i + 4 <= count; i += 4) {
+			const float* src = reinterpret_cast<const float*>(vectors + i);
+			__m128 a = _mm_loadu_ps(src);
+			__m128 b = _mm_loadu_ps(src + 4);
+			__m128 c = _mm_loadu_ps(src + 8);
+			normalizePacked4(a, b, c);
+			float* dst = reinterpret_cast<float*>(results + i);
+			_mm_storeu_ps(dst, a);
+			_mm_storeu_ps(dst + 4, b);
+			_mm_storeu_ps(dst + 8, c);
+		}
+#endif
+		for (; i < count; ++i) {
+			const Vector3& v = vectors[i];
+			float lengthSq = v.x * v.x + v.y * v.y + v.z * v.z;
+			float scale = lengthSq > 0.0f ? rsqrt(lengthSq) : 0.0f;
+			results[i] = v * scale;
+		}
+	}
 }
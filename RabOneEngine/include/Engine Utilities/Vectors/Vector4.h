@@ -28,7 +28,7 @@
 */
 #pragma once
 
-#include "Utilities/EngineMath.h"
+#include "Engine Utilities/Utilities/EngineMath.h"
 namespace EngineUtilities {
   /**
  * @brief A 4D vector class.
@@ -36,8 +36,12 @@ namespace EngineUtilities {
  * This class represents a vector in 4-dimensional space and provides
  * basic vector operations such as addition, subtraction, scalar multiplication,
  * and normalization.
+ *
+ * The components are 16-byte aligned so that the vector maps onto one SSE
+ * register; the operators use SSE when it is available and scalar code otherwise.
+ * Constant expressions always take the scalar code, so the type is constexpr.
  */
-  class Vector4 {
+  class alignas(16) Vector4 {
   public:
     float x; /**< The x-coordinate of the vector. */
     float y; /**< The y-coordinate of the vector. */
@@ -49,7 +53,7 @@ namespace EngineUtilities {
      *
      * Initializes the vector to (0, 0, 0, 0).
      */
-    Vector4() : x(0), y(0), z(0), w(0) {}
+    constexpr Vector4() : x(0), y(0), z(0), w(0) {}
 
     /**
      * @brief Parameterized constructor.
@@ -61,7 +65,27 @@ namespace EngineUtilities {
      * @param z The z-coordinate.
      * @param w The w-coordinate.
      */
-    Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+#if ENGINE_SIMD_SSE2
+    /**
+     * @brief Constructs the vector from an SSE register (x in the lowest lane).
+     *
+     * @param value The register to store.
+     */
+    explicit Vector4(__m128 value) {
+      _mm_store_ps(&x, value);
+    }
+
+    /**
+     * @brief Loads the vector into an SSE register.
+     *
+     * @return The register holding (x, y, z, w).
+     */
+    __m128 toSimd() const {
+      return _mm_load_ps(&x);
+    }
+#endif
 
     /**
      * @brief Adds another vector to this vector.
@@ -69,7 +93,12 @@ namespace EngineUtilities {
      * @param other The vector to add.
      * @return The result of the addition.
      */
-    Vector4 operator+(const Vector4& other) const {
+    constexpr Vector4 operator+(const Vector4& other) const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return Vector4(_mm_add_ps(toSimd(), other.toSimd()));
+      }
+#endif
       return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
     }
 
@@ -79,7 +108,12 @@ namespace EngineUtilities {
      * @param other The vector to subtract.
      * @return The result of the subtraction.
      */
-    Vector4 operator-(const Vector4& other) const {
+    constexpr Vector4 operator-(const Vector4& other) const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return Vector4(_mm_sub_ps(toSimd(), other.toSimd()));
+      }
+#endif
       return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
     }
 
@@ -89,17 +123,41 @@ namespace EngineUtilities {
      * @param scalar The scalar to multiply by.
      * @return The result of the multiplication.
      */
-    Vector4 operator*(float scalar) const {
+    constexpr Vector4 operator*(float scalar) const {
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return Vector4(_mm_mul_ps(toSimd(), _mm_set1_ps(scalar)));
+      }
+#endif
       return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
     }
 
+    /**
+     * @brief Computes the dot product with another vector.
+     *
+     * @param other The other vector.
+     * @return The dot product.
+     */
+    constexpr float dot(const Vector4& other) const {
+#if ENGINE_SIMD_SSE41
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return _mm_cvtss_f32(_mm_dp_ps(toSimd(), other.toSimd(), 0xF1));
+      }
+#elif ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return _mm_cvtss_f32(SimdHorizontalSum(_mm_mul_ps(toSimd(), other.toSimd())));
+      }
+#endif
+      return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+
     /**
      * @brief Calculates the magnitude (length) of the vector.
      *
      * @return The magnitude of the vector.
      */
-    float magnitude() const {
-      return EngineUtilities::sqrt(x * x + y * y + z * z + w * w);
+    constexpr float magnitude() const {
+      return EngineUtilities::sqrt(dot(*this));
     }
 
     /**
@@ -107,11 +165,16 @@ namespace EngineUtilities {
      *
      * @return The normalized vector.
      */
-    Vector4 normalize() const {
+    constexpr Vector4 normalize() const {
       float mag = magnitude();
       if (mag == 0) {
         return Vector4(0, 0, 0, 0);
       }
+#if ENGINE_SIMD_SSE2
+      if (!ENGINE_CONSTANT_EVALUATED()) {
+        return Vector4(_mm_div_ps(toSimd(), _mm_set1_ps(mag)));
+      }
+#endif
       return Vector4(x / mag, y / mag, z / mag, w / mag);
     }
 
@@ -120,7 +183,16 @@ namespace EngineUtilities {
      *
      * @return Pointer to the first element (x, y, z, w).
      */
-    const float* data() const {
+    constexpr const float* data() const {
+      return &x;
+    }
+
+    /**
+     * @brief Returns a mutable pointer to the vector's data.
+     *
+     * @return Pointer to the first element (x, y, z, w).
+     */
+    constexpr float* data() {
       return &x;
     }
   };
@@ -59,5 +59,5 @@ public:
   /**
    * @brief Pointer to the underlying Direct3D input layout object.
    */
-  ID3D11InputLayout* m_inputLayout = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11InputLayout> m_inputLayout;
 };
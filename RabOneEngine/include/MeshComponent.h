@@ -48,9 +48,9 @@ public:
 
 public:
   /**
-   * @brief Name of the mesh.
+   * @brief Interned name of the mesh.
    */
-  std::string m_name;
+  EngineUtilities::Name m_name;
 
   /**
    * @brief Vertex buffer containing the mesh's vertices.
@@ -34,6 +34,15 @@
 #include "Engine Utilities/Memory/TWeakPointer.h"
 #include "Engine Utilities/Memory/TUniquePtr.h"
 #include "Engine Utilities/Memory/TStaticPtr.h"
+#include "Engine Utilities/Memory/TRefCountPtr.h"
+#include "Engine Utilities/Memory/MemoryTracker.h"
+#include "Engine Utilities/Memory/TAllocator.h"
+#include "Engine Utilities/Memory/TFrameArena.h"
+#include "Engine Utilities/Memory/TObjectPool.h"
+#include "Engine Utilities/Structures/TInlineArray.h"
+#include "Engine Utilities/Structures/TSlotMap.h"
+#include "Engine Utilities/Utilities/Name.h"
+#include "Engine Utilities/Matrix/Matrix4x4.h"
 
 //--------------------------------------------------------------------------------------
 // MACROS
@@ -112,7 +121,7 @@ struct
  */
 struct
   CBNeverChanges {
-  XMMATRIX mView; ///< View matrix.
+  EngineUtilities::Matrix4x4 mView; ///< View matrix.
 };
 
 /**
@@ -121,7 +130,7 @@ struct
  */
 struct
   CBChangeOnResize {
-  XMMATRIX mProjection; ///< Projection matrix.
+  EngineUtilities::Matrix4x4 mProjection; ///< Projection matrix.
 };
 
 /**
@@ -130,7 +139,7 @@ struct
  */
 struct
   CBChangesEveryFrame {
-  XMMATRIX mWorld;      ///< World matrix.
+  EngineUtilities::Matrix4x4 mWorld; ///< World matrix.
   XMFLOAT4 vMeshColor;  ///< Mesh color.
 };
 
@@ -158,12 +167,4 @@ LoadData {
   std::vector<unsigned int> index; ///< Vector of indices for the mesh.
   int numVertex; ///< Count of vertices in the mesh.
   int numIndex; ///< Count of indices in the mesh.
-};
-
-enum
-ComponentType {
-  NONE = 0,     ///< Tipo de componente no especificado.
-  TRANSFORM = 1,///< Componente de transformacin.
-  MESH = 2,     ///< Componente de malla.
-  MATERIAL = 3  ///< Componente de material.
 };
\ No newline at end of file
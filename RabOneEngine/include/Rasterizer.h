@@ -56,5 +56,5 @@ public:
   void destroy();
 
 private:
-  ID3D11RasterizerState* m_rasterizerState = nullptr; ///< Pointer to the Direct3D rasterizer state object.
+  EngineUtilities::TRefCountPtr<ID3D11RasterizerState> m_rasterizerState; ///< Pointer to the Direct3D rasterizer state object.
 };
@@ -85,5 +85,5 @@ private:
   /**
    * @brief Pointer to the underlying Direct3D render target view.
    */
-  ID3D11RenderTargetView* m_renderTargetView = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11RenderTargetView> m_renderTargetView;
 };
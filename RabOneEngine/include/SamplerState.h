@@ -53,5 +53,5 @@ public:
   destroy();
 
 public:
-  ID3D11SamplerState* m_sampler = nullptr; ///< DirectX 11 sampler state object.
+  EngineUtilities::TRefCountPtr<ID3D11SamplerState> m_sampler; ///< DirectX 11 sampler state object.
 };
\ No newline at end of file
@@ -109,12 +109,12 @@ public:
                         ID3DBlob** ppBlobOut);
 
 public:
-  ID3D11VertexShader* m_VertexShader = nullptr; ///< Pointer to the vertex shader object.
-  ID3D11PixelShader* m_PixelShader = nullptr;   ///< Pointer to the pixel shader object.
+  EngineUtilities::TRefCountPtr<ID3D11VertexShader> m_VertexShader; ///< Vertex shader object.
+  EngineUtilities::TRefCountPtr<ID3D11PixelShader> m_PixelShader;   ///< Pixel shader object.
   InputLayout m_inputLayout;                    ///< Input layout associated with the shader program.
 
 private:
   std::string m_shaderFileName;                 ///< Path to the shader file.
-  ID3DBlob* m_vertexShaderData = nullptr;       ///< Compiled vertex shader data.
-  ID3DBlob* m_pixelShaderData = nullptr;        ///< Compiled pixel shader data.
+  EngineUtilities::TRefCountPtr<ID3DBlob> m_vertexShaderData;  ///< Compiled vertex shader data.
+  EngineUtilities::TRefCountPtr<ID3DBlob> m_pixelShaderData;   ///< Compiled pixel shader data.
 };
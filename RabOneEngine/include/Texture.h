@@ -99,12 +99,12 @@ public:
   /**
    * @brief Pointer to the Direct3D texture resource.
    */
-  ID3D11Texture2D* m_texture = nullptr;
+  EngineUtilities::TRefCountPtr<ID3D11Texture2D> m_texture;
 
   /**
    * @brief Pointer to the shader resource view for the texture.
    */
-  ID3D11ShaderResourceView* m_textureFromImg;
+  EngineUtilities::TRefCountPtr<ID3D11ShaderResourceView> m_textureFromImg;
 
-  std::string m_textureName; ///< Name of the texture file.
+  EngineUtilities::Name m_textureName; ///< Interned path of the texture file.
 };
\ No newline at end of file
@@ -71,6 +71,12 @@ public:
   void
   SceneGraphGUI(BaseApp& g_bApp);
 
+  /**
+   * @brief Shows live memory per subsystem tag and the frame arena usage.
+   */
+  void
+  MemoryGUI(BaseApp& g_bApp);
+
   /**
    * @brief Allows you to manipulate three float values in the GUI
    * @param label Label to be displayed next to the control.
@@ -90,10 +90,15 @@ BaseApp::init() {
     return hr;
   }
 
+  // Reservar espacio para los actores de la escena
+  g_actors.Reserve(4);
+
   // Set Koromaru OBJ Model
-  g_AKoro = EngineUtilities::TSharedPointer<Actor>(new Actor(g_device));
+  g_AKoro = createActor();
+  Actor* koro = g_actors.Find(g_AKoro);
 
-  if (!g_AKoro.isNull()) {
+  if (koro) {
+    koro->setName("Koro");
     // Crear Vertex buffer e index buffer para el modelo
     koroMesh = m_loader.LoadOBJModel("models/koroGod.obj");
 
@@ -108,13 +113,12 @@ BaseApp::init() {
     Koromeshes.push_back(koroMesh);
     std::vector<Texture> KoroTextures;
     KoroTextures.push_back(g_koroTexture);
-    g_AKoro->SetMesh(g_device, Koromeshes);
-    g_AKoro->setTextures(KoroTextures);
+    koro->SetMesh(g_device, Koromeshes);
+    koro->setTextures(KoroTextures);
 
-    g_actors.push_back(g_AKoro);
-    g_AKoro->getComponent<Transform>()->setTransform(EngineUtilities::Vector3(0.0f, 0.0f, 0.0f),
+    koro->getComponent<Transform>()->setTransform(EngineUtilities::Vector3(0.0f, 0.0f, 0.0f),
       EngineUtilities::Vector3(0.0f, 3.4f, 0.0f), EngineUtilities::Vector3(0.025f, 0.025f, 0.025f));
-    g_AKoro->setCastShadow(false);
+    koro->setCastShadow(false);
   }
   else {
     ERROR("Main", "InitDevice", "Failed to create Koro actor.");
@@ -122,9 +126,11 @@ BaseApp::init() {
   }
 
   // Set Shiba FBX Model
-  g_AShiba = EngineUtilities::TSharedPointer<Actor>(new Actor(g_device));
+  g_AShiba = createActor();
+  Actor* shiba = g_actors.Find(g_AShiba);
 
-  if (!g_AShiba.isNull()) {
+  if (shiba) {
+    shiba->setName("Shiba");
     // Load FBX model using ModelLoader
     if (m_loader.LoadFBXModel("models/shiba.FBX")) {
       // Get the loaded meshes from the ModelLoader
@@ -145,17 +151,16 @@ BaseApp::init() {
         std::vector<Texture> shibaTextures;
         shibaTextures.push_back(g_shibaTexture);
         
-        g_AShiba->SetMesh(g_device, shibaMeshes);
-        g_AShiba->setTextures(shibaTextures);
+        shiba->SetMesh(g_device, shibaMeshes);
+        shiba->setTextures(shibaTextures);
 
         // Position the Shiba model next to Koro with better positioning
-        g_AShiba->getComponent<Transform>()->setTransform(
+        shiba->getComponent<Transform>()->setTransform(
           EngineUtilities::Vector3(1.0f, 0.0f, 0.0f), // Position offset from Koro
           EngineUtilities::Vector3(5.0f, 3.4f, 0.0f), 
           EngineUtilities::Vector3(1.0f, 1.0f, 1.0f)
         );
-        g_AShiba->setCastShadow(false);
-        g_actors.push_back(g_AShiba);
+        shiba->setCastShadow(false);
       }
       else {
         ERROR("Main", "InitDevice", "No meshes found in FBX model.");
@@ -173,9 +178,11 @@ BaseApp::init() {
   }
 
   // Set Rei Ayanmi's FBX Model
-  g_ARei = EngineUtilities::TSharedPointer<Actor>(new Actor(g_device));
+  g_ARei = createActor();
+  Actor* rei = g_actors.Find(g_ARei);
 
-  if (!g_AShiba.isNull()) {
+  if (rei) {
+    rei->setName("Rei");
     // Load FBX model using ModelLoader
     if (m_loader.LoadFBXModel("models/Rei.fbx")) {
       // Get the loaded meshes from the ModelLoader
@@ -225,17 +232,16 @@ BaseApp::init() {
         reiTextures.push_back(g_reiTexture5);
 
         // Set the meshes and textures for Rei actor
-        g_ARei->SetMesh(g_device, reiMeshes);
-        g_ARei->setTextures(reiTextures);
+        rei->SetMesh(g_device, reiMeshes);
+        rei->setTextures(reiTextures);
 
         // Position the Shiba model next to Koro with better positioning
-        g_ARei->getComponent<Transform>()->setTransform(
+        rei->getComponent<Transform>()->setTransform(
           EngineUtilities::Vector3(-2.0f, 0.0f, 0.0f), // Position offset from Koro
           EngineUtilities::Vector3(5.0f, -3.4f, 0.0f),  // No rotation
           EngineUtilities::Vector3(2.0f, 2.0f, 2.0f) 
         );
-        g_ARei->setCastShadow(false);
-        g_actors.push_back(g_ARei);
+        rei->setCastShadow(false);
       }
       else {
         ERROR("Main", "InitDevice", "No meshes found in FBX model.");
@@ -253,9 +259,11 @@ BaseApp::init() {
   }
 
   // Set plane actor
-  g_APlane = EngineUtilities::TSharedPointer<Actor>(new Actor(g_device));
+  g_APlane = createActor();
+  Actor* plane = g_actors.Find(g_APlane);
 
-  if (!g_APlane.isNull()) {
+  if (plane) {
+    plane->setName("Plane");
     SimpleVertex planeVertices[] =
     {
         { XMFLOAT3(-20.0f, 0.0f, -20.0f), XMFLOAT2(0.0f, 0.0f) },
@@ -293,14 +301,13 @@ BaseApp::init() {
     PlaneMeshes.push_back(planeMesh);
     std::vector<Texture> PlaneTextures;
     PlaneTextures.push_back(g_planeTexture);
-    g_APlane->SetMesh(g_device, PlaneMeshes);
-    g_APlane->setTextures(PlaneTextures);
+    plane->SetMesh(g_device, PlaneMeshes);
+    plane->setTextures(PlaneTextures);
 
-    g_APlane->getComponent<Transform>()->setTransform(EngineUtilities::Vector3(0.0f, -5.0f, 0.0f),
+    plane->getComponent<Transform>()->setTransform(EngineUtilities::Vector3(0.0f, -5.0f, 0.0f),
       EngineUtilities::Vector3(0.0f, 0.0f, 0.0f),
       EngineUtilities::Vector3(1.0f, 1.0f, 1.0f));
-    g_APlane->setCastShadow(false);
-    g_actors.push_back(g_APlane);
+    plane->setCastShadow(false);
   }
   else {
     ERROR("Main", "InitDevice", "Failed to create Plane Actor.");
@@ -323,15 +330,15 @@ BaseApp::init() {
   }
 
   // Inicializar las matrices de mundo, vista y proyeccin
-  XMVECTOR Eye = XMVectorSet(0.0f, 3.0f, -6.0f, 0.0f);
-  XMVECTOR At = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
-  XMVECTOR Up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
-  g_View = XMMatrixLookAtLH(Eye, At, Up);
+  EngineUtilities::Vector3 Eye(0.0f, 3.0f, -6.0f);
+  EngineUtilities::Vector3 At(0.0f, 1.0f, 0.0f);
+  EngineUtilities::Vector3 Up(0.0f, 1.0f, 0.0f);
+  g_View = EngineUtilities::Matrix4x4::lookAtLH(Eye, At, Up);
 
   // Actualizar la matriz de proyeccin
-  cbNeverChanges.mView = XMMatrixTranspose(g_View);
-  g_Projection = XMMatrixPerspectiveFovLH(XM_PIDIV4, g_window.m_width / (FLOAT)g_window.m_height, 0.01f, 100.0f);
-  cbChangesOnResize.mProjection = XMMatrixTranspose(g_Projection);
+  cbNeverChanges.mView = g_View.transpose();
+  g_Projection = EngineUtilities::Matrix4x4::perspectiveFovLH(EngineUtilities::PI / 4, g_window.m_width / (FLOAT)g_window.m_height, 0.01f, 100.0f);
+  cbChangesOnResize.mProjection = g_Projection.transpose();
 
   // Initialize the user interface after graphics resources are ready
   if (!g_userInterface.init(g_window.m_hWnd, g_device.m_device, g_deviceContext.m_deviceContext)) {
@@ -349,6 +356,7 @@ BaseApp::update() {
   g_userInterface.update();
   g_userInterface.TransformGUI(*this);
   g_userInterface.SceneGraphGUI(*this); // Add this line to show the scene graph tab
+  g_userInterface.MemoryGUI(*this);
 
   // Actualizar tiempo (mismo que antes)
   static float t = 0.0f;
@@ -366,14 +374,17 @@ BaseApp::update() {
   }
 
   // Actualizar la matriz de proyeccin y vista
-  cbNeverChanges.mView = XMMatrixTranspose(g_View);
+  cbNeverChanges.mView = g_View.transpose();
   m_neverChanges.update(g_deviceContext, nullptr, 0, nullptr, &cbNeverChanges, 0, 0);
-  cbChangesOnResize.mProjection = XMMatrixTranspose(g_Projection);
+  cbChangesOnResize.mProjection = g_Projection.transpose();
   m_changeOnResize.update(g_deviceContext, nullptr, 0, nullptr, &cbChangesOnResize, 0, 0);
 
+  // Componer las matrices de mundo de todas las entidades en una pasada
+  updateTransforms(g_world);
+
   // Update the Koro actor
-  for (auto& actor : g_actors) {
-      actor->update(0, g_deviceContext);
+  for (Actor& actor : g_actors) {
+    actor.update(0, g_deviceContext);
   }
 }
 
@@ -400,8 +411,8 @@ BaseApp::render() {
   m_changeOnResize.render(g_deviceContext, 1, 1);
 
   //--------------- Renderizar a Koromaru ---------------//
-  for (auto& actor : g_actors) {
-    actor->render(g_deviceContext);
+  for (Actor& actor : g_actors) {
+    actor.render(g_deviceContext);
   }
   
   // Renderizar la interfaz de usuario
@@ -411,10 +422,21 @@ BaseApp::render() {
   g_swapChain.present();
 }
 
+// Crea un actor en g_actors; su identidad es la entidad que crea en g_world.
+EngineUtilities::SlotHandle
+BaseApp::createActor() {
+  ENGINE_MEMORY_SCOPE(ECS);
+  return g_actors.Emplace(g_device, g_world);
+}
+
 // Libera los recursos utilizados por la aplicacin. 
 void
 BaseApp::destroy() {
   if (g_deviceContext.m_deviceContext) g_deviceContext.m_deviceContext->ClearState();
+  for (Actor& actor : g_actors) {
+    actor.destroy();
+  }
+  g_actors.Empty();
   m_neverChanges.destroy();
   m_changeOnResize.destroy();
   g_samplerState.destroy();
@@ -426,6 +448,26 @@ BaseApp::destroy() {
   if (g_deviceContext.m_deviceContext) g_deviceContext.m_deviceContext->Release();
   if (g_device.m_device) g_device.m_device->Release();
   g_userInterface.destroy();
+
+  // Servicios globales (TStaticPtr), en orden inverso al de creacin
+  EngineUtilities::StaticPtrRegistry::ShutdownAll();
+
+  // Informar del uso de la arena de frame para ajustar su capacidad
+  std::ostringstream frameStats;
+  frameStats << "BaseApp::destroy : [FRAME ARENA] peak " << m_frameArena.GetPeakHighWater()
+             << " / " << m_frameArena.GetCapacity() << " bytes, "
+             << m_frameArena.GetOverflowFrameCount() << " of " << m_frameArena.GetFrameIndex()
+             << " frames overflowed to the heap\n";
+  OutputDebugStringA(frameStats.str().c_str());
+
+  // Informe por subsistema (con ENGINE_MEMORY_TRACKING=1) y reservas que siguen vivas (con ENGINE_MEMORY_LEAK_TRACKING=1)
+  std::istringstream memoryReport(EngineUtilities::MemoryTracker::BuildReport());
+  std::string reportLine;
+  while (std::getline(memoryReport, reportLine)) {
+    reportLine += "\n";
+    OutputDebugStringA(reportLine.c_str());
+  }
+  EngineUtilities::TFrameArena::SetActive(nullptr);
 }
 
 // Ejecuta la aplicacin, configurando el entorno y el bucle principal.
@@ -442,6 +484,8 @@ BaseApp::run(HINSTANCE hInstance,
   if (FAILED(g_window.init(hInstance, nCmdShow, wndproc)))
     return 0;
 
+  EngineUtilities::TFrameArena::SetActive(&m_frameArena);
+
   if (FAILED(init())) {
     destroy();
     return 0;
@@ -456,6 +500,8 @@ BaseApp::run(HINSTANCE hInstance,
       DispatchMessage(&msg);
     }
     else {
+      // Nuevo frame: se recupera la memoria temporal de hace dos frames
+      m_frameArena.BeginFrame();
       update();
       render();
     }
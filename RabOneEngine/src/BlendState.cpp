@@ -25,7 +25,7 @@ BlendState::init(Device& device) {
 
 	blendDesc.RenderTarget[0] = rtBlendDesc;
 
-	HRESULT hr = device.m_device->CreateBlendState(&blendDesc, &m_blendState);
+	HRESULT hr = device.m_device->CreateBlendState(&blendDesc, m_blendState.getInitReference());
 	if (FAILED(hr)) {
 		ERROR("BlendState", "init",
 			("Failed to create blend state. HRESULT: " + std::to_string(hr)).c_str());
@@ -63,5 +63,5 @@ BlendState::render(DeviceContext& deviceContext,
 
 void
 BlendState::destroy() {
-	SAFE_RELEASE(m_blendState);
+	m_blendState.reset();
 }
\ No newline at end of file
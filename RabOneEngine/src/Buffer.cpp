@@ -105,12 +105,12 @@ Buffer::render(DeviceContext& deviceContext,
 
 	switch (m_bindFlag) {
 	case D3D11_BIND_VERTEX_BUFFER:
-		deviceContext.m_deviceContext->IASetVertexBuffers(StartSlot, NumBuffers, &m_buffer, &m_stride, &m_offset);
+		deviceContext.m_deviceContext->IASetVertexBuffers(StartSlot, NumBuffers, m_buffer.getAddressOf(), &m_stride, &m_offset);
 		break;
 	case D3D11_BIND_CONSTANT_BUFFER:
-		deviceContext.m_deviceContext->VSSetConstantBuffers(StartSlot, NumBuffers, &m_buffer);
+		deviceContext.m_deviceContext->VSSetConstantBuffers(StartSlot, NumBuffers, m_buffer.getAddressOf());
 		if (setPixelShader) {
-			deviceContext.m_deviceContext->PSSetConstantBuffers(StartSlot, NumBuffers, &m_buffer);
+			deviceContext.m_deviceContext->PSSetConstantBuffers(StartSlot, NumBuffers, m_buffer.getAddressOf());
 		}
 		break;
 	case D3D11_BIND_INDEX_BUFFER:
@@ -125,7 +125,7 @@ Buffer::render(DeviceContext& deviceContext,
 
 void
 Buffer::destroy() {
-	SAFE_RELEASE(m_buffer);
+	m_buffer.reset();
 }
 
 
@@ -138,7 +138,7 @@ Buffer::createBuffer(Device& device,
 		return E_POINTER;
 	}
 
-	HRESULT hr = device.CreateBuffer(&desc, initData, &m_buffer);
+	HRESULT hr = device.CreateBuffer(&desc, initData, m_buffer.getInitReference());
 	if (FAILED(hr)) {
 		ERROR("Buffer", "createBuffer", "Failed to create buffer");
 		return hr;
@@ -30,7 +30,7 @@ DepthStencilState::init(Device& device, bool enableDepth, bool enableStencil) {
   desc.BackFace.StencilPassOp = D3D11_STENCIL_OP_KEEP;
   desc.BackFace.StencilFunc = D3D11_COMPARISON_ALWAYS;
 
-  HRESULT hr = device.CreateDepthStencilState(&desc, &m_depthStencilState);
+  HRESULT hr = device.CreateDepthStencilState(&desc, m_depthStencilState.getInitReference());
   if (FAILED(hr)) {
     ERROR("DepthStencilState", "init", "Failed to create DepthStencilState");
   }
@@ -65,5 +65,5 @@ DepthStencilState::render(DeviceContext& deviceContext,
 
 void
 DepthStencilState::destroy() {
-  SAFE_RELEASE(m_depthStencilState);
+  m_depthStencilState.reset();
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ DepthStencilView::init(Device& device, Texture& depthStencil, DXGI_FORMAT format
 
   // Create the depth stencil view
   HRESULT hr = device.CreateDepthStencilView(depthStencil.m_texture,
-    &descDSV, &m_depthStencilView);
+    &descDSV, m_depthStencilView.getInitReference());
 
   if (FAILED(hr)) {
     ERROR("DepthStencilView", "init",
@@ -54,5 +54,5 @@ DepthStencilView::render(DeviceContext& deviceContext) {
 // Releases the depth stencil view resource.
 void
 DepthStencilView::destroy() {
-  SAFE_RELEASE(m_depthStencilView);
+  m_depthStencilView.reset();
 }
@@ -3,15 +3,18 @@
 #include "Device.h"
 #include "DeviceContext.h"
 
-Actor::Actor(Device& device) {
+Actor::Actor(Device& device, World& world) : m_world(&world) {
+	// The transform data lives in the world; Transform is a facade over it
+	m_id = world.createEntity(Position{}, Rotation{}, Scale{}, LocalToWorld{});
+
 	// Setup Default Components
-	EngineUtilities::TSharedPointer<Transform> transform = EngineUtilities::MakeShared<Transform>();
+	EngineUtilities::TSharedPointer<Transform> transform = EngineUtilities::MakeSharedPooled<Transform>(world, m_id);
 	addComponent(transform);
-	EngineUtilities::TSharedPointer<MeshComponent> meshComponent = EngineUtilities::MakeShared<MeshComponent>();
+	EngineUtilities::TSharedPointer<MeshComponent> meshComponent = EngineUtilities::MakeSharedPooled<MeshComponent>();
 	addComponent(meshComponent);
 
 	HRESULT hr;
-	std::string classNameType = "Actor -> " + m_name;
+	std::string classNameType = "Actor -> " + m_name.ToString();
 	hr = m_modelBuffer.init(device, sizeof(CBChangesEveryFrame));
 	if (FAILED(hr)) {
 		ERROR("Actor", classNameType.c_str(), "Failed to create new CBChangesEveryFrame");
@@ -74,7 +77,7 @@ Actor::update(float deltaTime, DeviceContext& deviceContext) {
 	}
 
 	// Update the model buffer
-	m_model.mWorld = XMMatrixTranspose(getComponent<Transform>()->matrix);
+	m_model.mWorld = getComponent<Transform>()->getMatrix().transpose();
 	m_model.vMeshColor = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
 
 	// Update the constant buffer
@@ -105,9 +108,9 @@ Actor::render(DeviceContext& deviceContext) {
 		m_modelBuffer.render(deviceContext, 2, 1, true);
 
 		// Render mesh texture - improved texture binding
-		if (!m_textures.empty()) {
+		if (m_textures.Num() > 0) {
 			// Use modulo to ensure we don't go out of bounds
-			int textureIndex = i % m_textures.size();
+			int textureIndex = i % m_textures.Num();
 			m_textures[textureIndex].render(deviceContext, 0, 1);
 		}
 
@@ -137,11 +140,18 @@ Actor::destroy() {
 	m_rasterizer.destroy();
 	m_blendstate.destroy();
 	m_sampler.destroy();
+
+	if (m_world) {
+		m_world->destroyEntity(m_id);
+	}
 }
 
 void
 Actor::SetMesh(Device& device, std::vector<MeshComponent> meshes) {
+	ENGINE_MEMORY_SCOPE(Mesh);
 	m_meshes = meshes;
+	m_vertexBuffers.Reserve(m_meshes.size());
+	m_indexBuffers.Reserve(m_meshes.size());
 	HRESULT hr;
 	for (auto& mesh : m_meshes) {
 		// Crear vertex buffer
@@ -151,7 +161,7 @@ Actor::SetMesh(Device& device, std::vector<MeshComponent> meshes) {
 			ERROR("Actor", "setMesh", "Failed to create new vertexBuffer");
 		}
 		else {
-			m_vertexBuffers.push_back(vertexBuffer);
+			m_vertexBuffers.Add(vertexBuffer);
 		}
 
 		// Crear index buffer
@@ -161,7 +171,7 @@ Actor::SetMesh(Device& device, std::vector<MeshComponent> meshes) {
 			ERROR("Actor", "setMesh", "Failed to create new indexBuffer");
 		}
 		else {
-			m_indexBuffers.push_back(indexBuffer);
+			m_indexBuffers.Add(indexBuffer);
 		}
 	}
 }
@@ -174,10 +184,8 @@ Actor::renderShadow(DeviceContext& deviceContext) {
 	auto yaw = t->getRotation().y; // s�lo yaw
 	auto scl = t->getScale();      // Vector3
 
-	XMMATRIX Mscale = XMMatrixScaling(scl.x, scl.y, scl.z);
-	XMMATRIX Myaw = XMMatrixRotationY(yaw);
-	XMMATRIX Mtrans = XMMatrixTranslation(pos.x, pos.y, pos.z);
-	XMMATRIX worldYaw = Mscale * Myaw * Mtrans;
+	EngineUtilities::Matrix4x4 worldYaw =
+		EngineUtilities::Matrix4x4::compose(pos, EngineUtilities::Vector3(0.0f, yaw, 0.0f), scl);
 
 	// --- 2) Construye la matriz de proyecci�n de sombra ---
 	//   para proyectar v' = v - (v.y / Ly) * L
@@ -186,7 +194,7 @@ Actor::renderShadow(DeviceContext& deviceContext) {
 	float Lz = m_LightPos.z;
 	float invLy = 1.0f / Ly;
 
-	XMMATRIX S = XMMATRIX(
+	EngineUtilities::Matrix4x4 S(
 		1.0f, -Lx * invLy, 0.0f, 0.0f,
 		0.0f, 0.0f, 0.0f, 0.0f,
 		0.0f, -Lz * invLy, 1.0f, 0.0f,
@@ -194,9 +202,9 @@ Actor::renderShadow(DeviceContext& deviceContext) {
 	);
 
 	// --- 3) Aplica worldYaw * S para obtener la sombra en el suelo ---
-	XMMATRIX worldShadow = worldYaw * S;
+	EngineUtilities::Matrix4x4 worldShadow = worldYaw * S;
 	// 2) Preparar y actualizar constant buffer
-	m_cbShadow.mWorld = XMMatrixTranspose(worldShadow);
+	m_cbShadow.mWorld = worldShadow.transpose();
 	m_cbShadow.vMeshColor = XMFLOAT4(0, 0, 0, 0.5f);
 	m_shaderBuffer.update(deviceContext, nullptr, 0, nullptr, &m_cbShadow, 0, 0);
 	m_shaderBuffer.render(deviceContext, 2, 1, true);
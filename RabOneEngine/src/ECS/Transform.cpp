@@ -1,31 +1,23 @@
-#include "ECS\Transform.h"  
-#include "DeviceContext.h"  
+#include "ECS/Transform.h"  
 
 void  
 Transform::init() {  
-scale = EngineUtilities::Vector3(1.0f, 1.0f, 1.0f);  
+data<Scale>().value = EngineUtilities::Vector3(1.0f, 1.0f, 1.0f);  
 
-matrix = XMMatrixIdentity();  
-}  
-
-void  
-Transform::update(float deltaTime) {  
-// Aplicar escala  
-XMMATRIX scaleMatrix = XMMatrixScaling(scale.x, scale.y, scale.z);  
-// Aplicar rotacion  
-XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);  
-// Aplicar traslacion  
-XMMATRIX translationMatrix = XMMatrixTranslation(position.x, position.y, position.z);  
-
-// Componer la matriz final en el orden: scale -> rotation -> translation  
-matrix = scaleMatrix * rotationMatrix * translationMatrix;  
+// La matriz final (scale -> rotation -> translation) la compone updateTransforms  
+data<LocalToWorld>().value = EngineUtilities::Matrix4x4();  
 }  
 
 void  
 Transform::setTransform(const EngineUtilities::Vector3& newPos,  
 const EngineUtilities::Vector3& newRot,  
 const EngineUtilities::Vector3& newSca) {  
-position = newPos;  
-rotation = newRot;  
-scale = newSca;  
+data<Position>().value = newPos;  
+data<Rotation>().value = newRot;  
+data<Scale>().value = newSca;  
+}  
+
+void  
+Transform::translate(const EngineUtilities::Vector3& translation) {  
+data<Position>().value = data<Position>().value + translation;  
 }
\ No newline at end of file
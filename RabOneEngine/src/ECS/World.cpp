@@ -0,0 +1,195 @@
+#include "ECS/World.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Engine Utilities/Memory/MemoryTracker.h"
+#include "Engine Utilities/Utilities/SIMD.h"
+
+namespace {
+  size_t
+  alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+  }
+
+  /**
+   * @brief Lays out the arrays of a chunk for a given row capacity.
+   * @return The bytes used, which must not exceed World::ChunkBytes.
+   */
+  size_t
+  layoutChunk(Archetype& archetype, uint32_t capacity) {
+    size_t offset = alignUp(capacity * sizeof(EntityId), World::ChunkAlignment);
+    for (uint32_t typeId : archetype.types) {
+      const ComponentInfo& info = componentInfo(typeId);
+      offset = alignUp(offset, info.alignment > World::ChunkAlignment ? info.alignment : World::ChunkAlignment);
+      archetype.offsets[typeId] = static_cast<uint32_t>(offset);
+      offset += capacity * info.size;
+    }
+    return offset;
+  }
+}
+
+World::World() {}
+
+World::~World() {
+  clear();
+  for (Archetype* archetype : m_archetypes) {
+    delete archetype;
+  }
+}
+
+EntityId
+World::createEntity() {
+  Archetype* archetype = getArchetype(0);
+  EntityId entity = m_entities.Emplace(EntityRecord{ archetype, 0 });
+  m_entities.Find(entity)->row = allocateRow(archetype, entity);
+  return entity;
+}
+
+bool
+World::destroyEntity(EntityId entity) {
+  EntityRecord* record = m_entities.Find(entity);
+  if (!record) {
+    return false;
+  }
+  Archetype* archetype = record->archetype;
+  for (uint32_t typeId : archetype->types) {
+    componentInfo(typeId).destroy(archetype->component(record->row, typeId));
+  }
+  removeRow(archetype, record->row);
+  m_entities.Remove(entity);
+  return true;
+}
+
+void
+World::clear() {
+  for (Archetype* archetype : m_archetypes) {
+    for (ArchetypeChunk& chunk : archetype->chunks) {
+      for (uint32_t typeId : archetype->types) {
+        const ComponentInfo& info = componentInfo(typeId);
+        char* column = static_cast<char*>(archetype->column(chunk, typeId));
+        for (uint32_t i = 0; i < chunk.count; ++i) {
+          info.destroy(column + i * info.size);
+        }
+      }
+      EngineUtilities::HeapDeallocate(chunk.data, ChunkAlignment);
+    }
+    archetype->chunks.Empty();
+    archetype->entityCount = 0;
+  }
+  m_entities.Empty();
+}
+
+Archetype*
+World::getArchetype(ComponentMask mask) {
+  if (Archetype** found = m_archetypeByMask.Find(mask)) {
+    return *found;
+  }
+
+  ENGINE_MEMORY_SCOPE(ECS);
+  Archetype* archetype = new Archetype();
+  archetype->mask = mask;
+  std::memset(archetype->offsets, 0, sizeof(archetype->offsets));
+  std::memset(archetype->addEdges, 0, sizeof(archetype->addEdges));
+  std::memset(archetype->removeEdges, 0, sizeof(archetype->removeEdges));
+  size_t rowBytes = sizeof(EntityId);
+  for (ComponentMask bits = mask; bits != 0; bits &= bits - 1) {
+    uint32_t low = static_cast<uint32_t>(bits);
+    uint32_t typeId = low != 0 ? EngineUtilities::CountTrailingZeros(low)
+                               : 32 + EngineUtilities::CountTrailingZeros(static_cast<uint32_t>(bits >> 32));
+    archetype->types.Add(typeId);
+    rowBytes += componentInfo(typeId).size;
+  }
+
+  // Start from the ideal row count and shrink until the alignment padding fits too.
+  uint32_t capacity = static_cast<uint32_t>(ChunkBytes / rowBytes);
+  while (capacity > 1 && layoutChunk(*archetype, capacity) > ChunkBytes) {
+    --capacity;
+  }
+  if (capacity == 0 || layoutChunk(*archetype, capacity) > ChunkBytes) {
+    std::fputs("World: archetype components do not fit one row in a chunk (ChunkBytes is 16 KiB)\n", stderr);
+    std::abort();
+  }
+  archetype->capacity = capacity;
+
+  m_archetypes.Add(archetype);
+  m_archetypeByMask.Add(mask, archetype);
+  return archetype;
+}
+
+Archetype*
+World::getAddTarget(Archetype* archetype, uint32_t typeId) {
+  if (!archetype->addEdges[typeId]) {
+    Archetype* target = getArchetype(archetype->mask | (ComponentMask(1) << typeId));
+    archetype->addEdges[typeId] = target;
+    target->removeEdges[typeId] = archetype;
+  }
+  return archetype->addEdges[typeId];
+}
+
+Archetype*
+World::getRemoveTarget(Archetype* archetype, uint32_t typeId) {
+  if (!archetype->removeEdges[typeId]) {
+    Archetype* target = getArchetype(archetype->mask & ~(ComponentMask(1) << typeId));
+    archetype->removeEdges[typeId] = target;
+    target->addEdges[typeId] = archetype;
+  }
+  return archetype->removeEdges[typeId];
+}
+
+uint32_t
+World::allocateRow(Archetype* archetype, EntityId entity) {
+  uint32_t row = archetype->entityCount;
+  uint32_t chunkIndex = row / archetype->capacity;
+  if (chunkIndex == archetype->chunks.Num()) {
+    ENGINE_MEMORY_SCOPE(ECS);
+    ArchetypeChunk chunk;
+    chunk.data = static_cast<char*>(EngineUtilities::HeapAllocate(ChunkBytes, ChunkAlignment));
+    archetype->chunks.Add(chunk);
+  }
+  ArchetypeChunk& chunk = archetype->chunks[chunkIndex];
+  archetype->entities(chunk)[chunk.count] = entity;
+  ++chunk.count;
+  ++archetype->entityCount;
+  return row;
+}
+
+void
+World::removeRow(Archetype* archetype, uint32_t row) {
+  uint32_t last = archetype->entityCount - 1;
+  ArchetypeChunk& lastChunk = archetype->chunks[last / archetype->capacity];
+  if (row != last) {
+    // Move the last row into the hole and point its entity at the new row.
+    for (uint32_t typeId : archetype->types) {
+      componentInfo(typeId).relocate(archetype->component(row, typeId), archetype->component(last, typeId));
+    }
+    EntityId moved = archetype->entities(lastChunk)[last % archetype->capacity];
+    archetype->entities(archetype->chunks[row / archetype->capacity])[row % archetype->capacity] = moved;
+    m_entities.Find(moved)->row = row;
+  }
+  --lastChunk.count;
+  --archetype->entityCount;
+  if (lastChunk.count == 0) {
+    EngineUtilities::HeapDeallocate(lastChunk.data, ChunkAlignment);
+    archetype->chunks.RemoveAt(archetype->chunks.Num() - 1);
+  }
+}
+
+void
+World::migrate(EntityId entity, EntityRecord& record, Archetype* target) {
+  Archetype* source = record.archetype;
+  uint32_t sourceRow = record.row;
+  uint32_t targetRow = allocateRow(target, entity);
+  for (uint32_t typeId : source->types) {
+    void* from = source->component(sourceRow, typeId);
+    if (target->mask & (ComponentMask(1) << typeId)) {
+      componentInfo(typeId).relocate(target->component(targetRow, typeId), from);
+    }
+    else {
+      componentInfo(typeId).destroy(from);
+    }
+  }
+  // removeRow may update another record, but never this one (it points at sourceRow).
+  removeRow(source, sourceRow);
+  record.archetype = target;
+  record.row = targetRow;
+}
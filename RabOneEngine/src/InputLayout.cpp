@@ -20,7 +20,7 @@ InputLayout::init(Device& device,
 		static_cast<unsigned int>(Layout.size()),
 		VertexShaderData->GetBufferPointer(),
 		VertexShaderData->GetBufferSize(),
-		&m_inputLayout);
+		m_inputLayout.getInitReference());
 
 	if (FAILED(hr)) {
 		ERROR("InputLayout", "init",
@@ -48,5 +48,5 @@ InputLayout::render(DeviceContext& deviceContext) {
 
 void
 InputLayout::destroy() {
-	SAFE_RELEASE(m_inputLayout);
+	m_inputLayout.reset();
 }
\ No newline at end of file
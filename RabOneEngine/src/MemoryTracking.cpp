@@ -0,0 +1,42 @@
+#include <new>
+#include "Prerequisites.h"
+
+// Routes every engine allocation through EngineUtilities::MemoryTracker so it is tagged with the
+// active ENGINE_MEMORY_SCOPE. Compiled out when ENGINE_MEMORY_TRACKING is 0.
+#if ENGINE_MEMORY_TRACKING
+
+namespace {
+  void*
+  TrackedNew(size_t size, size_t alignment) {
+    void* ptr = EngineUtilities::MemoryTracker::Allocate(size, alignment);
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+}
+
+void* operator new(size_t size) { return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size) { return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return EngineUtilities::MemoryTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return EngineUtilities::MemoryTracker::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete(void* ptr, size_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { EngineUtilities::MemoryTracker::Deallocate(ptr); }
+
+#endif
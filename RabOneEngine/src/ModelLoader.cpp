@@ -3,6 +3,7 @@
 
 MeshComponent
 ModelLoader::LoadOBJModel(const std::string& filePath) {
+	ENGINE_MEMORY_SCOPE(Loader);
 	MeshComponent mesh;
 	objl::Loader loader;
 
@@ -66,6 +67,7 @@ ModelLoader::InitializeFBXManager() {
 
 bool
 ModelLoader::LoadFBXModel(const std::string& filePath) {
+	ENGINE_MEMORY_SCOPE(Loader);
 	// Clear previous mesh data
 	meshes.clear();
 	textureFileNames.clear();
@@ -17,7 +17,7 @@ Rasterizer::init(Device device) {
 	rasterizerDesc.AntialiasedLineEnable = false;
 
 	HRESULT hr = S_OK;
-	hr = device.CreateRasterizerState(&rasterizerDesc, &m_rasterizerState);
+	hr = device.CreateRasterizerState(&rasterizerDesc, m_rasterizerState.getInitReference());
 
 	if (FAILED(hr)) {
 		ERROR("Rasterizer", "init", "CHECK FOR CreateRasterizerState()");
@@ -36,5 +36,5 @@ Rasterizer::render(DeviceContext& deviceContext) {
 
 void
 Rasterizer::destroy() {
-	SAFE_RELEASE(m_rasterizerState);
+	m_rasterizerState.reset();
 }
\ No newline at end of file
@@ -30,7 +30,7 @@ RenderTargetView::init(Device& device,
   desc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DMS;
 
   // Create the render target view
-  HRESULT hr = device.CreateRenderTargetView(backBuffer.m_texture, &desc, &m_renderTargetView);
+  HRESULT hr = device.CreateRenderTargetView(backBuffer.m_texture, &desc, m_renderTargetView.getInitReference());
 
   if (FAILED(hr)) {
     ERROR("RenderTargetView", "init", ("Failed to create render target view. HRESULT: " + std::to_string(hr)).c_str());
@@ -75,7 +75,7 @@ RenderTargetView::init(Device& device,
   desc.ViewDimension = viewDimension;
 
   // Create the render target view
-  HRESULT hr = device.CreateRenderTargetView(inTex.m_texture, &desc, &m_renderTargetView);
+  HRESULT hr = device.CreateRenderTargetView(inTex.m_texture, &desc, m_renderTargetView.getInitReference());
   if (FAILED(hr)) {
     ERROR("RenderTargetView", "init", ("Failed to create render target view. HRESULT: " + std::to_string(hr)).c_str());
     return hr;
@@ -107,7 +107,7 @@ RenderTargetView::render(DeviceContext& deviceContext,
   deviceContext.m_deviceContext->ClearRenderTargetView(m_renderTargetView, ClearColor);
 
   // Config render target view & depth stencil view
-  deviceContext.m_deviceContext->OMSetRenderTargets(numViews, &m_renderTargetView, depthStencilView.m_depthStencilView);
+  deviceContext.m_deviceContext->OMSetRenderTargets(numViews, m_renderTargetView.getAddressOf(), depthStencilView.m_depthStencilView);
 }
 
 void 
@@ -123,12 +123,12 @@ RenderTargetView::render(DeviceContext& deviceContext,
     return;
   }
   // Config render target view
-  deviceContext.m_deviceContext->OMSetRenderTargets(numViews, &m_renderTargetView, nullptr);
+  deviceContext.m_deviceContext->OMSetRenderTargets(numViews, m_renderTargetView.getAddressOf(), nullptr);
 }
 
 
 void 
 RenderTargetView::destroy()
 {
-  SAFE_RELEASE(m_renderTargetView);
+  m_renderTargetView.reset();
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ SamplerState::init(Device& device) {
   sampDesc.MipLODBias = 0.0f;
   sampDesc.MaxAnisotropy = 1;
 
-  HRESULT hr = device.CreateSamplerState(&sampDesc, &m_sampler);
+  HRESULT hr = device.CreateSamplerState(&sampDesc, m_sampler.getInitReference());
   if (FAILED(hr)) {
     ERROR("SamplerState", "init", "Failed to create SamplerState");
     return hr;
@@ -47,12 +47,10 @@ SamplerState::render(DeviceContext& deviceContext,
     return;
   }
 
-  deviceContext.PSSetSamplers(StartSlot, NumSamplers, &m_sampler);
+  deviceContext.PSSetSamplers(StartSlot, NumSamplers, m_sampler.getAddressOf());
 }
 
 void
 SamplerState::destroy() {
-  if (m_sampler) {
-    SAFE_RELEASE(m_sampler);
-  }
+  m_sampler.reset();
 }
\ No newline at end of file
@@ -61,7 +61,7 @@ ShaderProgram::CreateInputLayout(Device& device,
 	}
 
 	HRESULT hr = m_inputLayout.init(device, Layout, m_vertexShaderData);
-	SAFE_RELEASE(m_vertexShaderData);
+	m_vertexShaderData.reset();
 
 	if (FAILED(hr)) {
 		ERROR("ShaderProgram", "CreateInputLayout", "Failed to create input layout.");
@@ -84,7 +84,7 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 	}
 
 	HRESULT hr = S_OK;
-	ID3DBlob* shaderData = nullptr;
+	EngineUtilities::TRefCountPtr<ID3DBlob> shaderData;
 
 	const char* shaderEntryPoint = (type == ShaderType::PIXEL_SHADER) ? "PS" : "VS";
 	const char* shaderModel = (type == ShaderType::PIXEL_SHADER) ? "ps_4_0" : "vs_4_0";
@@ -93,7 +93,7 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 	hr = CompileShaderFromFile(m_shaderFileName.data(),
 		shaderEntryPoint,
 		shaderModel,
-		&shaderData);
+		shaderData.getInitReference());
 
 	if (FAILED(hr)) {
 		ERROR("ShaderProgram", "CreateShader",
@@ -106,30 +106,27 @@ ShaderProgram::CreateShader(Device& device, ShaderType type) {
 		hr = device.CreatePixelShader(shaderData->GetBufferPointer(),
 			shaderData->GetBufferSize(),
 			nullptr,
-			&m_PixelShader);
+			m_PixelShader.getInitReference());
 	}
 	else {
 		hr = device.CreateVertexShader(shaderData->GetBufferPointer(),
 			shaderData->GetBufferSize(),
 			nullptr,
-			&m_VertexShader);
+			m_VertexShader.getInitReference());
 	}
 
 	if (FAILED(hr)) {
 		ERROR("ShaderProgram", "CreateShader",
 			"Failed to create shader object from compiled data.");
-		shaderData->Release();
 		return hr;
 	}
 
 	// Store the compiled shader data
 	if (type == PIXEL_SHADER) {
-		SAFE_RELEASE(m_pixelShaderData);
-		m_pixelShaderData = shaderData;
+		m_pixelShaderData = std::move(shaderData);
 	}
 	else {
-		SAFE_RELEASE(m_vertexShaderData);
-		m_vertexShaderData = shaderData;
+		m_vertexShaderData = std::move(shaderData);
 	}
 
 	return S_OK;
@@ -167,7 +164,7 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 	// the release configuration of this program.
 	dwShaderFlags |= D3DCOMPILE_DEBUG;
 #endif
-	ID3DBlob* pErrorBlob;
+	EngineUtilities::TRefCountPtr<ID3DBlob> pErrorBlob;
 	hr = D3DX11CompileFromFile(szFileName,
 		nullptr,
 		nullptr,
@@ -177,7 +174,7 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 		0,
 		nullptr,
 		ppBlobOut,
-		&pErrorBlob,
+		pErrorBlob.getInitReference(),
 		nullptr);
 
 	if (FAILED(hr)) {
@@ -185,8 +182,6 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 			ERROR("ShaderProgram", "CompileShaderFromFile",
 				"Failed to compile shader from file: %s. Error: %s",
 				szFileName, static_cast<const char*>(pErrorBlob->GetBufferPointer()));
-
-			pErrorBlob->Release();
 		}
 		else {
 			ERROR("ShaderProgram", "CompileShaderFromFile",
@@ -196,9 +191,7 @@ ShaderProgram::CompileShaderFromFile(char* szFileName,
 		return hr;
 	}
 
-	SAFE_RELEASE(pErrorBlob)
-
-		return S_OK;
+	return S_OK;
 }
 
 void
@@ -237,9 +230,9 @@ ShaderProgram::render(DeviceContext& deviceContext, ShaderType type) {
 
 void
 ShaderProgram::destroy() {
-	SAFE_RELEASE(m_VertexShader);
+	m_VertexShader.reset();
 	m_inputLayout.destroy();
-	SAFE_RELEASE(m_PixelShader);
-	SAFE_RELEASE(m_vertexShaderData);
-	SAFE_RELEASE(m_pixelShaderData);
+	m_PixelShader.reset();
+	m_vertexShaderData.reset();
+	m_pixelShaderData.reset();
 }
\ No newline at end of file
@@ -125,7 +125,7 @@ SwapChain::init(Device& device,
 
   // Get the backbuffer
   hr = m_swapChain->GetBuffer(0, __uuidof(ID3D11Texture2D),
-    reinterpret_cast<void**>(&backBuffer));
+    reinterpret_cast<void**>(backBuffer.m_texture.getInitReference()));
   if (FAILED(hr)) {
     ERROR("SwapChain", "init",
       ("Failed to get back buffer. HRESULT: " + std::to_string(hr)).c_str());
@@ -15,6 +15,7 @@ Texture::init(Device device,
     return E_POINTER;
   }
 
+  ENGINE_MEMORY_SCOPE(Texture);
   HRESULT hr = S_OK;
   
 
@@ -22,13 +23,13 @@ Texture::init(Device device,
     // Load texture from DDS file
   case DDS: {
 
-    m_textureName = textureName + ".dds"; // Ensure the file has the correct extension
+    m_textureName = EngineUtilities::Name(textureName + ".dds"); // Ensure the file has the correct extension
     hr = D3DX11CreateShaderResourceViewFromFile(
       device.m_device,
       m_textureName.c_str(),
       nullptr,
       nullptr,
-      &m_textureFromImg,
+      m_textureFromImg.getInitReference(),
       nullptr);
     if (FAILED(hr)) {
       ERROR("Texture", "init", ("Failed to create texture from DDS file. HRESULT: " + std::to_string(hr)).c_str());
@@ -39,7 +40,7 @@ Texture::init(Device device,
 
     // Load texture from PNG file
   case PNG: {
-    m_textureName = textureName + ".png"; // Ensure the file has the correct extension
+    m_textureName = EngineUtilities::Name(textureName + ".png"); // Ensure the file has the correct extension
     int width, height, channels;
     unsigned char* data = stbi_load(m_textureName.c_str(), &width, &height, &channels, 4); // Force 4 channels (RGBA)
     if (!data) {
@@ -63,7 +64,7 @@ Texture::init(Device device,
     initData.pSysMem = data;
     initData.SysMemPitch = width * 4; // 4 bytes per pixel (RGBA)
 
-    hr = device.CreateTexture2D(&textureDesc, &initData, &m_texture);
+    hr = device.CreateTexture2D(&textureDesc, &initData, m_texture.getInitReference());
     stbi_image_free(data); // Free the image data after creating the texture
 
     if (FAILED(hr)) {
@@ -77,8 +78,8 @@ Texture::init(Device device,
     srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
     srvDesc.Texture2D.MipLevels = 1;
 
-    hr = device.m_device->CreateShaderResourceView(m_texture, &srvDesc, &m_textureFromImg);
-    SAFE_RELEASE(m_texture); // Release the texture after creating the SRV
+    hr = device.m_device->CreateShaderResourceView(m_texture, &srvDesc, m_textureFromImg.getInitReference());
+    m_texture.reset(); // Release the texture after creating the SRV
     if (FAILED(hr)) {
       ERROR("Texture", "init", ("Failed to create shader resource view from PNG texture. HRESULT: " + std::to_string(hr)).c_str());
       return hr;
@@ -126,7 +127,7 @@ Texture::init(Device device, unsigned int width,
   desc.CPUAccessFlags = 0;
   desc.MiscFlags = 0;
 
-  HRESULT hr = device.CreateTexture2D(&desc, nullptr, &m_texture);
+  HRESULT hr = device.CreateTexture2D(&desc, nullptr, m_texture.getInitReference());
   if (FAILED(hr)) {
     ERROR("Texture", "init", ("Failed to create texture with specified parameters. HRESULT: " + std::to_string(hr)).c_str());
     return hr;
@@ -156,7 +157,7 @@ Texture::init(Device& device,
   srvDesc.Texture2D.MipLevels = 1;
   srvDesc.Texture2D.MostDetailedMip = 0;
 
-  HRESULT hr = device.m_device->CreateShaderResourceView(textureRef.m_texture, &srvDesc, &m_textureFromImg);
+  HRESULT hr = device.m_device->CreateShaderResourceView(textureRef.m_texture, &srvDesc, m_textureFromImg.getInitReference());
 
   if (FAILED(hr)) {
     ERROR("Texture", "init", ("Failed to create shader resource view from texture reference. HRESULT: " + std::to_string(hr)).c_str());
@@ -177,17 +178,14 @@ Texture::render(DeviceContext& deviceContext,
   if (m_textureFromImg) {
     ID3D11ShaderResourceView* nullSRV[] = { nullptr };
     deviceContext.m_deviceContext->PSSetShaderResources(StartSlot, NumViews, nullSRV);
-    deviceContext.m_deviceContext->PSSetShaderResources(StartSlot, NumViews, &m_textureFromImg);
+    deviceContext.m_deviceContext->PSSetShaderResources(StartSlot, NumViews, m_textureFromImg.getAddressOf());
   }
 }
 
 void 
 Texture::destroy()
 {
-  if (m_texture != nullptr) {
-    SAFE_RELEASE(m_texture);
-  }
-  if (m_textureFromImg != nullptr) {
-    SAFE_RELEASE(m_textureFromImg);
-  }
+  // Only drops this copy's references; other copies keep the resources alive.
+  m_texture.reset();
+  m_textureFromImg.reset();
 }
@@ -3,6 +3,22 @@
 #include "Device.h"
 #include "DeviceContext.h"
 #include "BaseApp.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+  // ImGui allocations are attributed to the UI tag.
+  void*
+  ImGuiTrackedAlloc(size_t size, void* /*userData*/) {
+    ENGINE_MEMORY_SCOPE(UI);
+    return ::operator new(size);
+  }
+
+  void
+  ImGuiTrackedFree(void* ptr, void* /*userData*/) {
+    ::operator delete(ptr);
+  }
+}
 
 bool
 UserInterface::init(void* window,
@@ -16,6 +32,7 @@ UserInterface::init(void* window,
   }
 
   IMGUI_CHECKVERSION(); // Check ImGUI version
+  ImGui::SetAllocatorFunctions(ImGuiTrackedAlloc, ImGuiTrackedFree);
   ImGui::CreateContext(); // Initialize the context
   ImGuiIO& io = ImGui::GetIO();
   io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // Enable Keyboard Controls
@@ -149,10 +166,12 @@ UserInterface::TransformGUI(BaseApp& g_bApp) {
   ImGui::Begin("Transform");
 
   // Only show transform controls if an actor is selected
-  if (!g_bApp.m_selectedActor.isNull()) {
-    auto transform = g_bApp.m_selectedActor->getComponent<Transform>();
+  // A stale handle (removed actor) resolves to nullptr
+  Actor* selectedActor = g_bApp.g_actors.Find(g_bApp.m_selectedActor);
+  if (selectedActor) {
+    auto transform = selectedActor->getComponent<Transform>();
     if (transform) {
-      std::string label = g_bApp.m_selectedActor->getName();
+      std::string label = selectedActor->getName().ToString();
       if (label.empty()) label = "Selected Actor";
       ImGui::SeparatorText(label.c_str());
       EngineUtilities::Vector3 position = transform->getPosition();
@@ -172,28 +191,76 @@ UserInterface::TransformGUI(BaseApp& g_bApp) {
   ImGui::End();
 }
 
+void
+UserInterface::MemoryGUI(BaseApp& g_bApp) {
+  ImGui::Begin("Memory");
+
+  EngineUtilities::MemoryTagStats stats[EngineUtilities::MemoryTagCount];
+  EngineUtilities::MemoryTracker::GetStats(stats);
+  if (ImGui::BeginTable("MemoryTags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+    ImGui::TableSetupColumn("Tag");
+    ImGui::TableSetupColumn("Live KB");
+    ImGui::TableSetupColumn("Live allocs");
+    ImGui::TableSetupColumn("Peak KB");
+    ImGui::TableSetupColumn("Total allocs");
+    ImGui::TableHeadersRow();
+    for (size_t i = 0; i < EngineUtilities::MemoryTagCount; ++i) {
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(EngineUtilities::GetMemoryTagName(static_cast<EngineUtilities::MemoryTag>(i)));
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", stats[i].LiveBytes / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%lld", static_cast<long long>(stats[i].LiveCount));
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", stats[i].PeakBytes / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%llu", static_cast<unsigned long long>(stats[i].TotalAllocations));
+    }
+    ImGui::EndTable();
+  }
+#if !ENGINE_MEMORY_TRACKING
+  ImGui::TextDisabled("Tracking disabled (define ENGINE_MEMORY_TRACKING=1).");
+#endif
+
+  const EngineUtilities::TFrameArena& frameArena = g_bApp.m_frameArena;
+  ImGui::SeparatorText("Frame arena");
+  ImGui::Text("Last frame: %.1f / %.1f KB", frameArena.GetLastFrameHighWater() / 1024.0,
+              frameArena.GetCapacity() / 1024.0);
+  ImGui::Text("Peak: %.1f KB, overflowed frames: %llu", frameArena.GetPeakHighWater() / 1024.0,
+              static_cast<unsigned long long>(frameArena.GetOverflowFrameCount()));
+
+  ImGui::End();
+}
+
 void
 UserInterface::SceneGraphGUI(BaseApp& g_bApp) {
   ImGui::Begin("Scene Graph");
 
-  // Show each actor as selectable
-  if (!g_bApp.g_AKoro.isNull()) {
-    bool selected = (g_bApp.m_selectedActor == g_bApp.g_AKoro);
-    if (ImGui::Selectable("Koro", selected)) {
-      g_bApp.m_selectedActor = g_bApp.g_AKoro;
-    }
+  // Temporary list for this frame only: it comes from the frame arena (one pointer
+  // bump, no heap allocation) and is sorted by name so the order stays stable
+  // when g_actors swaps elements on removal.
+  struct SceneEntry {
+    const char* label;
+    EngineUtilities::SlotHandle handle;
+  };
+  EngineUtilities::TArray<SceneEntry, EngineUtilities::TFrameAllocator> entries;
+  entries.Reserve(g_bApp.g_actors.Num());
+  for (size_t i = 0; i < g_bApp.g_actors.Num(); ++i) {
+    entries.Add(SceneEntry{ g_bApp.g_actors.GetData()[i].getName().c_str(), g_bApp.g_actors.GetHandle(i) });
   }
-  if (!g_bApp.g_AShiba.isNull()) {
-    bool selected = (g_bApp.m_selectedActor == g_bApp.g_AShiba);
-    if (ImGui::Selectable("Shiba", selected)) {
-      g_bApp.m_selectedActor = g_bApp.g_AShiba;
-    }
-  }
-  if (!g_bApp.g_ARei.isNull()) {
-    bool selected = (g_bApp.m_selectedActor == g_bApp.g_ARei);
-    if (ImGui::Selectable("Rei", selected)) {
-      g_bApp.m_selectedActor = g_bApp.g_ARei;
+  std::sort(entries.begin(), entries.end(), [](const SceneEntry& a, const SceneEntry& b) {
+    return std::strcmp(a.label, b.label) < 0;
+  });
+
+  // Show each actor as selectable
+  for (const SceneEntry& entry : entries) {
+    ImGui::PushID(static_cast<int>(entry.handle.Index));
+    bool selected = (g_bApp.m_selectedActor == entry.handle);
+    if (ImGui::Selectable(entry.label, selected)) {
+      g_bApp.m_selectedActor = entry.handle;
     }
+    ImGui::PopID();
   }
 
   ImGui::End();
@@ -0,0 +1,64 @@
+// getArchetype must stop the program when not even one row of an archetype fits in
+// a chunk, in release builds too (these targets are built without assertions).
+// Archetypes whose rows only just fit are built and filled first. Then four 4090-byte
+// components, which only overflow once each array is aligned, must abort. The
+// ChunkLayoutOversizedTests build instead uses a single component larger than
+// ChunkBytes. The SIGABRT handler turns the expected abort into a zero exit; ctest
+// also requires World's message, since heap corruption can abort on its own.
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "ECS/World.h"
+
+namespace {
+  volatile std::sig_atomic_t g_validArchetypesBuilt = 0;
+
+  template <int N>
+  struct Big {
+    char bytes[4090];
+  };
+
+  struct Oversized {
+    char bytes[World::ChunkBytes + 1];
+  };
+
+  template <typename T>
+  T
+  filled(char value) {
+    T component;
+    std::memset(component.bytes, value, sizeof(component.bytes));
+    return component;
+  }
+
+  void
+  onAbort(int) {
+    // Aborting on an archetype that fits is a failure too.
+    std::_Exit(g_validArchetypesBuilt ? 0 : 1);
+  }
+}
+
+int
+main() {
+  std::signal(SIGABRT, onAbort);
+  World world;
+  EntityId one = world.createEntity(filled<Big<0>>(1));
+  EntityId three = world.createEntity(filled<Big<0>>(2), filled<Big<1>>(3), filled<Big<2>>(4));
+  // The last byte of each array must hold its own value, not the next array's.
+  if (world.getComponent<Big<0>>(one)->bytes[4089] != 1 || world.getComponent<Big<0>>(three)->bytes[4089] != 2 ||
+      world.getComponent<Big<1>>(three)->bytes[4089] != 3 || world.getComponent<Big<2>>(three)->bytes[4089] != 4) {
+    std::printf("components of a valid archetype overlap\n");
+    return 1;
+  }
+  g_validArchetypesBuilt = 1;
+
+#ifdef ENGINE_TEST_OVERSIZED_COMPONENT
+  std::printf("creating an entity with a %zu-byte component must abort\n", sizeof(Oversized));
+  world.createEntity(Oversized());
+#else
+  std::printf("adding a fourth 4090-byte component must abort\n");
+  world.addComponent<Big<3>>(three);
+#endif
+  std::printf("an archetype larger than a chunk did not abort\n");
+  return 1;
+}
@@ -0,0 +1,41 @@
+// registerComponentType must stop the program when a 65th component type is
+// registered, in release builds too (this target is built without assertions).
+// The SIGABRT handler turns the expected abort into a pass.
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include "ECS/World.h"
+
+namespace {
+  volatile std::sig_atomic_t g_registeredAll = 0;
+
+  template <int N>
+  struct Tag {
+    int value = N;
+  };
+
+  template <int... Ns>
+  void
+  registerTags(std::integer_sequence<int, Ns...>) {
+    using Expand = int[];
+    (void)Expand{ 0, (componentTypeId<Tag<Ns>>(), 0)... };
+  }
+
+  void
+  onAbort(int) {
+    // Aborting before all 64 types were registered is a failure too.
+    std::_Exit(g_registeredAll ? 0 : 1);
+  }
+}
+
+int
+main() {
+  std::signal(SIGABRT, onAbort);
+  registerTags(std::make_integer_sequence<int, MaxComponentTypes>());
+  g_registeredAll = 1;
+  std::printf("registered %u component types; registering one more must abort\n", MaxComponentTypes);
+  componentTypeId<Tag<static_cast<int>(MaxComponentTypes)>>();
+  std::printf("registration past MaxComponentTypes did not abort\n");
+  return 1;
+}
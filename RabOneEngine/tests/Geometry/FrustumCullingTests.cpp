@@ -0,0 +1,133 @@
+// The batch box culling (frustumTestAABBs, cullAABBs) against Frustum::intersects
+// on 100k boxes. Also built with ENGINE_NO_SIMD and without AVX so every path is
+// compared with the scalar test.
+#include <random>
+#include <vector>
+#include "Engine Utilities/Geometry/Frustum.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const size_t kBoxCount = 100000;
+
+  Frustum
+  cameraFrustum() {
+    Matrix4x4 view = Matrix4x4::lookAtLH(Vector3(3.0f, 5.0f, -20.0f), Vector3(0.0f, 0.0f, 10.0f),
+                                         Vector3(0.0f, 1.0f, 0.0f));
+    Matrix4x4 projection = Matrix4x4::perspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    return Frustum::fromViewProjection(view * projection);
+  }
+
+  std::vector<AABB>
+  randomBoxes(size_t count) {
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> position(-80.0f, 80.0f);
+    std::uniform_real_distribution<float> depth(-40.0f, 140.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 6.0f);
+    std::vector<AABB> boxes(count);
+    for (size_t i = 0; i < count; ++i) {
+      Vector3 center(position(rng), position(rng), depth(rng));
+      // Every 16th box is a point, the thinnest box the functions accept.
+      Vector3 extents = (i % 16 == 0) ? Vector3(0.0f, 0.0f, 0.0f) : Vector3(extent(rng), extent(rng), extent(rng));
+      boxes[i] = AABB::fromCenterExtents(center, extents);
+    }
+    return boxes;
+  }
+
+  void
+  testMatchesScalar() {
+    Frustum frustum = cameraFrustum();
+    std::vector<AABB> boxes = randomBoxes(kBoxCount);
+
+    std::vector<uint8_t> expected(kBoxCount);
+    std::vector<uint32_t> expectedIndices;
+    for (size_t i = 0; i < kBoxCount; ++i) {
+      expected[i] = frustum.intersects(boxes[i]) ? 1 : 0;
+      if (expected[i]) {
+        expectedIndices.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    // Both outcomes must be common for the comparison to mean anything.
+    ENGINE_CHECK(expectedIndices.size() > kBoxCount / 20);
+    ENGINE_CHECK(expectedIndices.size() < kBoxCount / 2);
+
+    std::vector<uint8_t> visible(kBoxCount, 2);
+    frustumTestAABBs(frustum, boxes.data(), visible.data(), kBoxCount);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < kBoxCount; ++i) {
+      mismatches += visible[i] != expected[i] ? 1 : 0;
+    }
+    ENGINE_CHECK(mismatches == 0);
+
+    std::vector<uint32_t> indices(kBoxCount);
+    size_t visibleCount = cullAABBs(frustum, boxes.data(), indices.data(), kBoxCount);
+    ENGINE_CHECK(visibleCount == expectedIndices.size());
+    indices.resize(visibleCount);
+    ENGINE_CHECK(indices == expectedIndices);
+  }
+
+  void
+  testTails() {
+    // Every count up to 17 mixes the 8-wide, 4-wide and scalar loops differently.
+    Frustum frustum = cameraFrustum();
+    std::vector<AABB> boxes = randomBoxes(64);
+    for (size_t offset = 0; offset < 4; ++offset) {
+      for (size_t count = 0; count <= 17; ++count) {
+        const AABB* first = boxes.data() + offset * 11;
+        std::vector<uint8_t> visible(count + 1, 2);
+        std::vector<uint32_t> indices(count + 1, 0xFFFFFFFFu);
+        frustumTestAABBs(frustum, first, visible.data(), count);
+        size_t visibleCount = cullAABBs(frustum, first, indices.data(), count);
+        size_t expectedCount = 0;
+        bool same = visible[count] == 2 && indices[count] == 0xFFFFFFFFu;
+        for (size_t i = 0; i < count; ++i) {
+          bool expected = frustum.intersects(first[i]);
+          same = same && visible[i] == (expected ? 1 : 0);
+          if (expected) {
+            same = same && expectedCount < visibleCount && indices[expectedCount] == i;
+            ++expectedCount;
+          }
+        }
+        ENGINE_CHECK(same);
+        ENGINE_CHECK(visibleCount == expectedCount);
+      }
+    }
+  }
+
+  void
+  testTouchingPlanes() {
+    // The default frustum is the clip volume -1 <= x, y <= 1, 0 <= z <= 1. A box
+    // that only touches a plane is kept; one just past it is culled.
+    Frustum frustum;
+    std::vector<AABB> boxes;
+    boxes.push_back(AABB(Vector3(1.0f, 0.0f, 0.5f), Vector3(2.0f, 0.5f, 0.75f)));
+    boxes.push_back(AABB(Vector3(-3.0f, -0.5f, 0.25f), Vector3(-1.0f, 0.5f, 0.5f)));
+    boxes.push_back(AABB(Vector3(0.0f, 0.0f, 1.0f), Vector3(0.5f, 0.5f, 1.0f)));
+    boxes.push_back(AABB(Vector3(-0.5f, -0.5f, -1.0f), Vector3(0.5f, 0.5f, 0.0f)));
+    boxes.push_back(AABB(Vector3(1.0625f, 0.0f, 0.5f), Vector3(2.0f, 0.5f, 0.75f)));
+    boxes.push_back(AABB(Vector3(0.0f, -2.0f, 0.5f), Vector3(0.5f, -1.0625f, 0.75f)));
+    boxes.push_back(AABB(Vector3(0.0f, 0.0f, 1.0625f), Vector3(0.5f, 0.5f, 2.0f)));
+    boxes.push_back(AABB(Vector3(-0.5f, -0.5f, -1.0f), Vector3(0.5f, 0.5f, -0.0625f)));
+    const uint8_t expected[8] = { 1, 1, 1, 1, 0, 0, 0, 0 };
+
+    uint8_t visible[8] = {};
+    frustumTestAABBs(frustum, boxes.data(), visible, boxes.size());
+    uint32_t indices[8] = {};
+    size_t visibleCount = cullAABBs(frustum, boxes.data(), indices, boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      ENGINE_CHECK(frustum.intersects(boxes[i]) == (expected[i] == 1));
+      ENGINE_CHECK(visible[i] == expected[i]);
+    }
+    ENGINE_CHECK(visibleCount == 4);
+    ENGINE_CHECK(indices[0] == 0 && indices[1] == 1 && indices[2] == 2 && indices[3] == 3);
+  }
+}
+
+int
+main() {
+  testMatchesScalar();
+  testTails();
+  testTouchingPlanes();
+  return EngineTests::testResult();
+}
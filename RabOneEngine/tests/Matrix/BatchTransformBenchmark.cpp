@@ -0,0 +1,77 @@
+// Million-vertex throughput of the BatchTransform kernels against a
+// Matrix4x4::transformPoint loop. Built twice: BatchTransformBenchmark uses the
+// best instruction set of the machine, BatchTransformBenchmarkSse stops at SSE4.
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Matrix/BatchTransform.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  /**
+   * @brief Same layout as SimpleVertex: a float3 position followed by a float2 uv.
+   */
+  struct Vertex {
+    Vector3 Pos;
+    float Tex[2];
+  };
+
+  const int kRepeats = 20;
+
+  template <typename Fn>
+  void
+  report(const char* name, size_t count, Fn fn) {
+    double ms = EngineTests::bestOfMs(kRepeats, fn);
+    std::printf("  %-28s %7.0f Mverts/s\n", name, static_cast<double>(count) / (ms * 1e3));
+  }
+
+  void
+  run(size_t count) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+    std::vector<Vector3> points(count);
+    std::vector<Vector3> results(count);
+    std::vector<Vertex> vertices(count);
+    std::vector<Vertex> transformed(count);
+    std::vector<float> x(count), y(count), z(count);
+    std::vector<float> ox(count), oy(count), oz(count);
+    for (size_t i = 0; i < count; ++i) {
+      points[i] = Vector3(coordinate(rng), coordinate(rng), coordinate(rng));
+      vertices[i].Pos = points[i];
+      x[i] = points[i].x;
+      y[i] = points[i].y;
+      z[i] = points[i].z;
+    }
+    Matrix4x4 matrix = Matrix4x4::compose(Vector3(1.0f, 2.0f, 3.0f), Vector3(0.3f, 0.7f, 0.1f), Vector3(2.0f, 2.0f, 2.0f));
+
+    std::printf("%zu vertices (%s):\n", count,
+                ENGINE_SIMD_AVX2 ? "AVX2" : (ENGINE_SIMD_SSE2 ? "SSE" : "scalar"));
+    report("Matrix4x4::transformPoint", count, [&]() {
+      for (size_t i = 0; i < count; ++i) {
+        results[i] = matrix.transformPoint(points[i]);
+      }
+      EngineTests::doNotOptimize(results[0]);
+    });
+    report("transformPointsSoA", count, [&]() {
+      transformPointsSoA(matrix, x.data(), y.data(), z.data(), ox.data(), oy.data(), oz.data(), count);
+      EngineTests::doNotOptimize(ox[0]);
+    });
+    report("transformPoints (Vector3)", count, [&]() {
+      transformPoints(matrix, points.data(), results.data(), count);
+      EngineTests::doNotOptimize(results[0]);
+    });
+    report("transformPointsAoS (vertex)", count, [&]() {
+      transformPointsAoS(matrix, &vertices[0].Pos, sizeof(Vertex), &transformed[0].Pos, sizeof(Vertex), count);
+      EngineTests::doNotOptimize(transformed[0]);
+    });
+  }
+}
+
+int
+main() {
+  run(16 * 1024);
+  run(1024 * 1024);
+  return 0;
+}
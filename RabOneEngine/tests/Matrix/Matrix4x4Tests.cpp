@@ -0,0 +1,292 @@
+// Matrix4x4 against double-precision references: multiply, inverse and affineInverse,
+// compose against the rotation-matrix products, and compose/decompose round trips,
+// including pitches within a hair of +-90 degrees. Built with the machine's
+// instruction set and with ENGINE_NO_SIMD.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Engine Utilities/Matrix/Matrix4x4.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const double kPi = 3.14159265358979323846;
+
+  struct Matrix4d {
+    double m[4][4];
+  };
+
+  Matrix4d
+  toDouble(const Matrix4x4& a) {
+    Matrix4d r;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        r.m[i][j] = a.m[i][j];
+      }
+    }
+    return r;
+  }
+
+  Matrix4d
+  multiply(const Matrix4d& a, const Matrix4d& b) {
+    Matrix4d r;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j] + a.m[i][3] * b.m[3][j];
+      }
+    }
+    return r;
+  }
+
+  /** Gauss-Jordan elimination with partial pivoting. */
+  Matrix4d
+  inverse(Matrix4d a) {
+    Matrix4d r = {};
+    for (int i = 0; i < 4; ++i) {
+      r.m[i][i] = 1.0;
+    }
+    for (int column = 0; column < 4; ++column) {
+      int pivot = column;
+      for (int row = column + 1; row < 4; ++row) {
+        if (std::fabs(a.m[row][column]) > std::fabs(a.m[pivot][column])) {
+          pivot = row;
+        }
+      }
+      for (int j = 0; j < 4; ++j) {
+        std::swap(a.m[column][j], a.m[pivot][j]);
+        std::swap(r.m[column][j], r.m[pivot][j]);
+      }
+      double scale = 1.0 / a.m[column][column];
+      for (int j = 0; j < 4; ++j) {
+        a.m[column][j] *= scale;
+        r.m[column][j] *= scale;
+      }
+      for (int row = 0; row < 4; ++row) {
+        if (row != column) {
+          double factor = a.m[row][column];
+          for (int j = 0; j < 4; ++j) {
+            a.m[row][j] -= factor * a.m[column][j];
+            r.m[row][j] -= factor * r.m[column][j];
+          }
+        }
+      }
+    }
+    return r;
+  }
+
+  /** Largest element difference, relative to the largest element of the reference. */
+  double
+  relativeError(const Matrix4x4& actual, const Matrix4d& expected) {
+    double largest = 0.0;
+    double error = 0.0;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        largest = std::fmax(largest, std::fabs(expected.m[i][j]));
+        error = std::fmax(error, std::fabs(actual.m[i][j] - expected.m[i][j]));
+      }
+    }
+    return error / (largest > 1.0 ? largest : 1.0);
+  }
+
+  Matrix4x4
+  randomMatrix(std::mt19937& rng) {
+    std::uniform_real_distribution<float> element(-4.0f, 4.0f);
+    Matrix4x4 r;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        r.m[i][j] = element(rng);
+      }
+    }
+    return r;
+  }
+
+  Matrix4x4
+  randomAffine(std::mt19937& rng) {
+    std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+    std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+    std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+    return Matrix4x4::compose(Vector3(offset(rng), offset(rng), offset(rng)),
+                              Vector3(angle(rng) * 0.5f, angle(rng), angle(rng)),
+                              Vector3(scale(rng), scale(rng), scale(rng)));
+  }
+
+  void
+  testMultiply() {
+    std::mt19937 rng(18);
+    double worst = 0.0;
+    for (int i = 0; i < 10000; ++i) {
+      Matrix4x4 a = randomMatrix(rng);
+      Matrix4x4 b = randomMatrix(rng);
+      worst = std::fmax(worst, relativeError(a * b, multiply(toDouble(a), toDouble(b))));
+    }
+    std::printf("multiply: max relative error %.3g\n", worst);
+    ENGINE_CHECK(worst < 1e-6);
+
+    Matrix4x4 a = randomMatrix(rng);
+    ENGINE_CHECK(relativeError(a * Matrix4x4(), toDouble(a)) == 0.0);
+    ENGINE_CHECK(relativeError(Matrix4x4() * a, toDouble(a)) == 0.0);
+  }
+
+  void
+  testInverse() {
+    std::mt19937 rng(19);
+    double worstGeneral = 0.0;
+    double worstAffine = 0.0;
+    double worstAffineAgainstGeneral = 0.0;
+    int tested = 0;
+    while (tested < 10000) {
+      Matrix4x4 a = randomMatrix(rng);
+      Matrix4d reference = inverse(toDouble(a));
+      // Skip badly conditioned matrices, where float cannot be expected to agree.
+      double referenceLargest = 0.0;
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          referenceLargest = std::fmax(referenceLargest, std::fabs(reference.m[i][j]));
+        }
+      }
+      if (referenceLargest > 10.0) {
+        continue;
+      }
+      worstGeneral = std::fmax(worstGeneral, relativeError(a.inverse(), reference));
+      ++tested;
+
+      Matrix4x4 affine = randomAffine(rng);
+      Matrix4d affineReference = inverse(toDouble(affine));
+      worstAffine = std::fmax(worstAffine, relativeError(affine.affineInverse(), affineReference));
+      worstAffineAgainstGeneral =
+        std::fmax(worstAffineAgainstGeneral, relativeError(affine.affineInverse(), toDouble(affine.inverse())));
+    }
+    std::printf("inverse: max relative error %.3g; affineInverse %.3g (%.3g against inverse)\n", worstGeneral,
+                worstAffine, worstAffineAgainstGeneral);
+    ENGINE_CHECK(worstGeneral < 1e-4);
+    ENGINE_CHECK(worstAffine < 1e-4);
+    ENGINE_CHECK(worstAffineAgainstGeneral < 1e-4);
+
+    // A * A^-1 is the identity, and singular matrices give the identity.
+    Matrix4x4 affine = randomAffine(rng);
+    Matrix4d identity = {};
+    for (int i = 0; i < 4; ++i) {
+      identity.m[i][i] = 1.0;
+    }
+    ENGINE_CHECK(relativeError(affine * affine.affineInverse(), identity) < 1e-5);
+    ENGINE_CHECK(relativeError(affine * affine.inverse(), identity) < 1e-5);
+    Matrix4x4 singular = Matrix4x4::scaling(Vector3(1.0f, 0.0f, 1.0f));
+    ENGINE_CHECK(relativeError(singular.inverse(), identity) == 0.0);
+    ENGINE_CHECK(relativeError(singular.affineInverse(), identity) == 0.0);
+  }
+
+  void
+  testCompose() {
+    // compose(p, r, s) == scaling(s) * rotationZ(roll) * rotationX(pitch) * rotationY(yaw) * translation(p).
+    std::mt19937 rng(20);
+    std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+    std::uniform_real_distribution<float> scale(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+    double worst = 0.0;
+    for (int i = 0; i < 10000; ++i) {
+      Vector3 position(offset(rng), offset(rng), offset(rng));
+      Vector3 rotation(angle(rng), angle(rng), angle(rng));
+      Vector3 scales(scale(rng), scale(rng), scale(rng));
+      Matrix4d expected = multiply(
+        multiply(multiply(multiply(toDouble(Matrix4x4::scaling(scales)), toDouble(Matrix4x4::rotationZ(rotation.z))),
+                          toDouble(Matrix4x4::rotationX(rotation.x))),
+                 toDouble(Matrix4x4::rotationY(rotation.y))),
+        toDouble(Matrix4x4::translation(position)));
+      worst = std::fmax(worst, relativeError(Matrix4x4::compose(position, rotation, scales), expected));
+    }
+    std::printf("compose: max relative error %.3g\n", worst);
+    ENGINE_CHECK(worst < 1e-5);
+  }
+
+  /** Error of compose(decompose(m)) against m, relative to the largest element of m. */
+  double
+  roundTripError(const Matrix4x4& matrix, bool& decomposed) {
+    Vector3 position;
+    Vector3 rotation;
+    Vector3 scale;
+    decomposed = matrix.decompose(position, rotation, scale);
+    return relativeError(Matrix4x4::compose(position, rotation, scale), toDouble(matrix));
+  }
+
+  void
+  testDecompose() {
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+    std::uniform_real_distribution<float> pitchAngle(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+    std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+    bool allDecomposed = true;
+    bool anglesRecovered = true;
+    double worst = 0.0;
+    for (int i = 0; i < 10000; ++i) {
+      Vector3 position(offset(rng), offset(rng), offset(rng));
+      Vector3 rotation(pitchAngle(rng), angle(rng), angle(rng));
+      // Every other matrix mirrors X, which decompose folds into a negative X scale.
+      Vector3 scales(i % 2 ? -scale(rng) : scale(rng), scale(rng), scale(rng));
+      Matrix4x4 matrix = Matrix4x4::compose(position, rotation, scales);
+
+      Vector3 outPosition;
+      Vector3 outRotation;
+      Vector3 outScale;
+      bool decomposed = matrix.decompose(outPosition, outRotation, outScale);
+      allDecomposed = allDecomposed && decomposed;
+      anglesRecovered = anglesRecovered && std::fabs(outRotation.x - rotation.x) < 1e-3f &&
+                        std::fabs(outRotation.y - rotation.y) < 1e-3f && std::fabs(outRotation.z - rotation.z) < 1e-3f &&
+                        std::fabs(outScale.x - scales.x) < 1e-4f * std::fabs(scales.x);
+      worst = std::fmax(worst, relativeError(Matrix4x4::compose(outPosition, outRotation, outScale), toDouble(matrix)));
+    }
+    std::printf("decompose: max round-trip error %.3g\n", worst);
+    ENGINE_CHECK(allDecomposed);
+    ENGINE_CHECK(anglesRecovered);
+    ENGINE_CHECK(worst < 1e-5);
+
+    // A zero scale cannot be decomposed.
+    bool decomposed = true;
+    roundTripError(Matrix4x4::scaling(Vector3(1.0f, 0.0f, 1.0f)), decomposed);
+    ENGINE_CHECK(!decomposed);
+  }
+
+  void
+  testDecomposeNearGimbalLock() {
+    // Pitches from exactly +-90 degrees to a few degrees away. Yaw and roll are not
+    // unique there, but the recomposed matrix must still match the original.
+    std::mt19937 rng(22);
+    std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+    const double offsets[] = { 0.0,  1e-7, 1e-6, 3e-6, 1e-5, 3e-5, 5e-5,   1e-4, 2e-4,
+                               3e-4, 5e-4, 1e-3, 3e-3, 0.01, 0.0141, 0.02, 0.05 };
+    double worst = 0.0;
+    double worstOffset = 0.0;
+    bool allDecomposed = true;
+    for (double offset : offsets) {
+      for (int sign = -1; sign <= 1; sign += 2) {
+        for (int i = 0; i < 2000; ++i) {
+          float pitch = static_cast<float>(sign * (kPi / 2.0 - offset));
+          Matrix4x4 matrix = Matrix4x4::compose(Vector3(1.0f, 2.0f, 3.0f), Vector3(pitch, angle(rng), angle(rng)),
+                                                Vector3(1.0f, 2.0f, 0.5f));
+          bool decomposed = false;
+          double error = roundTripError(matrix, decomposed);
+          allDecomposed = allDecomposed && decomposed;
+          if (error > worst) {
+            worst = error;
+            worstOffset = offset;
+          }
+        }
+      }
+    }
+    std::printf("decompose near +-90 degrees pitch: max round-trip error %.3g (%.3g rad from the pole)\n", worst,
+                worstOffset);
+    ENGINE_CHECK(allDecomposed);
+    ENGINE_CHECK(worst < 1e-5);
+  }
+}
+
+int
+main() {
+  testMultiply();
+  testInverse();
+  testCompose();
+  testDecompose();
+  testDecomposeNearGimbalLock();
+  return EngineTests::testResult();
+}
@@ -0,0 +1,81 @@
+// TFixedPool: block size and alignment never drop below what the intrusive free
+// list needs, blocks are reused LIFO, and requests the pool cannot serve go to
+// the heap and are counted.
+#include <cstdint>
+#include <vector>
+#include "Engine Utilities/Memory/TAllocator.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  bool
+  pointerAligned(const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignof(void*) == 0;
+  }
+
+  void
+  testSmallAlignment() {
+    // 9-byte blocks with alignment 1 used to be packed 9 bytes apart, so every other
+    // free-list link was written through a misaligned void**.
+    const size_t alignments[] = { 1, 2, 4 };
+    for (size_t alignment : alignments) {
+      TFixedPool pool(9, 16, alignment);
+      ENGINE_CHECK(pool.GetBlockSize() % alignof(void*) == 0 && pool.GetBlockSize() >= 9);
+      std::vector<void*> blocks;
+      bool aligned = true;
+      for (int i = 0; i < 16; ++i) {
+        void* block = pool.Allocate(9, alignment);
+        aligned = aligned && pointerAligned(block) && pool.Owns(block);
+        blocks.push_back(block);
+      }
+      ENGINE_CHECK(aligned);
+      ENGINE_CHECK(pool.GetFreeCount() == 0 && pool.GetOverflowCount() == 0);
+      for (void* block : blocks) {
+        pool.Deallocate(block, 9, alignment);
+      }
+      ENGINE_CHECK(pool.GetFreeCount() == 16);
+    }
+
+    TFixedPool tiny(1, 4, 1);
+    ENGINE_CHECK(tiny.GetBlockSize() == sizeof(void*));
+  }
+
+  void
+  testReuseAndOverflow() {
+    TFixedPool pool(32, 4, 16);
+    ENGINE_CHECK(pool.GetBlockSize() == 32);
+    void* first = pool.Allocate(32, 16);
+    void* second = pool.Allocate(20, 8);
+    ENGINE_CHECK(reinterpret_cast<uintptr_t>(first) % 16 == 0 && reinterpret_cast<uintptr_t>(second) % 16 == 0);
+    pool.Deallocate(first, 32, 16);
+    ENGINE_CHECK(pool.Allocate(32, 16) == first);  // The last block freed is the next one handed out.
+
+    void* large = pool.Allocate(64, 16);
+    void* overAligned = pool.Allocate(16, 64);
+    ENGINE_CHECK(!pool.Owns(large) && !pool.Owns(overAligned));
+    ENGINE_CHECK(reinterpret_cast<uintptr_t>(overAligned) % 64 == 0);
+    ENGINE_CHECK(pool.GetOverflowCount() == 2);
+    pool.Deallocate(large, 64, 16);
+    pool.Deallocate(overAligned, 16, 64);
+
+    void* third = pool.Allocate(32, 16);
+    void* fourth = pool.Allocate(32, 16);
+    void* exhausted = pool.Allocate(32, 16);
+    ENGINE_CHECK(pool.Owns(third) && pool.Owns(fourth) && !pool.Owns(exhausted));
+    ENGINE_CHECK(pool.GetFreeCount() == 0 && pool.GetOverflowCount() == 3);
+    pool.Deallocate(exhausted, 32, 16);
+    pool.Deallocate(fourth, 32, 16);
+    pool.Deallocate(third, 32, 16);
+    pool.Deallocate(second, 20, 8);
+    pool.Deallocate(first, 32, 16);
+    ENGINE_CHECK(pool.GetFreeCount() == 4);
+  }
+}
+
+int
+main() {
+  testSmallAlignment();
+  testReuseAndOverflow();
+  return EngineTests::testResult();
+}
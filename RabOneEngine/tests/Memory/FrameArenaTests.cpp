@@ -0,0 +1,127 @@
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "Engine Utilities/Memory/TFrameArena.h"
+#include "Engine Utilities/Structures/TArray.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+// Counts every general-heap allocation made through operator new.
+static size_t g_heapAllocations = 0;
+
+void*
+operator new(size_t size) {
+  ++g_heapAllocations;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+  struct SceneEntry {
+    const char* label;
+    uint32_t handle;
+  };
+
+  /**
+   * @brief The kind of work BaseApp::update/render do with frame memory: a reserved
+   * frame-allocated container plus a FrameAlloc scratch array.
+   */
+  void
+  simulateFrame(size_t actorCount) {
+    TArray<SceneEntry, TFrameAllocator> entries;
+    entries.Reserve(actorCount);
+    for (size_t i = 0; i < actorCount; ++i) {
+      entries.Add(SceneEntry{ "Actor", static_cast<uint32_t>(i) });
+    }
+    float* weights = FrameAlloc<float>(256);
+    weights[255] = static_cast<float>(entries.Num());
+    EngineTests::doNotOptimize(weights[255]);
+  }
+
+  void
+  testSteadyStateHasNoHeapAllocations() {
+    TFrameArena arena(64 * 1024);
+    TFrameArena::SetActive(&arena);
+    for (int frame = 0; frame < 3; ++frame) {
+      arena.BeginFrame();
+      simulateFrame(4);
+    }
+    size_t before = g_heapAllocations;
+    for (int frame = 0; frame < 100; ++frame) {
+      arena.BeginFrame();
+      simulateFrame(4);
+      ENGINE_CHECK(arena.GetFrameUsed() > 0);
+    }
+    ENGINE_CHECK(g_heapAllocations == before);
+    ENGINE_CHECK(arena.GetOverflowFrameCount() == 0);
+    arena.BeginFrame();
+    ENGINE_CHECK(arena.GetLastFrameOverflowCount() == 0);
+    ENGINE_CHECK(arena.GetLastFrameHighWater() >= 4 * sizeof(SceneEntry) + 256 * sizeof(float));
+    TFrameArena::SetActive(nullptr);
+  }
+
+  void
+  testDoubleBufferKeepsPreviousFrame() {
+    TFrameArena arena(1024);
+    TFrameArena::SetActive(&arena);
+    arena.BeginFrame();
+    int* previous = FrameAlloc<int>(4);
+    previous[0] = 42;
+    arena.BeginFrame();
+    int* current = FrameAlloc<int>(4);
+    current[0] = 7;
+    // Data from frame N is still intact during frame N + 1.
+    ENGINE_CHECK(previous[0] == 42);
+    ENGINE_CHECK(previous != current);
+    arena.BeginFrame();
+    // Two frames later the first buffer is reused from its start.
+    ENGINE_CHECK(FrameAlloc<int>(4) == previous);
+    TFrameArena::SetActive(nullptr);
+  }
+
+  void
+  testOverflowFallsBackToHeap() {
+    TFrameArena arena(256);
+    TFrameArena::SetActive(&arena);
+    arena.BeginFrame();
+    size_t before = g_heapAllocations;
+    char* big = FrameAlloc<char>(1024);
+    ENGINE_CHECK(big != nullptr);
+    big[1023] = 1;
+    ENGINE_CHECK(g_heapAllocations == before + 1);
+    arena.BeginFrame();
+    ENGINE_CHECK(arena.GetLastFrameOverflowCount() == 1);
+    ENGINE_CHECK(arena.GetOverflowFrameCount() == 1);
+    TFrameArena::SetActive(nullptr);
+  }
+
+  void
+  testNoActiveArenaUsesHeap() {
+    ENGINE_CHECK(FrameAlloc<int>(4) == nullptr);
+    TArray<int, TFrameAllocator> values;
+    values.Add(1);
+    ENGINE_CHECK(values.Num() == 1 && values[0] == 1);
+  }
+}
+
+int
+main() {
+  testSteadyStateHasNoHeapAllocations();
+  testDoubleBufferKeepsPreviousFrame();
+  testOverflowFallsBackToHeap();
+  testNoActiveArenaUsesHeap();
+  return EngineTests::testResult();
+}
@@ -0,0 +1,201 @@
+// Built with ENGINE_MEMORY_TRACKING=1 (counters only), with
+// ENGINE_MEMORY_LEAK_TRACKING=1 (counters plus the live-allocation list), and with
+// tracking off, where Allocate must still honour the requested alignment.
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Memory/MemoryTracker.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+#if ENGINE_MEMORY_TRACKING
+  MemoryTagStats
+  statsFor(MemoryTag tag) {
+    MemoryTagStats stats[MemoryTagCount];
+    MemoryTracker::GetStats(stats);
+    return stats[static_cast<size_t>(tag)];
+  }
+
+  void
+  testAlignmentAndTagging() {
+    MemoryTagStats before = statsFor(MemoryTag::Texture);
+    void* p;
+    {
+      ENGINE_MEMORY_SCOPE(Texture);
+      ENGINE_CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Texture);
+      p = MemoryTracker::Allocate(100, 64);
+    }
+    ENGINE_CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Misc);
+    ENGINE_CHECK(reinterpret_cast<uintptr_t>(p) % 64 == 0);
+    std::memset(p, 0xab, 100);
+
+    MemoryTagStats during = statsFor(MemoryTag::Texture);
+    ENGINE_CHECK(during.LiveBytes == before.LiveBytes + 100);
+    ENGINE_CHECK(during.LiveCount == before.LiveCount + 1);
+    ENGINE_CHECK(during.TotalAllocations == before.TotalAllocations + 1);
+
+    // Freed outside the scope: still charged back to Texture.
+    MemoryTracker::Deallocate(p, 64);
+    MemoryTagStats after = statsFor(MemoryTag::Texture);
+    ENGINE_CHECK(after.LiveBytes == before.LiveBytes);
+    ENGINE_CHECK(after.LiveCount == before.LiveCount);
+    MemoryTracker::Deallocate(nullptr);
+  }
+
+  /**
+   * @brief The peak must be recorded when the memory is allocated, not when somebody
+   * happens to read the stats; nothing calls GetStats while the buffers are alive here.
+   */
+  void
+  testPeakIsTrackedOnAllocation() {
+    const int64_t big = 4 * 1024 * 1024;
+    {
+      ENGINE_MEMORY_SCOPE(Mesh);
+      void* p = MemoryTracker::Allocate(static_cast<size_t>(big), 16);
+      MemoryTracker::Deallocate(p);
+    }
+    MemoryTagStats mesh = statsFor(MemoryTag::Mesh);
+    ENGINE_CHECK(mesh.PeakBytes >= big);
+    ENGINE_CHECK(mesh.LiveBytes == 0);
+
+    // Many small allocations: the peak may lag by at most PeakResolution for this thread.
+    const int count = 4096;
+    const int64_t small = 256;
+    std::vector<void*> blocks(count);
+    {
+      ENGINE_MEMORY_SCOPE(Loader);
+      for (void*& block : blocks) {
+        block = MemoryTracker::Allocate(static_cast<size_t>(small), 16);
+      }
+    }
+    for (void* block : blocks) {
+      MemoryTracker::Deallocate(block);
+    }
+    MemoryTagStats loader = statsFor(MemoryTag::Loader);
+    ENGINE_CHECK(loader.PeakBytes >= count * small - MemoryTracker::PeakResolution);
+    ENGINE_CHECK(loader.PeakBytes <= count * small);
+    ENGINE_CHECK(loader.LiveBytes == 0);
+  }
+
+  /**
+   * @brief Allocations made on worker threads and freed on another thread, including after
+   * the workers have exited, still sum to zero.
+   */
+  void
+  testCrossThreadCounts() {
+    const int threads = 4;
+    const int perThread = 20000;
+    MemoryTagStats before = statsFor(MemoryTag::UI);
+
+    std::vector<std::vector<void*>> blocks(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.emplace_back([&blocks, t]() {
+        ENGINE_MEMORY_SCOPE(UI);
+        blocks[t].reserve(perThread);
+        for (int i = 0; i < perThread; ++i) {
+          void* p = MemoryTracker::Allocate(static_cast<size_t>(16 + i % 64), 16);
+          if (i % 2) {
+            MemoryTracker::Deallocate(p);
+          }
+          else {
+            blocks[t].push_back(p);
+          }
+        }
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    MemoryTagStats during = statsFor(MemoryTag::UI);
+    ENGINE_CHECK(during.LiveCount == before.LiveCount + threads * perThread / 2);
+    ENGINE_CHECK(during.TotalAllocations == before.TotalAllocations + threads * perThread);
+    ENGINE_CHECK(during.LiveBytes > before.LiveBytes);
+    ENGINE_CHECK(during.PeakBytes >= during.LiveBytes);
+
+    for (std::vector<void*>& list : blocks) {
+      for (void* p : list) {
+        MemoryTracker::Deallocate(p);
+      }
+    }
+    MemoryTagStats after = statsFor(MemoryTag::UI);
+    ENGINE_CHECK(after.LiveCount == before.LiveCount);
+    ENGINE_CHECK(after.LiveBytes == before.LiveBytes);
+  }
+
+  void
+  testReport() {
+    void* p;
+    {
+      ENGINE_MEMORY_SCOPE(ECS);
+      p = MemoryTracker::Allocate(12345, 16);
+    }
+    std::string report = MemoryTracker::BuildReport();
+    ENGINE_CHECK(report.find("ECS") != std::string::npos);
+#if ENGINE_MEMORY_LEAK_TRACKING
+    ENGINE_CHECK(report.find("MemoryTrackerTests.cpp") != std::string::npos);
+    ENGINE_CHECK(report.find("[ECS] 12345 bytes in 1 allocations") != std::string::npos);
+#else
+    ENGINE_CHECK(report.find("ENGINE_MEMORY_LEAK_TRACKING=1") != std::string::npos);
+#endif
+    MemoryTracker::Deallocate(p);
+#if ENGINE_MEMORY_LEAK_TRACKING
+    ENGINE_CHECK(MemoryTracker::BuildReport().find("12345 bytes") == std::string::npos);
+#endif
+  }
+#else
+  /**
+   * @brief With tracking off Allocate goes straight to HeapAllocate: every alignment is
+   * honoured, nothing is tagged or counted, and the report says so.
+   */
+  void
+  testDisabled() {
+    bool aligned = true;
+    for (size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+      const size_t sizes[] = { 0, 1, 100, 5000 };
+      for (size_t size : sizes) {
+        void* p = MemoryTracker::Allocate(size, alignment);
+        aligned = aligned && p && reinterpret_cast<uintptr_t>(p) % alignment == 0;
+        std::memset(p, 0xab, size);
+        MemoryTracker::Deallocate(p, alignment);
+      }
+    }
+    ENGINE_CHECK(aligned);
+    MemoryTracker::Deallocate(nullptr);
+
+    void* p;
+    {
+      ENGINE_MEMORY_SCOPE(Texture);
+      ENGINE_CHECK(MemoryTracker::GetCurrentTag() == MemoryTag::Misc);
+      p = MemoryTracker::Allocate(100, 16);
+    }
+    MemoryTagStats stats[MemoryTagCount];
+    MemoryTracker::GetStats(stats);
+    bool zero = true;
+    for (const MemoryTagStats& tag : stats) {
+      zero = zero && tag.LiveBytes == 0 && tag.LiveCount == 0 && tag.TotalAllocations == 0;
+    }
+    ENGINE_CHECK(zero);
+    ENGINE_CHECK(MemoryTracker::BuildReport().find("ENGINE_MEMORY_TRACKING=1") != std::string::npos);
+    MemoryTracker::Deallocate(p, 16);
+  }
+#endif
+}
+
+int
+main() {
+#if ENGINE_MEMORY_TRACKING
+  testAlignmentAndTagging();
+  testPeakIsTrackedOnAllocation();
+  testCrossThreadCounts();
+  testReport();
+#else
+  testDisabled();
+#endif
+  return EngineTests::testResult();
+}
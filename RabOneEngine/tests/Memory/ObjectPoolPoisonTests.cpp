@@ -0,0 +1,42 @@
+// With ENGINE_POOL_POISONING=1, TObjectPool must stop the program when a freed
+// slot was written before it is handed out again, in release builds too (this
+// target is built without assertions). The SIGABRT handler turns the expected
+// abort into a pass.
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include "Engine Utilities/Memory/TObjectPool.h"
+
+namespace {
+  volatile std::sig_atomic_t g_reusedCleanSlot = 0;
+
+  struct Particle {
+    int id = 0;
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+  };
+
+  void
+  onAbort(int) {
+    // Aborting on the untouched slot would be a false positive.
+    std::_Exit(g_reusedCleanSlot ? 0 : 1);
+  }
+}
+
+int
+main() {
+  std::signal(SIGABRT, onAbort);
+  EngineUtilities::TObjectPool<Particle> pool;
+
+  Particle* clean = pool.Create();
+  pool.Destroy(clean);
+  Particle* reused = pool.Create();
+  g_reusedCleanSlot = reused == clean;
+  pool.Destroy(reused);
+
+  // A stale pointer writes past the free-list link of the freed slot.
+  reused->position[2] = 1.0f;
+  std::printf("wrote to a freed slot; reusing it must abort\n");
+  pool.Create();
+  std::printf("reusing a slot written after free did not abort\n");
+  return 1;
+}
@@ -0,0 +1,213 @@
+// TObjectPool: chunk growth, LIFO slot reuse, MakeSharedPooled, and the shared
+// pool with per-thread caches under cross-thread frees and thread exit (also built
+// with ThreadSanitizer). Built with ENGINE_POOL_POISONING=1, so every reused slot
+// is checked for writes after free.
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Memory/TObjectPool.h"
+#include "Engine Utilities/Memory/TWeakPointer.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  struct Particle {
+    explicit Particle(int InId = 0) : id(InId) {}
+    int id;
+    float position[3] = { 0.0f, 0.0f, 0.0f };
+  };
+
+  /** Distinct types, so each test gets its own shared pool from Get(). */
+  struct Pooled : Particle {
+    using Particle::Particle;
+  };
+  struct Handed : Particle {
+    using Particle::Particle;
+  };
+
+  void
+  testChunkGrowth() {
+    TObjectPool<Particle, 8> pool;
+    ENGINE_CHECK(pool.GetChunkCount() == 0 && pool.GetCapacity() == 0);
+
+    std::vector<Particle*> objects;
+    for (int i = 0; i < 8; ++i) {
+      objects.push_back(pool.Create(i));
+    }
+    ENGINE_CHECK(pool.GetChunkCount() == 1 && pool.GetLiveCount() == 8);
+    // A fresh chunk hands out its slots in address order, one slot apart.
+    bool contiguous = true;
+    for (int i = 1; i < 8; ++i) {
+      uintptr_t step = reinterpret_cast<uintptr_t>(objects[i]) - reinterpret_cast<uintptr_t>(objects[i - 1]);
+      contiguous = contiguous && step == sizeof(Particle);
+    }
+    ENGINE_CHECK(contiguous);
+
+    objects.push_back(pool.Create(8));
+    ENGINE_CHECK(pool.GetChunkCount() == 2 && pool.GetCapacity() == 16 && pool.GetLiveCount() == 9);
+    for (int i = 9; i < 40; ++i) {
+      objects.push_back(pool.Create(i));
+    }
+    ENGINE_CHECK(pool.GetChunkCount() == 5);
+
+    bool intact = true;
+    for (int i = 0; i < 40; ++i) {
+      intact = intact && objects[i]->id == i;
+    }
+    ENGINE_CHECK(intact);
+    for (Particle* object : objects) {
+      pool.Destroy(object);
+    }
+    // Chunks are kept until the pool is destroyed.
+    ENGINE_CHECK(pool.GetLiveCount() == 0 && pool.GetChunkCount() == 5);
+    for (int i = 0; i < 40; ++i) {
+      pool.Destroy(pool.Create(i));
+    }
+    ENGINE_CHECK(pool.GetChunkCount() == 5);
+  }
+
+  void
+  testReuseOrder() {
+    TObjectPool<Particle, 8> pool;
+    Particle* a = pool.Create(1);
+    Particle* b = pool.Create(2);
+    Particle* c = pool.Create(3);
+    // The free list is LIFO: the most recently freed slot comes back first.
+    pool.Destroy(a);
+    pool.Destroy(c);
+    ENGINE_CHECK(pool.Create(4) == c);
+    ENGINE_CHECK(pool.Create(5) == a);
+    pool.Deallocate(nullptr);
+    ENGINE_CHECK(pool.GetLiveCount() == 3);
+    (void)b;
+
+    // The shared pool's per-thread cache reuses in the same order.
+    TObjectPool<Pooled>& shared = TObjectPool<Pooled>::Get();
+    shared.SetThreadCacheEnabled(true);
+    Pooled* first = shared.Create(1);
+    Pooled* second = shared.Create(2);
+    shared.Destroy(first);
+    shared.Destroy(second);
+    ENGINE_CHECK(shared.Create(3) == second);
+    ENGINE_CHECK(shared.Create(4) == first);
+    shared.Destroy(first);
+    shared.Destroy(second);
+    ENGINE_CHECK(shared.GetLiveCount() == 0);
+  }
+
+  void
+  testMakeSharedPooled() {
+    // The object and its control block share one slot of the block type's pool; the
+    // slot goes back when the last weak pointer does, not when the object dies.
+    TWeakPointer<Particle> weak;
+    {
+      TSharedPointer<Particle> shared = MakeSharedPooled<Particle>(7);
+      ENGINE_CHECK(shared->id == 7);
+      weak = shared;
+    }
+    ENGINE_CHECK(weak.expired());
+    typedef TInlineControlBlock<Particle, RefCountMode::ThreadSafe, TObjectPoolAllocator> Block;
+    ENGINE_CHECK(TObjectPool<Block>::Get().GetLiveCount() == 1);
+    weak.reset();
+    ENGINE_CHECK(TObjectPool<Block>::Get().GetLiveCount() == 0);
+  }
+
+  void
+  testThreadCaches() {
+    // Producers create objects and hand half of them to a consumer thread, which
+    // destroys them (a cross-thread free into the consumer's cache). Every thread
+    // also creates and destroys its own objects, and exits with slots left in its
+    // cache; ThreadCache's destructor hands them back to the pool under its mutex.
+    TObjectPool<Handed>& pool = TObjectPool<Handed>::Get();
+    pool.SetThreadCacheEnabled(true);
+    const int producerCount = 3;
+    const int objectsPerProducer = 20000;
+    std::mutex handoffMutex;
+    std::vector<Handed*> handoff;
+    std::atomic<int> producersDone(0);
+    std::atomic<int> corrupted(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producerCount; ++p) {
+      threads.emplace_back([&, p]() {
+        std::vector<Handed*> own;
+        for (int i = 0; i < objectsPerProducer; ++i) {
+          Handed* object = pool.Create(p * objectsPerProducer + i);
+          if (i % 2 == 0) {
+            std::lock_guard<std::mutex> lock(handoffMutex);
+            handoff.push_back(object);
+          }
+          else {
+            own.push_back(object);
+          }
+          if (own.size() == 48) {
+            for (Handed* mine : own) {
+              corrupted += mine->id < p * objectsPerProducer || mine->id >= (p + 1) * objectsPerProducer;
+              pool.Destroy(mine);
+            }
+            own.clear();
+          }
+        }
+        for (Handed* mine : own) {
+          pool.Destroy(mine);
+        }
+        ++producersDone;
+      });
+    }
+    threads.emplace_back([&]() {
+      std::vector<Handed*> batch;
+      for (;;) {
+        bool finished = producersDone.load() == producerCount;
+        {
+          std::lock_guard<std::mutex> lock(handoffMutex);
+          batch.swap(handoff);
+        }
+        for (Handed* object : batch) {
+          corrupted += object->id < 0 || object->id >= producerCount * objectsPerProducer;
+          pool.Destroy(object);
+        }
+        batch.clear();
+        if (finished) {
+          break;
+        }
+        std::this_thread::yield();
+      }
+    });
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    ENGINE_CHECK(corrupted.load() == 0);
+    ENGINE_CHECK(pool.GetLiveCount() == 0);
+
+    // Every slot came back exactly once: the whole capacity can be handed out again
+    // without a new chunk and without any slot appearing twice.
+    size_t capacity = pool.GetCapacity();
+    std::set<Handed*> distinct;
+    std::vector<Handed*> all;
+    for (size_t i = 0; i < capacity; ++i) {
+      Handed* object = pool.Create(static_cast<int>(i));
+      distinct.insert(object);
+      all.push_back(object);
+    }
+    ENGINE_CHECK(distinct.size() == capacity);
+    ENGINE_CHECK(pool.GetCapacity() == capacity);
+    for (Handed* object : all) {
+      pool.Destroy(object);
+    }
+    std::printf("%d producers, 1 consumer: %zu slots in %zu chunks\n", producerCount, capacity, pool.GetChunkCount());
+  }
+}
+
+int
+main() {
+  testChunkGrowth();
+  testReuseOrder();
+  testMakeSharedPooled();
+  testThreadCaches();
+  return EngineTests::testResult();
+}
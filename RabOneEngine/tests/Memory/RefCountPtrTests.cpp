@@ -0,0 +1,186 @@
+#include <utility>
+#include "Engine Utilities/Memory/TRefCountPtr.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  int g_addRefCalls = 0;
+  int g_releaseCalls = 0;
+  int g_liveObjects = 0;
+
+  /**
+   * @brief Stand-in for a D3D COM interface: AddRef/Release return the new count and
+   * Release destroys the object at zero, like IUnknown.
+   */
+  class MockResource {
+  public:
+    MockResource() { ++g_liveObjects; }
+
+    unsigned long AddRef() {
+      ++g_addRefCalls;
+      return ++m_refCount;
+    }
+
+    unsigned long Release() {
+      ++g_releaseCalls;
+      unsigned long count = --m_refCount;
+      if (count == 0) {
+        delete this;
+      }
+      return count;
+    }
+
+    int value = 0;
+
+  protected:
+    virtual ~MockResource() { --g_liveObjects; }
+
+  private:
+    unsigned long m_refCount = 1;  ///< COM objects are born with one reference owned by the creator.
+  };
+
+  class MockTexture : public MockResource {};
+
+  /** Mirrors ID3D11Device::Create*: writes a new object that already holds one reference. */
+  long
+  createMock(MockResource** out) {
+    *out = new MockResource();
+    return 0;
+  }
+
+  /** Mirrors PSSetShaderResources and friends: reads an array of interface pointers. */
+  int
+  sumValues(MockResource* const* resources, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+      sum += resources[i]->value;
+    }
+    return sum;
+  }
+
+  void
+  resetCounters() {
+    g_addRefCalls = 0;
+    g_releaseCalls = 0;
+  }
+
+  void
+  testInitReferenceAdoptsTheCreatedReference() {
+    resetCounters();
+    {
+      TRefCountPtr<MockResource> resource;
+      ENGINE_CHECK(createMock(resource.getInitReference()) == 0);
+      ENGINE_CHECK(!resource.isNull());
+      ENGINE_CHECK(g_addRefCalls == 0);
+      ENGINE_CHECK(resource.getRefCount() == 1);
+
+      // Re-initializing releases the previous object first.
+      ENGINE_CHECK(createMock(resource.getInitReference()) == 0);
+      ENGINE_CHECK(g_liveObjects == 1);
+    }
+    ENGINE_CHECK(g_liveObjects == 0);
+  }
+
+  void
+  testCopyAndMoveBalanceAddRefRelease() {
+    resetCounters();
+    {
+      TRefCountPtr<MockResource> first;
+      createMock(first.getInitReference());
+      {
+        TRefCountPtr<MockResource> copy(first);
+        ENGINE_CHECK(copy.get() == first.get());
+        ENGINE_CHECK(first.getRefCount() == 2);
+
+        TRefCountPtr<MockResource> assigned;
+        assigned = copy;
+        ENGINE_CHECK(first.getRefCount() == 3);
+
+        assigned = assigned;  // Self-assignment keeps the reference.
+        ENGINE_CHECK(first.getRefCount() == 3);
+
+        TRefCountPtr<MockResource> moved(std::move(copy));
+        ENGINE_CHECK(copy.isNull());
+        ENGINE_CHECK(first.getRefCount() == 3);
+
+        TRefCountPtr<MockResource> moveAssigned;
+        moveAssigned = std::move(moved);
+        ENGINE_CHECK(moved.isNull());
+        ENGINE_CHECK(first.getRefCount() == 3);
+      }
+      ENGINE_CHECK(first.getRefCount() == 1);
+      ENGINE_CHECK(g_liveObjects == 1);
+    }
+    ENGINE_CHECK(g_liveObjects == 0);
+    ENGINE_CHECK(g_addRefCalls == g_releaseCalls - 1);  // The creator's reference is released too.
+  }
+
+  void
+  testAddressOfDoesNotRelease() {
+    TRefCountPtr<MockResource> resources[2];
+    createMock(resources[0].getInitReference());
+    createMock(resources[1].getInitReference());
+    resources[0]->value = 3;
+    resources[1]->value = 4;
+    resetCounters();
+    ENGINE_CHECK(sumValues(resources[0].getAddressOf(), 1) == 3);
+    ENGINE_CHECK(g_addRefCalls == 0 && g_releaseCalls == 0);
+    ENGINE_CHECK(resources[0].getRefCount() == 1);
+  }
+
+  void
+  testResetAttachDetachAndConversion() {
+    TRefCountPtr<MockResource> resource;
+    createMock(resource.getInitReference());
+    MockResource* raw = resource.detach();
+    ENGINE_CHECK(resource.isNull() && g_liveObjects == 1);
+
+    TRefCountPtr<MockResource> adopted;
+    adopted.attach(raw);  // Takes over the detached reference without AddRef.
+    ENGINE_CHECK(adopted.getRefCount() == 1);
+
+    TRefCountPtr<MockResource> shared(raw);  // Raw constructor adds a reference.
+    ENGINE_CHECK(adopted.getRefCount() == 2);
+    shared.reset();
+    ENGINE_CHECK(adopted.getRefCount() == 1);
+    adopted = nullptr;
+    ENGINE_CHECK(g_liveObjects == 0);
+
+    TRefCountPtr<MockTexture> texture(new MockTexture(), false);
+    TRefCountPtr<MockResource> base(texture);
+    ENGINE_CHECK(base.get() == texture.get() && texture.getRefCount() == 2);
+    MockResource* implicitRaw = base;  // Passes straight to D3D calls taking T*.
+    ENGINE_CHECK(implicitRaw == base.get());
+    base.swap(resource);
+    ENGINE_CHECK(base.isNull() && resource.get() == texture.get());
+  }
+
+  struct EngineResource : TRefCountedObject {
+    explicit EngineResource(bool& destroyed) : m_destroyed(destroyed) {}
+    ~EngineResource() override { m_destroyed = true; }
+    bool& m_destroyed;
+  };
+
+  void
+  testRefCountedObject() {
+    bool destroyed = false;
+    {
+      TRefCountPtr<EngineResource> resource(new EngineResource(destroyed));
+      TRefCountPtr<EngineResource> copy = resource;
+      ENGINE_CHECK(resource.getRefCount() == 2);
+    }
+    ENGINE_CHECK(destroyed);
+  }
+}
+
+int
+main() {
+  testInitReferenceAdoptsTheCreatedReference();
+  testCopyAndMoveBalanceAddRefRelease();
+  testAddressOfDoesNotRelease();
+  testResetAttachDetachAndConversion();
+  testRefCountedObject();
+  ENGINE_CHECK(g_liveObjects == 0);
+  return EngineTests::testResult();
+}
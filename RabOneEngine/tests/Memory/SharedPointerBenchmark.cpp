@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Memory/TSharedPointer.h"
+#include "Engine Utilities/Memory/TWeakPointer.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  struct Payload {
+    int value = 1;
+  };
+
+  /**
+   * @brief Copies and destroys a pointer to one shared object from threadCount threads
+   * at once; every copy touches the same reference count.
+   * @return Nanoseconds per copy/destroy pair, per thread.
+   */
+  template <typename Pointer>
+  double
+  measureContention(const Pointer& shared, int threadCount, int copiesPerThread) {
+    double ms = EngineTests::bestOfMs(3, [&]() {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&shared, copiesPerThread]() {
+          for (int i = 0; i < copiesPerThread; ++i) {
+            Pointer copy(shared);
+            EngineTests::doNotOptimize(copy);
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    });
+    return ms * 1e6 / copiesPerThread;
+  }
+
+  /**
+   * @brief Upgrades a weak pointer from threadCount threads at once.
+   * @return Nanoseconds per lock/destroy pair, per thread.
+   */
+  template <typename Weak>
+  double
+  measureLock(const Weak& weak, int threadCount, int locksPerThread) {
+    double ms = EngineTests::bestOfMs(3, [&]() {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&weak, locksPerThread]() {
+          for (int i = 0; i < locksPerThread; ++i) {
+            auto locked = weak.lock();
+            EngineTests::doNotOptimize(locked);
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    });
+    return ms * 1e6 / locksPerThread;
+  }
+}
+
+int
+main() {
+  const int copies = 5000000;
+  TSharedPointer<Payload> atomicShared = MakeShared<Payload>();
+  TSharedPointer<Payload, RefCountMode::SingleThreaded> plainShared =
+    MakeShared<Payload, RefCountMode::SingleThreaded>();
+  std::shared_ptr<Payload> stdShared = std::make_shared<Payload>();
+  TWeakPointer<Payload> atomicWeak(atomicShared);
+  std::weak_ptr<Payload> stdWeak(stdShared);
+
+  std::printf("hardware threads: %u (ns per copy+destroy, per thread)\n", std::thread::hardware_concurrency());
+  std::printf("%-34s %8s %8s %8s\n", "", "1 thr", "2 thr", "4 thr");
+  std::printf("%-34s %8.2f %8s %8s\n", "TSharedPointer SingleThreaded", measureContention(plainShared, 1, copies), "-", "-");
+  std::printf("%-34s %8.2f %8.2f %8.2f\n", "TSharedPointer ThreadSafe",
+              measureContention(atomicShared, 1, copies), measureContention(atomicShared, 2, copies / 2),
+              measureContention(atomicShared, 4, copies / 4));
+  std::printf("%-34s %8.2f %8.2f %8.2f\n", "std::shared_ptr",
+              measureContention(stdShared, 1, copies), measureContention(stdShared, 2, copies / 2),
+              measureContention(stdShared, 4, copies / 4));
+  std::printf("%-34s %8.2f %8.2f %8.2f\n", "TWeakPointer::lock",
+              measureLock(atomicWeak, 1, copies), measureLock(atomicWeak, 2, copies / 2),
+              measureLock(atomicWeak, 4, copies / 4));
+  std::printf("%-34s %8.2f %8.2f %8.2f\n", "std::weak_ptr::lock",
+              measureLock(stdWeak, 1, copies), measureLock(stdWeak, 2, copies / 2),
+              measureLock(stdWeak, 4, copies / 4));
+  return 0;
+}
@@ -0,0 +1,220 @@
+// TSharedPointer and TWeakPointer: casts share one control block, a weak pointer
+// keeps a MakeShared block (object inline) alive after the object is destroyed,
+// and weak pointers are upgraded from several threads while the owner drops the
+// last strong reference (also built with ThreadSanitizer and AddressSanitizer).
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Memory/TSharedPointer.h"
+#include "Engine Utilities/Memory/TWeakPointer.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  int g_destroyed = 0;
+
+  struct Base {
+    virtual ~Base() { ++g_destroyed; }
+    int base = 1;
+  };
+
+  struct Derived : Base {
+    int derived = 2;
+  };
+
+  struct Unrelated : Base {};
+
+  /** No virtual destructor: only a block that remembers the original type destroys it fully. */
+  struct PlainBase {
+    int base = 1;
+  };
+
+  struct PlainDerived : PlainBase {
+    ~PlainDerived() { ++g_destroyed; }
+  };
+
+  /** Heap policy that counts the blocks AllocateShared reserves and frees. */
+  struct CountingAllocator {
+    CountingAllocator(int* InLive) : Live(InLive) {}
+
+    void* Allocate(size_t Bytes, size_t Alignment) {
+      ++*Live;
+      return HeapAllocate(Bytes, Alignment);
+    }
+
+    void Deallocate(void* Ptr, size_t /*Bytes*/, size_t Alignment) {
+      --*Live;
+      HeapDeallocate(Ptr, Alignment);
+    }
+
+    int* Live;
+  };
+
+  void
+  testCastsShareTheBlock() {
+    g_destroyed = 0;
+    TWeakPointer<Base> weak;
+    {
+      TSharedPointer<Derived> derived = MakeShared<Derived>();
+      TSharedPointer<Base> base = derived;
+      ENGINE_CHECK(base.get() == derived.get() && base.useCount() == 2);
+
+      TSharedPointer<Derived> dynamicCast = base.dynamic_pointer_cast<Derived>();
+      ENGINE_CHECK(dynamicCast.get() == derived.get() && dynamicCast->derived == 2);
+      ENGINE_CHECK(derived.useCount() == 3);
+
+      // A failed dynamic cast is null and takes no reference.
+      TSharedPointer<Unrelated> failed = base.dynamic_pointer_cast<Unrelated>();
+      ENGINE_CHECK(failed.isNull() && failed.useCount() == 0 && derived.useCount() == 3);
+
+      TSharedPointer<Derived> staticCast = base.static_pointer_cast<Derived>();
+      ENGINE_CHECK(staticCast == derived && derived.useCount() == 4);
+
+      // Dropping the original pointer leaves the object to the casts.
+      weak = base;
+      derived.reset();
+      base.reset();
+      dynamicCast.reset();
+      ENGINE_CHECK(g_destroyed == 0 && !weak.expired() && staticCast.useCount() == 1);
+      ENGINE_CHECK(weak.lock().get() == staticCast.get());
+    }
+    ENGINE_CHECK(g_destroyed == 1 && weak.expired() && weak.lock().isNull());
+
+    // A raw pointer adopted through its base still deletes the derived type.
+    g_destroyed = 0;
+    {
+      TSharedPointer<PlainBase> plain(new PlainDerived());
+      TSharedPointer<PlainDerived> back = plain.static_pointer_cast<PlainDerived>();
+      ENGINE_CHECK(plain.useCount() == 2);
+    }
+    ENGINE_CHECK(g_destroyed == 1);
+  }
+
+  void
+  testWeakOutlivesInlineBlock() {
+    g_destroyed = 0;
+    int liveBlocks = 0;
+    CountingAllocator alloc(&liveBlocks);
+    TWeakPointer<Base> weak;
+    TWeakPointer<Base> copy;
+    {
+      TSharedPointer<Derived> shared = AllocateShared<Derived>(alloc);
+      ENGINE_CHECK(liveBlocks == 1);
+      weak = shared;
+      copy = weak;
+    }
+    // The object is gone but its block, which also held the object, is not.
+    ENGINE_CHECK(g_destroyed == 1 && liveBlocks == 1);
+    ENGINE_CHECK(weak.expired() && weak.lock().isNull() && copy.lock().isNull());
+    weak.reset();
+    ENGINE_CHECK(liveBlocks == 1);
+    copy.reset();
+    ENGINE_CHECK(liveBlocks == 0);
+
+    // Without weak pointers the block goes with the object.
+    {
+      TSharedPointer<Derived> shared = AllocateShared<Derived>(alloc);
+      TSharedPointer<Derived> second = shared;
+    }
+    ENGINE_CHECK(g_destroyed == 2 && liveBlocks == 0);
+
+    // The same with MakeShared and the single-threaded counters.
+    TWeakPointer<Derived, RefCountMode::SingleThreaded> single;
+    {
+      TSharedPointer<Derived, RefCountMode::SingleThreaded> shared = MakeShared<Derived, RefCountMode::SingleThreaded>();
+      single = shared;
+      ENGINE_CHECK(single.lock()->derived == 2);
+    }
+    ENGINE_CHECK(g_destroyed == 3 && single.expired() && single.lock().isNull());
+  }
+
+  struct Tracked {
+    explicit Tracked(std::atomic<int>* InDestroyed) : destroyed(InDestroyed) {}
+    ~Tracked() {
+      value = 0;
+      destroyed->fetch_add(1, std::memory_order_relaxed);
+    }
+    std::atomic<int>* destroyed;
+    int value = 42;
+  };
+
+  void
+  testLockWhileOwnerReleases() {
+    // Each round, threadCount threads upgrade their own weak pointer up to
+    // locksPerThread times while the main thread drops the only strong reference. A
+    // lock that succeeds must see the live object; once the object is destroyed no
+    // lock may succeed again, and it is destroyed exactly once, by whichever thread
+    // held the last reference.
+    const int threadCount = 4;
+    const int rounds = 2000;
+    const int locksPerThread = 2000;
+    std::atomic<int> destroyed(0);
+    std::atomic<int> badReads(0);
+    std::atomic<int> locksAfterExpiry(0);
+    long long totalLocks = 0;
+    int expiredWhileLocking = 0;
+    for (int round = 0; round < rounds; ++round) {
+      TSharedPointer<Tracked> owner = MakeShared<Tracked>(&destroyed);
+      std::atomic<bool> start(false);
+      std::atomic<long long> locks(0);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < threadCount; ++t) {
+        TWeakPointer<Tracked> weak(owner);
+        threads.emplace_back([weak, locksPerThread, &start, &locks, &badReads, &locksAfterExpiry]() {
+          while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+          }
+          long long count = 0;
+          for (int i = 0; i < locksPerThread; ++i) {
+            {
+              TSharedPointer<Tracked> locked = weak.lock();
+              if (!locked) {
+                break;
+              }
+              TSharedPointer<Tracked> copy = locked;
+              if (copy->value != 42) {
+                ++badReads;
+              }
+              ++count;
+            }
+            if (i % 16 == 0) {
+              std::this_thread::yield();  // Hold no reference for a while, so the count can reach zero.
+            }
+          }
+          locks += count;
+          if (count == locksPerThread) {
+            return;  // Still alive: the owner or another thread holds a reference.
+          }
+          if (!weak.lock().isNull() || !weak.expired()) {
+            ++locksAfterExpiry;
+          }
+        });
+      }
+      start.store(true, std::memory_order_release);
+      for (int spin = 0; spin < round % 50; ++spin) {
+        std::this_thread::yield();
+      }
+      owner.reset();
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      totalLocks += locks.load();
+      expiredWhileLocking += locks.load() < threadCount * locksPerThread;
+    }
+    ENGINE_CHECK(destroyed.load() == rounds);
+    ENGINE_CHECK(badReads.load() == 0);
+    ENGINE_CHECK(locksAfterExpiry.load() == 0);
+    std::printf("%d rounds, %d threads: %lld successful locks, %d rounds expired while locking\n", rounds,
+                threadCount, totalLocks, expiredWhileLocking);
+  }
+}
+
+int
+main() {
+  testCastsShareTheBlock();
+  testWeakOutlivesInlineBlock();
+  testLockWhileOwnerReleases();
+  return EngineTests::testResult();
+}
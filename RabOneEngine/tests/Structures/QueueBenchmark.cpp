@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Structures/TMPMCQueue.h"
+#include "Engine Utilities/Structures/TSPSCQueue.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  /** Baseline: a std::deque behind a mutex, with the same TryPush/TryPop interface. */
+  class MutexQueue {
+  public:
+    explicit MutexQueue(size_t capacity) : m_capacity(capacity) {}
+
+    bool TryPush(int value) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_items.size() == m_capacity) {
+        return false;
+      }
+      m_items.push_back(value);
+      return true;
+    }
+
+    bool TryPop(int& value) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_items.empty()) {
+        return false;
+      }
+      value = m_items.front();
+      m_items.pop_front();
+      return true;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::deque<int> m_items;
+    size_t m_capacity;
+  };
+
+  /**
+   * @brief Moves itemsPerProducer items from each producer to the consumers and
+   * returns the throughput in million items per second.
+   */
+  template <typename Queue>
+  double
+  measure(int producers, int consumers, int itemsPerProducer) {
+    double ms = EngineTests::bestOfMs(3, [&]() {
+      Queue queue(1024);
+      std::atomic<int> remaining(producers * itemsPerProducer);
+      std::vector<std::thread> threads;
+      for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&]() {
+          for (int i = 0; i < itemsPerProducer; ++i) {
+            while (!queue.TryPush(i)) {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+      for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+          int value;
+          while (remaining.load(std::memory_order_relaxed) > 0) {
+            if (queue.TryPop(value)) {
+              remaining.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+    });
+    return producers * itemsPerProducer / (ms * 1000.0);
+  }
+}
+
+int
+main() {
+  const int items = 2000000;
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("1 producer / 1 consumer  TSPSCQueue  %7.1f M items/s\n", measure<TSPSCQueue<int>>(1, 1, items));
+  std::printf("1 producer / 1 consumer  TMPMCQueue  %7.1f M items/s\n", measure<TMPMCQueue<int>>(1, 1, items));
+  std::printf("1 producer / 1 consumer  mutex+deque %7.1f M items/s\n", measure<MutexQueue>(1, 1, items));
+  std::printf("4 producers / 4 consumers TMPMCQueue  %7.1f M items/s\n", measure<TMPMCQueue<int>>(4, 4, items / 4));
+  std::printf("4 producers / 4 consumers mutex+deque %7.1f M items/s\n", measure<MutexQueue>(4, 4, items / 4));
+  return 0;
+}
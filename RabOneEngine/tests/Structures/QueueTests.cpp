@@ -0,0 +1,200 @@
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Engine Utilities/Structures/TMPMCQueue.h"
+#include "Engine Utilities/Structures/TSPSCQueue.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  std::atomic<int> liveCount(0);
+
+  /** Counts live instances so leaks and double destruction show up. */
+  struct Counted {
+    int value = 0;
+    Counted() { ++liveCount; }
+    explicit Counted(int v) : value(v) { ++liveCount; }
+    Counted(const Counted& other) noexcept : value(other.value) { ++liveCount; }
+    Counted(Counted&& other) noexcept : value(other.value) { ++liveCount; }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+    ~Counted() { --liveCount; }
+  };
+
+  /** Constructing from a negative int throws. */
+  struct Throwing {
+    int value = 0;
+    Throwing() = default;
+    explicit Throwing(int v) : value(v) {
+      if (v < 0) {
+        throw std::runtime_error("negative");
+      }
+    }
+    Throwing(Throwing&&) noexcept = default;
+    Throwing& operator=(Throwing&&) noexcept = default;
+  };
+
+  void
+  testSpscSingleThread() {
+    TSPSCQueue<Counted> queue(5);
+    ENGINE_CHECK(queue.GetCapacity() == 8);
+    ENGINE_CHECK(queue.IsEmpty());
+    for (int i = 0; i < 8; ++i) {
+      ENGINE_CHECK(queue.TryEmplace(i));
+    }
+    ENGINE_CHECK(!queue.TryEmplace(8));
+    ENGINE_CHECK(queue.Num() == 8);
+    Counted out;
+    for (int i = 0; i < 5; ++i) {
+      ENGINE_CHECK(queue.TryPop(out) && out.value == i);
+    }
+    // Wrap around the ring.
+    for (int i = 8; i < 13; ++i) {
+      ENGINE_CHECK(queue.TryPush(Counted(i)));
+    }
+    for (int i = 5; i < 13; ++i) {
+      ENGINE_CHECK(queue.TryPop(out) && out.value == i);
+    }
+    ENGINE_CHECK(!queue.TryPop(out));
+  }
+
+  void
+  testMpmcSingleThread() {
+    {
+      TMPMCQueue<Counted> queue(3);
+      ENGINE_CHECK(queue.GetCapacity() == 4);
+      for (int i = 0; i < 4; ++i) {
+        ENGINE_CHECK(queue.TryEmplace(i));
+      }
+      ENGINE_CHECK(!queue.TryEmplace(4));
+      Counted out;
+      ENGINE_CHECK(queue.TryPop(out) && out.value == 0);
+      ENGINE_CHECK(queue.TryEmplace(4));
+      for (int i = 1; i < 5; ++i) {
+        ENGINE_CHECK(queue.TryPop(out) && out.value == i);
+      }
+      ENGINE_CHECK(!queue.TryPop(out));
+      ENGINE_CHECK(queue.TryEmplace(7) && queue.TryEmplace(8));  // Left for the destructor.
+    }
+    ENGINE_CHECK(liveCount.load() == 0);
+  }
+
+  void
+  testMpmcThrowingConstructor() {
+    TMPMCQueue<Throwing> queue(4);
+    ENGINE_CHECK(queue.TryEmplace(1));
+    bool threw = false;
+    try {
+      queue.TryEmplace(-1);
+    }
+    catch (const std::runtime_error&) {
+      threw = true;
+    }
+    ENGINE_CHECK(threw);
+    // The failed emplace must not have claimed a cell.
+    ENGINE_CHECK(queue.Num() == 1);
+    ENGINE_CHECK(queue.TryEmplace(2));
+    Throwing out;
+    ENGINE_CHECK(queue.TryPop(out) && out.value == 1);
+    ENGINE_CHECK(queue.TryPop(out) && out.value == 2);
+    ENGINE_CHECK(!queue.TryPop(out));
+  }
+
+  void
+  testSpscStress() {
+    const int itemCount = 200000;
+    TSPSCQueue<std::string> queue(64);
+    std::thread producer([&queue, itemCount]() {
+      for (int i = 0; i < itemCount; ++i) {
+        std::string item = std::to_string(i);
+        while (!queue.TryPush(std::move(item))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    bool inOrder = true;
+    std::string item;
+    for (int expected = 0; expected < itemCount;) {
+      if (queue.TryPop(item)) {
+        inOrder = inOrder && item == std::to_string(expected);
+        ++expected;
+      }
+      else {
+        std::this_thread::yield();
+      }
+    }
+    producer.join();
+    ENGINE_CHECK(inOrder);
+    ENGINE_CHECK(queue.IsEmpty());
+  }
+
+  void
+  testMpmcStress() {
+    const int producerCount = 4;
+    const int consumerCount = 4;
+    const int itemsPerProducer = 50000;
+    const int total = producerCount * itemsPerProducer;
+    TMPMCQueue<Counted> queue(128);
+    std::vector<std::atomic<int>> seen(total);
+    for (std::atomic<int>& flag : seen) {
+      flag.store(0);
+    }
+    std::atomic<int> consumed(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producerCount; ++p) {
+      threads.emplace_back([&queue, p, itemsPerProducer]() {
+        for (int i = 0; i < itemsPerProducer; ++i) {
+          while (!queue.TryEmplace(p * itemsPerProducer + i)) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    for (int c = 0; c < consumerCount; ++c) {
+      threads.emplace_back([&]() {
+        Counted item;
+        // Items of one producer must come out in the order that producer pushed them.
+        std::vector<int> lastPerProducer(producerCount, -1);
+        bool ordered = true;
+        while (consumed.load() < total) {
+          if (queue.TryPop(item)) {
+            seen[item.value].fetch_add(1);
+            int producer = item.value / itemsPerProducer;
+            ordered = ordered && item.value > lastPerProducer[producer];
+            lastPerProducer[producer] = item.value;
+            consumed.fetch_add(1);
+          }
+          else {
+            std::this_thread::yield();
+          }
+        }
+        ENGINE_CHECK(ordered);
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    bool exactlyOnce = true;
+    for (std::atomic<int>& flag : seen) {
+      exactlyOnce = exactlyOnce && flag.load() == 1;
+    }
+    ENGINE_CHECK(exactlyOnce);
+    ENGINE_CHECK(queue.IsEmpty());
+  }
+}
+
+int
+main() {
+  testSpscSingleThread();
+  testMpmcSingleThread();
+  testMpmcThrowingConstructor();
+  testSpscStress();
+  testMpmcStress();
+  ENGINE_CHECK(liveCount.load() == 0);
+  return EngineTests::testResult();
+}
@@ -0,0 +1,130 @@
+// Insert N random int keys, then look each one up (plus N misses), with TMap,
+// std::unordered_map and the linear-scan TMap the engine had before (reproduced
+// below). The linear map is quadratic, so it only runs up to 100k keys.
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "Engine Utilities/Structures/TMap.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  /** The previous TMap: pairs in a growing array, every operation a linear scan. */
+  class LinearMap {
+  public:
+    ~LinearMap() { delete[] m_data; }
+
+    void Add(int key, int value) {
+      for (size_t i = 0; i < m_size; ++i) {
+        if (m_data[i].key == key) {
+          m_data[i].value = value;
+          return;
+        }
+      }
+      if (m_size == m_capacity) {
+        size_t capacity = m_capacity == 0 ? 1 : m_capacity * 2;
+        Pair* data = new Pair[capacity];
+        for (size_t i = 0; i < m_size; ++i) {
+          data[i] = m_data[i];
+        }
+        delete[] m_data;
+        m_data = data;
+        m_capacity = capacity;
+      }
+      m_data[m_size++] = Pair{ key, value };
+    }
+
+    const int* Find(int key) const {
+      for (size_t i = 0; i < m_size; ++i) {
+        if (m_data[i].key == key) {
+          return &m_data[i].value;
+        }
+      }
+      return nullptr;
+    }
+
+  private:
+    struct Pair {
+      int key;
+      int value;
+    };
+    Pair* m_data = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+  };
+
+  template <typename Insert, typename Lookup>
+  void
+  report(const char* name, size_t count, int repeats, Insert insert, Lookup lookup) {
+    double insertMs = EngineTests::bestOfMs(repeats, insert);
+    double lookupMs = EngineTests::bestOfMs(repeats, lookup);
+    std::printf("  %-20s insert %9.2f ms  lookup %9.2f ms  (%.1f ns per lookup)\n", name, insertMs, lookupMs,
+                lookupMs * 1e6 / (2.0 * static_cast<double>(count)));
+  }
+}
+
+int
+main() {
+  const size_t counts[] = { 1000, 100000, 1000000 };
+  for (size_t count : counts) {
+    // Random even keys; the misses are odd, so they were never inserted.
+    std::mt19937 rng(static_cast<unsigned>(count));
+    std::vector<int> keys(count);
+    std::vector<int> misses(count);
+    for (size_t i = 0; i < count; ++i) {
+      keys[i] = static_cast<int>(rng() & 0x7FFFFFFE);
+      misses[i] = keys[i] | 1;
+    }
+    int repeats = count <= 1000 ? 100 : (count <= 100000 ? 5 : 3);
+    std::printf("%zu keys\n", count);
+
+    TMap<int, int> map;
+    report("TMap", count, repeats,
+      [&]() {
+        map = TMap<int, int>();
+        for (size_t i = 0; i < count; ++i) map.Add(keys[i], static_cast<int>(i));
+      },
+      [&]() {
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) found += map.Find(keys[i]) != nullptr;
+        for (size_t i = 0; i < count; ++i) found += map.Find(misses[i]) != nullptr;
+        EngineTests::doNotOptimize(found);
+      });
+
+    std::unordered_map<int, int> standard;
+    report("std::unordered_map", count, repeats,
+      [&]() {
+        standard = std::unordered_map<int, int>();
+        for (size_t i = 0; i < count; ++i) standard[keys[i]] = static_cast<int>(i);
+      },
+      [&]() {
+        size_t found = 0;
+        for (size_t i = 0; i < count; ++i) found += standard.find(keys[i]) != standard.end();
+        for (size_t i = 0; i < count; ++i) found += standard.find(misses[i]) != standard.end();
+        EngineTests::doNotOptimize(found);
+      });
+
+    if (count <= 100000) {
+      LinearMap* linear = nullptr;
+      report("previous TMap", count, 1,
+        [&]() {
+          delete linear;
+          linear = new LinearMap();
+          for (size_t i = 0; i < count; ++i) linear->Add(keys[i], static_cast<int>(i));
+        },
+        [&]() {
+          size_t found = 0;
+          for (size_t i = 0; i < count; ++i) found += linear->Find(keys[i]) != nullptr;
+          for (size_t i = 0; i < count; ++i) found += linear->Find(misses[i]) != nullptr;
+          EngineTests::doNotOptimize(found);
+        });
+      delete linear;
+    }
+    else {
+      std::printf("  %-20s not run (quadratic)\n", "previous TMap");
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,194 @@
+// TMap against std::unordered_map: hits and misses, backward-shift Remove on long
+// probe chains, iteration, copies, and Add/Emplace with a value that lives in the
+// same map (also built with AddressSanitizer).
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Engine Utilities/Structures/TMap.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  /** Sends every key to one of four home slots, so probe chains get long. */
+  struct ClusteringHash {
+    size_t operator()(int key) const { return static_cast<size_t>(key) & 3u; }
+  };
+
+  template <typename Map>
+  bool
+  sameContents(const Map& map, const std::unordered_map<int, int>& reference) {
+    if (map.Num() != reference.size()) {
+      return false;
+    }
+    for (const auto& entry : reference) {
+      const int* value = map.Find(entry.first);
+      if (!value || *value != entry.second) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void
+  testMisses() {
+    TMap<int, int> map;
+    ENGINE_CHECK(map.Find(1) == nullptr);
+    ENGINE_CHECK(!map.Contains(1));
+    ENGINE_CHECK(!map.Remove(1));
+    int out = 7;
+    ENGINE_CHECK(!map.TryGet(1, out) && out == 7);
+
+    for (int i = 0; i < 100; i += 2) {
+      map.Add(i, i * 10);
+    }
+    bool missesMiss = true;
+    for (int i = 1; i < 100; i += 2) {
+      missesMiss = missesMiss && map.Find(i) == nullptr && !map.Contains(i) && !map.Remove(i);
+    }
+    ENGINE_CHECK(missesMiss);
+    ENGINE_CHECK(map.Num() == 50);
+    ENGINE_CHECK(map.TryGet(42, out) && out == 420);
+
+    // Emplace keeps an existing value; Add overwrites it.
+    ENGINE_CHECK(map.Emplace(42, 1) == 420);
+    ENGINE_CHECK(map.Add(42, 1) == 1);
+    ENGINE_CHECK(map.Num() == 50);
+
+    map.Empty();
+    ENGINE_CHECK(map.Num() == 0 && map.Find(42) == nullptr && map.GetCapacity() > 0);
+  }
+
+  template <typename Hasher>
+  void
+  testAgainstReference(int keyRange, int operations) {
+    TMap<int, int, Hasher> map;
+    std::unordered_map<int, int> reference;
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> key(0, keyRange - 1);
+    bool agrees = true;
+    for (int i = 0; i < operations; ++i) {
+      int k = key(rng);
+      if (rng() % 3 == 0) {
+        agrees = agrees && map.Remove(k) == (reference.erase(k) == 1);
+      }
+      else {
+        map.Add(k, i);
+        reference[k] = i;
+      }
+    }
+    ENGINE_CHECK(agrees);
+    ENGINE_CHECK(sameContents(map, reference));
+  }
+
+  void
+  testBackwardShiftRemove() {
+    // With ClusteringHash the keys 0, 4, 8, ... share home slot 0 and wrap around
+    // the table. Removing from the front, middle and end of a chain must shift the
+    // rest back so that every remaining key is still found.
+    TMap<int, int, ClusteringHash> map;
+    std::unordered_map<int, int> reference;
+    for (int i = 0; i < 24; ++i) {
+      map.Add(i, -i);
+      reference[i] = -i;
+    }
+    const int removals[] = { 0, 12, 20, 5, 23, 1, 4, 8 };
+    for (int k : removals) {
+      ENGINE_CHECK(map.Remove(k));
+      reference.erase(k);
+      ENGINE_CHECK(sameContents(map, reference));
+    }
+    ENGINE_CHECK(!map.Remove(12));
+
+    testAgainstReference<ClusteringHash>(200, 20000);
+    testAgainstReference<THash<int>>(5000, 200000);
+  }
+
+  void
+  testIteration() {
+    TMap<int, int> map;
+    for (int i = 0; i < 1000; ++i) {
+      map.Add(i, i * 2);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+      map.Remove(i);
+    }
+    std::vector<int> seen(1000, 0);
+    for (auto& pair : map) {
+      ++seen[pair.Key];
+      pair.Value += 1;
+    }
+    bool once = true;
+    for (int i = 0; i < 1000; ++i) {
+      once = once && seen[i] == (i % 3 == 0 ? 0 : 1);
+    }
+    ENGINE_CHECK(once);
+
+    const TMap<int, int>& constMap = map;
+    size_t count = 0;
+    bool updated = true;
+    for (const auto& pair : constMap) {
+      ++count;
+      updated = updated && pair.Value == pair.Key * 2 + 1;
+    }
+    ENGINE_CHECK(count == map.Num());
+    ENGINE_CHECK(updated);
+
+    TMap<int, int> empty;
+    ENGINE_CHECK(!(empty.begin() != empty.end()));
+  }
+
+  void
+  testCopyAndMove() {
+    TMap<int, std::string> map;
+    for (int i = 0; i < 100; ++i) {
+      map.Add(i, std::to_string(i));
+    }
+    TMap<int, std::string> copy(map);
+    map.Add(0, "changed");
+    ENGINE_CHECK(copy.Num() == 100 && *copy.Find(0) == "0" && *copy.Find(99) == "99");
+
+    TMap<int, std::string> moved(std::move(copy));
+    ENGINE_CHECK(moved.Num() == 100 && copy.Num() == 0 && copy.Find(0) == nullptr);
+    copy = moved;
+    ENGINE_CHECK(copy.Num() == 100 && *copy.Find(50) == "50");
+  }
+
+  void
+  testAliasedValues() {
+    // The value argument refers to an element of the map itself. Every Add and
+    // Emplace below that grows the table must copy it before the old slots are freed.
+    TMap<int, std::string> map;
+    map.Add(0, std::string(64, 'x'));
+    for (int i = 1; i < 200; ++i) {
+      map.Add(i, *map.Find(0));
+    }
+    for (int i = 200; i < 400; ++i) {
+      map.Emplace(i, *map.Find(i - 1));
+    }
+    TMap<std::string, std::string> names;
+    names.Add("first", "first");
+    for (int i = 0; i < 100; ++i) {
+      // A key that is a value of the same map.
+      names.Add(std::to_string(i), *names.Find("first"));
+      names.Emplace(*names.Find(std::to_string(i)) + std::to_string(i), "x");
+    }
+    bool intact = true;
+    for (int i = 0; i < 400; ++i) {
+      intact = intact && *map.Find(i) == std::string(64, 'x');
+    }
+    ENGINE_CHECK(intact);
+    ENGINE_CHECK(names.Num() == 201 && names.Contains("first99"));
+  }
+}
+
+int
+main() {
+  testMisses();
+  testBackwardShiftRemove();
+  testIteration();
+  testCopyAndMove();
+  testAliasedValues();
+  return EngineTests::testResult();
+}
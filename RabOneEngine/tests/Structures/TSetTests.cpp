@@ -0,0 +1,310 @@
+// TSet against std::unordered_set: probing when many elements share a group or a
+// control-byte tag, Remove leaving empty or deleted slots, rehashes after many
+// deletes, and Append/Union/Intersect. Built with the SSE2 group match,
+// with ENGINE_NO_SIMD (scalar match) and with AddressSanitizer.
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Engine Utilities/Structures/TSet.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const int kHashBits = static_cast<int>(sizeof(size_t) * 8);
+
+  /** Every key starts probing at group 0, with its own control-byte tag. */
+  struct SharedGroupHash {
+    size_t operator()(int key) const {
+      return (static_cast<size_t>(key) << (kHashBits - 16)) | (static_cast<size_t>(key) & 0x7F);
+    }
+  };
+
+  /** Every key starts probing at group 0 with the same tag, so each group match has many candidates. */
+  struct SharedTagHash {
+    size_t operator()(int key) const {
+      return (static_cast<size_t>(key) << (kHashBits - 16)) | 5u;
+    }
+  };
+
+  /** Keys collide on the full hash too; only operator== tells them apart. */
+  struct CollidingHash {
+    size_t operator()(int key) const { return static_cast<size_t>(key % 5); }
+  };
+
+  /** Heap policy that counts block allocations, so a rehash can be observed. */
+  struct CountingAllocator {
+    explicit CountingAllocator(int* InAllocations = nullptr) : Allocations(InAllocations) {}
+
+    void* Allocate(size_t Bytes, size_t Alignment) {
+      if (Allocations) {
+        ++*Allocations;
+      }
+      return HeapAllocate(Bytes, Alignment);
+    }
+
+    void Deallocate(void* Ptr, size_t /*Bytes*/, size_t Alignment) { HeapDeallocate(Ptr, Alignment); }
+
+    int* Allocations;
+  };
+
+  template <typename Set>
+  bool
+  sameContents(const Set& set, const std::unordered_set<int>& reference) {
+    if (set.Num() != reference.size()) {
+      return false;
+    }
+    for (int key : reference) {
+      if (!set.Contains(key)) {
+        return false;
+      }
+    }
+    size_t iterated = 0;
+    for (int key : set) {
+      if (reference.count(key) == 0) {
+        return false;
+      }
+      ++iterated;
+    }
+    return iterated == reference.size();
+  }
+
+  template <typename Hasher>
+  void
+  testProbing(const char* name) {
+    TSet<int, Hasher> set;
+    std::unordered_set<int> reference;
+    for (int i = 0; i < 300; ++i) {
+      ENGINE_CHECK(set.Add(i * 3));
+      reference.insert(i * 3);
+    }
+    bool duplicatesRejected = true;
+    bool missesMiss = true;
+    for (int i = 0; i < 300; ++i) {
+      duplicatesRejected = duplicatesRejected && !set.Add(i * 3);
+      missesMiss = missesMiss && !set.Contains(i * 3 + 1) && !set.Remove(i * 3 + 2);
+    }
+    ENGINE_CHECK(duplicatesRejected);
+    ENGINE_CHECK(missesMiss);
+    ENGINE_CHECK(sameContents(set, reference));
+
+    for (int i = 0; i < 300; i += 2) {
+      ENGINE_CHECK(set.Remove(i * 3));
+      reference.erase(i * 3);
+    }
+    ENGINE_CHECK(sameContents(set, reference));
+    for (int i = 0; i < 300; i += 4) {
+      ENGINE_CHECK(set.Add(i * 3));
+      reference.insert(i * 3);
+    }
+    ENGINE_CHECK(sameContents(set, reference));
+    std::printf("%s: %zu elements in %zu slots\n", name, set.Num(), set.GetCapacity());
+  }
+
+  void
+  testRemoveFromFullGroup() {
+    // 40 keys homed at group 0 of a 64-slot table fill groups 0, 1 and 3 and spill
+    // into group 2. A key removed from a full group must leave a deleted slot: if it
+    // left an empty one, lookups for the keys further along would stop there.
+    TSet<int, SharedGroupHash> set;
+    set.Reserve(40);
+    ENGINE_CHECK(set.GetCapacity() == 64);
+    std::unordered_set<int> reference;
+    for (int i = 0; i < 40; ++i) {
+      set.Add(i);
+      reference.insert(i);
+    }
+    const int removals[] = { 0, 7, 15, 16, 30, 39 };
+    for (int key : removals) {
+      ENGINE_CHECK(set.Remove(key));
+      reference.erase(key);
+      ENGINE_CHECK(sameContents(set, reference));
+    }
+    // Re-adding reuses the freed slots without growing.
+    for (int key : removals) {
+      ENGINE_CHECK(set.Add(key));
+      reference.insert(key);
+    }
+    ENGINE_CHECK(sameContents(set, reference));
+    ENGINE_CHECK(set.GetCapacity() == 64);
+  }
+
+  void
+  testRemoveFromGroupWithEmptySlots() {
+    // A group that still has empty slots is never probed past, so Remove can leave an
+    // empty slot there. Churning a sparse single-group set therefore never rehashes.
+    int allocations = 0;
+    TSet<int, THash<int>, CountingAllocator> set{ CountingAllocator(&allocations) };
+    std::unordered_set<int> reference;
+    for (int i = 0; i < 8; ++i) {
+      set.Add(i);
+      reference.insert(i);
+    }
+    ENGINE_CHECK(set.GetCapacity() == 16 && allocations == 1);
+    for (int i = 8; i < 10008; ++i) {
+      set.Remove(i - 8);
+      reference.erase(i - 8);
+      set.Add(i);
+      reference.insert(i);
+    }
+    ENGINE_CHECK(allocations == 1);
+    ENGINE_CHECK(sameContents(set, reference));
+  }
+
+  void
+  testRehashAfterDeletes() {
+    // Remove/add churn leaves deleted slots behind. A table that is mostly deleted
+    // slots is rebuilt at the same capacity; one that is nearly full of live elements
+    // doubles once instead of rebuilding on almost every Add.
+    int allocations = 0;
+    TSet<int, THash<int>, CountingAllocator> set{ CountingAllocator(&allocations) };
+    std::unordered_set<int> reference;
+    for (int i = 0; i < 56; ++i) {
+      set.Add(i);
+      reference.insert(i);
+    }
+    ENGINE_CHECK(set.GetCapacity() == 64);
+    int churnAllocations = allocations;
+    for (int i = 56; i < 100056; ++i) {
+      ENGINE_CHECK(set.Remove(i - 56));
+      reference.erase(i - 56);
+      set.Add(i);
+      reference.insert(i);
+    }
+    int rehashes = allocations - churnAllocations;
+    ENGINE_CHECK(set.GetCapacity() == 128);
+    ENGINE_CHECK(rehashes < 100000 / 32);
+    ENGINE_CHECK(sameContents(set, reference));
+    std::printf("100000 removes and adds on 56 elements: %d rehashes, %zu slots\n", rehashes, set.GetCapacity());
+
+    // Emptying a large set by Remove keeps its slots; refilling it does not grow.
+    TSet<int> large;
+    for (int i = 0; i < 10000; ++i) {
+      large.Add(i);
+    }
+    size_t capacity = large.GetCapacity();
+    for (int i = 0; i < 10000; ++i) {
+      large.Remove(i);
+    }
+    ENGINE_CHECK(large.Num() == 0 && !large.Contains(0));
+    for (int i = 10000; i < 20000; ++i) {
+      large.Add(i);
+    }
+    ENGINE_CHECK(large.Num() == 10000 && large.GetCapacity() == capacity);
+    ENGINE_CHECK(large.Contains(19999) && !large.Contains(9999));
+  }
+
+  std::unordered_set<int>
+  randomKeys(std::mt19937& rng, size_t count, int range, TSet<int>& set) {
+    std::unordered_set<int> reference;
+    std::uniform_int_distribution<int> key(0, range - 1);
+    for (size_t i = 0; i < count; ++i) {
+      int k = key(rng);
+      set.Add(k);
+      reference.insert(k);
+    }
+    return reference;
+  }
+
+  void
+  testSetAlgebra() {
+    std::mt19937 rng(2);
+    const size_t sizes[] = { 0, 1, 15, 100, 5000 };
+    for (size_t a : sizes) {
+      for (size_t b : sizes) {
+        TSet<int> first;
+        TSet<int> second;
+        std::unordered_set<int> firstReference = randomKeys(rng, a, 8000, first);
+        std::unordered_set<int> secondReference = randomKeys(rng, b, 8000, second);
+
+        std::unordered_set<int> both;
+        std::unordered_set<int> all = firstReference;
+        for (int key : secondReference) {
+          all.insert(key);
+          if (firstReference.count(key)) {
+            both.insert(key);
+          }
+        }
+        ENGINE_CHECK(sameContents(first.Union(second), all));
+        ENGINE_CHECK(sameContents(second.Union(first), all));
+        ENGINE_CHECK(sameContents(first.Intersect(second), both));
+        ENGINE_CHECK(sameContents(second.Intersect(first), both));
+
+        TSet<int> appended(first);
+        appended.Append(second);
+        ENGINE_CHECK(sameContents(appended, all));
+      }
+    }
+
+    // Self operations and the array Append, with duplicates inside the array.
+    TSet<int> set;
+    std::unordered_set<int> reference = randomKeys(rng, 500, 1000, set);
+    ENGINE_CHECK(sameContents(set.Union(set), reference));
+    ENGINE_CHECK(sameContents(set.Intersect(set), reference));
+    set.Append(set);
+    ENGINE_CHECK(sameContents(set, reference));
+    std::vector<int> more;
+    for (int i = 0; i < 2000; ++i) {
+      more.push_back(i % 1500);
+      reference.insert(i % 1500);
+    }
+    set.Append(more.data(), more.size());
+    ENGINE_CHECK(sameContents(set, reference));
+
+    // The stored hashes are reused even when only operator== separates the elements.
+    TSet<int, CollidingHash> odd;
+    TSet<int, CollidingHash> low;
+    for (int i = 0; i < 100; ++i) {
+      odd.Add(2 * i + 1);
+      low.Add(i);
+    }
+    TSet<int, CollidingHash> lowOdd = odd.Intersect(low);
+    TSet<int, CollidingHash> merged = odd.Union(low);
+    bool intersected = lowOdd.Num() == 50;
+    for (int i = 0; i < 100; ++i) {
+      intersected = intersected && lowOdd.Contains(i) == (i % 2 == 1);
+    }
+    ENGINE_CHECK(intersected);
+    ENGINE_CHECK(merged.Num() == 150 && merged.Contains(0) && merged.Contains(199) && !merged.Contains(200));
+  }
+
+  void
+  testOwnership() {
+    // std::string elements check that removal, rehash, copies and Empty destroy
+    // exactly what they construct (the AddressSanitizer build reports any slip).
+    TSet<std::string> set;
+    for (int i = 0; i < 1000; ++i) {
+      set.Add(std::string(40, 'a') + std::to_string(i));
+    }
+    for (int i = 0; i < 1000; i += 2) {
+      ENGINE_CHECK(set.Remove(std::string(40, 'a') + std::to_string(i)));
+    }
+    TSet<std::string> copy(set);
+    TSet<std::string> moved(std::move(set));
+    ENGINE_CHECK(set.Num() == 0 && !set.Contains(std::string(40, 'a') + "1"));
+    ENGINE_CHECK(copy.Num() == 500 && moved.Num() == 500);
+    ENGINE_CHECK(copy.Contains(std::string(40, 'a') + "999") && !copy.Contains(std::string(40, 'a') + "998"));
+    copy.Empty();
+    ENGINE_CHECK(copy.Num() == 0 && copy.GetCapacity() > 0);
+    copy.Add("again");
+    set = copy;
+    ENGINE_CHECK(set.Num() == 1 && set.Contains("again"));
+  }
+}
+
+int
+main() {
+  std::printf("group match: %s\n", ENGINE_SIMD_SSE2 ? "SSE2" : "scalar");
+  testProbing<THash<int>>("THash");
+  testProbing<SharedGroupHash>("one home group");
+  testProbing<SharedTagHash>("one home group, one tag");
+  testProbing<CollidingHash>("colliding hashes");
+  testRemoveFromFullGroup();
+  testRemoveFromGroupWithEmptySlots();
+  testRehashAfterDeletes();
+  testSetAlgebra();
+  testOwnership();
+  return EngineTests::testResult();
+}
@@ -0,0 +1,168 @@
+// TSlotMap: stale handles after Remove (odd live generations, even free ones),
+// slot reuse through the free list, Find on the element that swap-remove moved,
+// and a randomized run against std::unordered_map (also built with AddressSanitizer).
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Engine Utilities/Structures/TSlotMap.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  void
+  testStaleHandles() {
+    TSlotMap<std::string> map;
+    ENGINE_CHECK(!SlotHandle().IsValid());
+    ENGINE_CHECK(!map.Contains(SlotHandle()) && map.Find(SlotHandle()) == nullptr);
+
+    SlotHandle first = map.Insert("first");
+    SlotHandle second = map.Insert("second");
+    ENGINE_CHECK(first.IsValid() && first.Generation % 2 == 1);
+    ENGINE_CHECK(first != second);
+    ENGINE_CHECK(*map.Find(first) == "first" && *map.Find(second) == "second");
+
+    ENGINE_CHECK(map.Remove(first));
+    ENGINE_CHECK(!map.Contains(first) && map.Find(first) == nullptr);
+    ENGINE_CHECK(!map.Remove(first));
+    ENGINE_CHECK(map.Num() == 1 && *map.Find(second) == "second");
+
+    // The freed slot now holds the next, even generation; a handle carrying it must
+    // not resolve, and neither may one past the slot table.
+    ENGINE_CHECK(!map.Contains(SlotHandle{ first.Index, first.Generation + 1 }));
+    ENGINE_CHECK(!map.Contains(SlotHandle{ 2, 1 }) && !map.Remove(SlotHandle{ 1000, 1 }));
+
+    // Reusing the slot gives the next odd generation; the old handle stays stale.
+    SlotHandle third = map.Insert("third");
+    ENGINE_CHECK(third.Index == first.Index && third.Generation == first.Generation + 2);
+    ENGINE_CHECK(!map.Contains(first) && *map.Find(third) == "third");
+
+    // Many reuses of one slot never bring an old handle back.
+    std::vector<SlotHandle> history;
+    SlotHandle current = third;
+    for (int i = 0; i < 1000; ++i) {
+      history.push_back(current);
+      map.Remove(current);
+      current = map.Insert(std::to_string(i));
+    }
+    bool allStale = current.Index == first.Index;
+    for (const SlotHandle& old : history) {
+      allStale = allStale && !map.Contains(old) && old.Generation % 2 == 1;
+    }
+    ENGINE_CHECK(allStale);
+    ENGINE_CHECK(*map.Find(current) == "999");
+
+    // Empty invalidates everything it held.
+    map.Empty();
+    ENGINE_CHECK(map.Num() == 0 && !map.Contains(current) && !map.Contains(second));
+  }
+
+  void
+  testFreeListReuse() {
+    TSlotMap<int> map;
+    std::vector<SlotHandle> handles;
+    for (int i = 0; i < 10; ++i) {
+      handles.push_back(map.Insert(i));
+    }
+    // The free list is LIFO: slots come back in the reverse order they were freed.
+    map.Remove(handles[3]);
+    map.Remove(handles[7]);
+    map.Remove(handles[5]);
+    SlotHandle a = map.Insert(100);
+    SlotHandle b = map.Insert(101);
+    SlotHandle c = map.Insert(102);
+    ENGINE_CHECK(a.Index == 5 && b.Index == 7 && c.Index == 3);
+    // With the free list exhausted a new slot is appended.
+    SlotHandle d = map.Insert(103);
+    ENGINE_CHECK(d.Index == 10 && d.Generation == 1);
+    ENGINE_CHECK(*map.Find(a) == 100 && *map.Find(b) == 101 && *map.Find(c) == 102 && *map.Find(d) == 103);
+    ENGINE_CHECK(map.Num() == 11);
+  }
+
+  void
+  testSwapRemove() {
+    TSlotMap<int> map;
+    std::vector<SlotHandle> handles;
+    for (int i = 0; i < 10; ++i) {
+      handles.push_back(map.Insert(i * 10));
+    }
+    // Removing the first element moves the last one into dense position 0.
+    ENGINE_CHECK(map.Remove(handles[0]));
+    ENGINE_CHECK(map.GetData()[0] == 90);
+    ENGINE_CHECK(map.Find(handles[9]) == &map.GetData()[0]);
+    ENGINE_CHECK(map.GetHandle(0) == handles[9]);
+
+    // Removing the last dense element moves nothing.
+    SlotHandle last = map.GetHandle(map.Num() - 1);
+    ENGINE_CHECK(last == handles[8]);
+    ENGINE_CHECK(map.Remove(last));
+    ENGINE_CHECK(*map.Find(handles[9]) == 90 && map.Num() == 8);
+
+    // Every surviving handle still finds its own value, and GetHandle agrees with it.
+    bool consistent = true;
+    for (int i = 1; i < 8; ++i) {
+      consistent = consistent && *map.Find(handles[i]) == i * 10;
+    }
+    for (size_t i = 0; i < map.Num(); ++i) {
+      consistent = consistent && map.Find(map.GetHandle(i)) == &map.GetData()[i];
+    }
+    ENGINE_CHECK(consistent);
+
+    int sum = 0;
+    for (int value : map) {
+      sum += value;
+    }
+    ENGINE_CHECK(sum == 10 + 20 + 30 + 40 + 50 + 60 + 70 + 90);
+  }
+
+  void
+  testAgainstReference() {
+    TSlotMap<std::string> map;
+    std::unordered_map<uint64_t, std::string> reference;
+    std::vector<SlotHandle> live;
+    std::vector<SlotHandle> stale;
+    std::mt19937 rng(6);
+    bool agrees = true;
+    for (int i = 0; i < 100000; ++i) {
+      if (live.empty() || rng() % 5 < 3) {
+        std::string value = std::to_string(i);
+        SlotHandle handle = map.Insert(value);
+        agrees = agrees && reference.count(handle.ToUInt64()) == 0;
+        reference[handle.ToUInt64()] = value;
+        live.push_back(handle);
+      }
+      else {
+        size_t pick = rng() % live.size();
+        SlotHandle handle = live[pick];
+        live[pick] = live.back();
+        live.pop_back();
+        agrees = agrees && map.Remove(handle);
+        reference.erase(handle.ToUInt64());
+        stale.push_back(handle);
+      }
+    }
+    ENGINE_CHECK(agrees);
+    ENGINE_CHECK(map.Num() == reference.size());
+    bool liveFound = true;
+    for (const SlotHandle& handle : live) {
+      const std::string* value = map.Find(handle);
+      liveFound = liveFound && value && *value == reference[handle.ToUInt64()];
+    }
+    ENGINE_CHECK(liveFound);
+    bool staleMissing = true;
+    for (const SlotHandle& handle : stale) {
+      staleMissing = staleMissing && !map.Contains(handle);
+    }
+    ENGINE_CHECK(staleMissing);
+  }
+}
+
+int
+main() {
+  testStaleHandles();
+  testFreeListReuse();
+  testSwapRemove();
+  testAgainstReference();
+  return EngineTests::testResult();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * @brief Minimal test and benchmark helpers shared by the files in tests/.
+ *
+ * A test executable calls ENGINE_CHECK as often as it likes and returns
+ * testResult() from main; ctest treats a non-zero exit code as a failure.
+ */
+namespace EngineTests {
+  inline std::atomic<int>&
+  failureCount() {
+    static std::atomic<int> failures(0);
+    return failures;
+  }
+
+  inline int
+  testResult() {
+    if (failureCount() == 0) {
+      std::printf("all checks passed\n");
+      return 0;
+    }
+    std::printf("%d check(s) failed\n", failureCount().load());
+    return 1;
+  }
+
+  /**
+   * @brief Runs fn repeats times and returns the fastest run in milliseconds.
+   */
+  template <typename Fn>
+  double
+  bestOfMs(int repeats, Fn&& fn) {
+    double best = 1e300;
+    for (int i = 0; i < repeats; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      fn();
+      double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      best = ms < best ? ms : best;
+    }
+    return best;
+  }
+
+  /**
+   * @brief Keeps a value alive so the optimizer cannot drop the work that produced it.
+   */
+  template <typename T>
+  void
+  doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+  }
+}
+
+#define ENGINE_CHECK(condition)                                                        \
+  do {                                                                                 \
+    if (!(condition)) {                                                                \
+      std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);        \
+      ++EngineTests::failureCount();                                                   \
+    }                                                                                  \
+  } while (0)
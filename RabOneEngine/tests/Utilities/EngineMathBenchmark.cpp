@@ -0,0 +1,84 @@
+// Throughput of the EngineMath transcendentals against the float overloads of libm,
+// in ns per call over a 64K-element array.
+//
+// EngineMathBenchmark --exhaustive also measures the maximum error of each function over
+// all 2^32 float inputs (about two minutes per function).
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "MathAccuracy.h"
+#include "TestHarness.h"
+
+namespace EU = EngineUtilities;
+
+namespace {
+  const size_t kCount = 1 << 16;
+  const int kRepeats = 50;
+
+  template <typename Fn>
+  double
+  nsPerCall(const std::vector<float>& input, std::vector<float>& output, Fn fn) {
+    double ms = EngineTests::bestOfMs(kRepeats, [&]() {
+      for (size_t i = 0; i < input.size(); ++i) {
+        output[i] = fn(input[i]);
+      }
+      EngineTests::doNotOptimize(output[0]);
+    });
+    return ms * 1e6 / static_cast<double>(input.size());
+  }
+
+  template <typename Engine, typename Libm>
+  void
+  compare(const char* name, float lo, float hi, Engine engine, Libm libm) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> distribution(lo, hi);
+    std::vector<float> input(kCount);
+    std::vector<float> output(kCount);
+    for (float& value : input) {
+      value = distribution(rng);
+    }
+    double engineNs = nsPerCall(input, output, engine);
+    double libmNs = nsPerCall(input, output, libm);
+    std::printf("%-8s engine %5.2f ns  libm %5.2f ns  (%.2fx)\n", name, engineNs, libmNs, libmNs / engineNs);
+  }
+
+  template <typename Fn, typename Reference>
+  void
+  sweep(const char* name, Fn fn, Reference reference, float lo, float hi) {
+    EngineTests::ErrorReport report = EngineTests::measureError(fn, reference, lo, hi, 1);
+    std::printf("%-8s %.3f ULP at %.9g\n", name, report.maxError, report.worstInput);
+    std::fflush(stdout);
+  }
+}
+
+int
+main(int argc, char** argv) {
+  compare("sin", -100.0f, 100.0f, [](float x) { return EU::sin(x); }, [](float x) { return std::sin(x); });
+  compare("cos", -100.0f, 100.0f, [](float x) { return EU::cos(x); }, [](float x) { return std::cos(x); });
+  compare("tan", -1.5f, 1.5f, [](float x) { return EU::tan(x); }, [](float x) { return std::tan(x); });
+  compare("asin", -1.0f, 1.0f, [](float x) { return EU::asin(x); }, [](float x) { return std::asin(x); });
+  compare("acos", -1.0f, 1.0f, [](float x) { return EU::acos(x); }, [](float x) { return std::acos(x); });
+  compare("atan", -10.0f, 10.0f, [](float x) { return EU::atan(x); }, [](float x) { return std::atan(x); });
+  compare("exp", -80.0f, 80.0f, [](float x) { return EU::exp(x); }, [](float x) { return std::exp(x); });
+  compare("log", 1e-6f, 1e6f, [](float x) { return EU::log(x); }, [](float x) { return std::log(x); });
+  compare("fastSin", -100.0f, 100.0f, [](float x) { return EU::fastSin(x); }, [](float x) { return std::sin(x); });
+  compare("fastAtan", -10.0f, 10.0f, [](float x) { return EU::fastAtan(x); }, [](float x) { return std::atan(x); });
+  compare("fastExp", -80.0f, 80.0f, [](float x) { return EU::fastExp(x); }, [](float x) { return std::exp(x); });
+  compare("fastLog", 1e-6f, 1e6f, [](float x) { return EU::fastLog(x); }, [](float x) { return std::log(x); });
+
+  if (argc > 1 && std::strcmp(argv[1], "--exhaustive") == 0) {
+    std::printf("\nMaximum error over every float input:\n");
+    sweep("sin", [](float x) { return EU::sin(x); }, [](double x) { return std::sin(x); }, -1e6f, 1e6f);
+    sweep("cos", [](float x) { return EU::cos(x); }, [](double x) { return std::cos(x); }, -1e6f, 1e6f);
+    sweep("tan", [](float x) { return EU::tan(x); }, [](double x) { return std::tan(x); }, -1e6f, 1e6f);
+    sweep("asin", [](float x) { return EU::asin(x); }, [](double x) { return std::asin(x); }, -1.0f, 1.0f);
+    sweep("acos", [](float x) { return EU::acos(x); }, [](double x) { return std::acos(x); }, -1.0f, 1.0f);
+    sweep("atan", [](float x) { return EU::atan(x); }, [](double x) { return std::atan(x); }, -INFINITY, INFINITY);
+    sweep("exp", [](float x) { return EU::exp(x); }, [](double x) { return std::exp(x); }, -87.33f, 88.72f);
+    sweep("log", [](float x) { return EU::log(x); }, [](double x) { return std::log(x); }, 0.0f, INFINITY);
+  }
+  return 0;
+}
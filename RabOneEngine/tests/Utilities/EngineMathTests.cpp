@@ -0,0 +1,95 @@
+// Checks the documented error bounds in EngineMath.h against libm in double precision.
+// Every 251st float bit pattern is tested (about 17M inputs per function); run
+// EngineMathBenchmark --exhaustive to sweep all 2^32.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "MathAccuracy.h"
+#include "TestHarness.h"
+
+namespace EU = EngineUtilities;
+using EngineTests::ErrorReport;
+using EngineTests::measureError;
+
+namespace {
+  const uint32_t kStride = 251;
+  const float kInf = INFINITY;
+
+  template <typename Fn, typename Reference>
+  void
+  checkBound(const char* name, Fn fn, Reference reference, float lo, float hi, double bound,
+             bool absolute = false) {
+    ErrorReport report = measureError(fn, reference, lo, hi, kStride, absolute);
+    std::printf("%-10s max %.3g %s at %.9g (bound %g, %llu samples)\n", name, report.maxError,
+                absolute ? "abs" : "ULP", report.worstInput, bound,
+                static_cast<unsigned long long>(report.samples));
+    ENGINE_CHECK(report.maxError <= bound);
+  }
+
+  void
+  testTrigonometric() {
+    checkBound("sin", [](float x) { return EU::sin(x); }, [](double x) { return std::sin(x); }, -1e6f, 1e6f, 2.0);
+    checkBound("cos", [](float x) { return EU::cos(x); }, [](double x) { return std::cos(x); }, -1e6f, 1e6f, 2.0);
+    checkBound("tan", [](float x) { return EU::tan(x); }, [](double x) { return std::tan(x); }, -1e6f, 1e6f, 4.0);
+    checkBound("asin", [](float x) { return EU::asin(x); }, [](double x) { return std::asin(x); }, -1.0f, 1.0f, 3.0);
+    checkBound("acos", [](float x) { return EU::acos(x); }, [](double x) { return std::acos(x); }, -1.0f, 1.0f, 2.0);
+    checkBound("atan", [](float x) { return EU::atan(x); }, [](double x) { return std::atan(x); }, -kInf, kInf, 1.0);
+
+    // atan(x) below the old worst case (x ~ 0.432) must stay within the new bound.
+    ENGINE_CHECK(EngineTests::ulpError(EU::atan(0.432068676f), std::atan(0.432068676)) <= 1.0);
+    ENGINE_CHECK(EngineTests::ulpError(EU::atan(-0.452f), std::atan(static_cast<double>(-0.452f))) <= 1.0);
+  }
+
+  void
+  testAtan2() {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+    double maxError = 0.0;
+    for (int i = 0; i < 2000000; ++i) {
+      float y = coordinate(rng);
+      float x = coordinate(rng);
+      double error = EngineTests::ulpError(EU::atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x)));
+      maxError = error > maxError ? error : maxError;
+    }
+    std::printf("%-10s max %.3g ULP (bound 4, 2000000 samples)\n", "atan2", maxError);
+    ENGINE_CHECK(maxError <= 4.0);
+    ENGINE_CHECK(EU::atan2(0.0f, 1.0f) == 0.0f);
+    ENGINE_CHECK(EU::atan2(1.0f, 0.0f) == EU::MathConstants::HalfPi);
+  }
+
+  void
+  testExponential() {
+    checkBound("exp", [](float x) { return EU::exp(x); }, [](double x) { return std::exp(x); }, -87.33f, 88.72f, 1.03);
+    checkBound("log", [](float x) { return EU::log(x); }, [](double x) { return std::log(x); }, 0.0f, kInf, 1.0);
+    ENGINE_CHECK(EU::exp(100.0f) == kInf);
+    ENGINE_CHECK(EU::exp(-100.0f) == 0.0f);
+    ENGINE_CHECK(EU::log(0.0f) == -kInf);
+    ENGINE_CHECK(std::isnan(EU::log(-1.0f)));
+  }
+
+  void
+  testFastVariants() {
+    checkBound("fastSin", [](float x) { return EU::fastSin(x); }, [](double x) { return std::sin(x); }, -100.0f, 100.0f, 2e-5, true);
+    checkBound("fastCos", [](float x) { return EU::fastCos(x); }, [](double x) { return std::cos(x); }, -100.0f, 100.0f, 2e-5, true);
+    checkBound("fastAsin", [](float x) { return EU::fastAsin(x); }, [](double x) { return std::asin(x); }, -1.0f, 1.0f, 7e-5, true);
+    checkBound("fastAcos", [](float x) { return EU::fastAcos(x); }, [](double x) { return std::acos(x); }, -1.0f, 1.0f, 7e-5, true);
+    checkBound("fastAtan", [](float x) { return EU::fastAtan(x); }, [](double x) { return std::atan(x); }, -kInf, kInf, 2e-5, true);
+    checkBound("fastLog", [](float x) { return EU::fastLog(x); }, [](double x) { return std::log(x); }, 1.2e-38f, 3e38f, 2e-5, true);
+
+    // fastExp documents a relative bound.
+    ErrorReport report = measureError([](float x) { return EU::fastExp(x) / static_cast<float>(std::exp(static_cast<double>(x))); },
+                                      [](double) { return 1.0; }, -80.0f, 80.0f, kStride, true);
+    std::printf("%-10s max %.3g rel at %.9g (bound 1e-05)\n", "fastExp", report.maxError, report.worstInput);
+    ENGINE_CHECK(report.maxError <= 1e-5);
+  }
+}
+
+int
+main() {
+  testTrigonometric();
+  testAtan2();
+  testExponential();
+  testFastVariants();
+  return EngineTests::testResult();
+}
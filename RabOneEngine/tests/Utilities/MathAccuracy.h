@@ -0,0 +1,70 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Error measurement against libm, shared by EngineMathTests and EngineMathBenchmark.
+ */
+namespace EngineTests {
+  /**
+   * @brief Distance between a float result and the double-precision reference, in units
+   * in the last place of the float nearest to the reference.
+   */
+  inline double
+  ulpError(float result, double reference) {
+    if (std::isnan(reference)) {
+      return std::isnan(result) ? 0.0 : 1e30;
+    }
+    if (std::isinf(reference)) {
+      return static_cast<double>(result) == reference ? 0.0 : 1e30;
+    }
+    int exponent = 0;
+    std::frexp(std::fabs(reference), &exponent);
+    double ulp = std::ldexp(1.0, exponent - 24 > -149 ? exponent - 24 : -149);
+    return std::fabs(static_cast<double>(result) - reference) / ulp;
+  }
+
+  inline float
+  floatFromBits(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief Largest error of one function over an input domain.
+   */
+  struct ErrorReport {
+    double maxError = 0.0;
+    float worstInput = 0.0f;
+    uint64_t samples = 0;
+  };
+
+  /**
+   * @brief Walks every stride-th float bit pattern (stride 1 = all 2^32 of them) and
+   * measures fn against reference on those inside [lo, hi].
+   *
+   * @param absolute Measure absolute error instead of ULPs (for the fast* variants).
+   */
+  template <typename Fn, typename Reference>
+  ErrorReport
+  measureError(Fn fn, Reference reference, float lo, float hi, uint32_t stride, bool absolute = false) {
+    ErrorReport report;
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += stride) {
+      float x = floatFromBits(static_cast<uint32_t>(bits));
+      if (!(x >= lo && x <= hi)) {
+        continue;
+      }
+      double expected = reference(static_cast<double>(x));
+      float result = fn(x);
+      double error = absolute ? std::fabs(static_cast<double>(result) - expected) : ulpError(result, expected);
+      if (error > report.maxError) {
+        report.maxError = error;
+        report.worstInput = x;
+      }
+      ++report.samples;
+    }
+    return report;
+  }
+}
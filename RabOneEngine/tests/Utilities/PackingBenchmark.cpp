@@ -0,0 +1,81 @@
+// Throughput of the Packing.h array conversions against a loop over the scalar
+// versions, in millions of values (or vectors) per second over 64K elements.
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/Packing.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const size_t kCount = 64 * 1024;
+  const int kRepeats = 100;
+
+  template <typename Scalar, typename Batch>
+  void
+  compare(const char* name, Scalar scalar, Batch batch) {
+    double scalarMs = EngineTests::bestOfMs(kRepeats, scalar);
+    double batchMs = EngineTests::bestOfMs(kRepeats, batch);
+    double scalarRate = static_cast<double>(kCount) / (scalarMs * 1e3);
+    double batchRate = static_cast<double>(kCount) / (batchMs * 1e3);
+    std::printf("%-20s scalar %7.0f M/s  array %7.0f M/s  (%.1fx)\n", name, scalarRate, batchRate, batchRate / scalarRate);
+  }
+}
+
+int
+main() {
+  std::mt19937 rng(2);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+  std::normal_distribution<float> gaussian;
+  std::vector<float> values(kCount);
+  std::vector<Vector3> normals(kCount);
+  std::vector<Vector4> tangents(kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    values[i] = unit(rng);
+    normals[i] = Vector3(gaussian(rng), gaussian(rng), gaussian(rng)).normalize();
+    tangents[i] = Vector4(normals[i].x * 0.5f + 0.5f, normals[i].y * 0.5f + 0.5f, normals[i].z * 0.5f + 0.5f, 1.0f);
+  }
+  std::vector<uint16_t> halves(kCount);
+  std::vector<float> floats(kCount);
+  std::vector<uint8_t> bytes(kCount);
+  std::vector<int16_t> shorts(kCount);
+  std::vector<uint32_t> words(kCount);
+  std::vector<Vector3> decodedNormals(kCount);
+  std::vector<Vector4> decodedTangents(kCount);
+  // Taken from the vector at run time, like a real caller; a constant count lets GCC
+  // warn about the (dead) scalar tails of the array functions.
+  const size_t count = values.size();
+  floatToHalf(values.data(), halves.data(), count);
+  packOctahedral16(normals.data(), words.data(), count);
+
+  std::printf("%s\n", ENGINE_SIMD_F16C ? "F16C + SSE2" : (ENGINE_SIMD_SSE2 ? "SSE2" : "scalar"));
+  compare("floatToHalf",
+    [&]() { for (size_t i = 0; i < count; ++i) halves[i] = floatToHalf(values[i]); EngineTests::doNotOptimize(halves[0]); },
+    [&]() { floatToHalf(values.data(), halves.data(), count); EngineTests::doNotOptimize(halves[0]); });
+  compare("halfToFloat",
+    [&]() { for (size_t i = 0; i < count; ++i) floats[i] = halfToFloat(halves[i]); EngineTests::doNotOptimize(floats[0]); },
+    [&]() { halfToFloat(halves.data(), floats.data(), count); EngineTests::doNotOptimize(floats[0]); });
+  compare("packUnorm8",
+    [&]() { for (size_t i = 0; i < count; ++i) bytes[i] = packUnorm8(values[i]); EngineTests::doNotOptimize(bytes[0]); },
+    [&]() { packUnorm8(values.data(), bytes.data(), count); EngineTests::doNotOptimize(bytes[0]); });
+  compare("packSnorm16",
+    [&]() { for (size_t i = 0; i < count; ++i) shorts[i] = packSnorm16(values[i]); EngineTests::doNotOptimize(shorts[0]); },
+    [&]() { packSnorm16(values.data(), shorts.data(), count); EngineTests::doNotOptimize(shorts[0]); });
+  compare("unpackSnorm16",
+    [&]() { for (size_t i = 0; i < count; ++i) floats[i] = unpackSnorm16(shorts[i]); EngineTests::doNotOptimize(floats[0]); },
+    [&]() { unpackSnorm16(shorts.data(), floats.data(), count); EngineTests::doNotOptimize(floats[0]); });
+  compare("packOctahedral16",
+    [&]() { for (size_t i = 0; i < count; ++i) words[i] = packOctahedral16(normals[i]); EngineTests::doNotOptimize(words[0]); },
+    [&]() { packOctahedral16(normals.data(), words.data(), count); EngineTests::doNotOptimize(words[0]); });
+  compare("unpackOctahedral16",
+    [&]() { for (size_t i = 0; i < count; ++i) decodedNormals[i] = unpackOctahedral16(words[i]); EngineTests::doNotOptimize(decodedNormals[0]); },
+    [&]() { unpackOctahedral16(words.data(), decodedNormals.data(), count); EngineTests::doNotOptimize(decodedNormals[0]); });
+  compare("packUnorm1010102",
+    [&]() { for (size_t i = 0; i < count; ++i) words[i] = packUnorm1010102(tangents[i]); EngineTests::doNotOptimize(words[0]); },
+    [&]() { packUnorm1010102(tangents.data(), words.data(), count); EngineTests::doNotOptimize(words[0]); });
+  compare("unpackUnorm1010102",
+    [&]() { for (size_t i = 0; i < count; ++i) decodedTangents[i] = unpackUnorm1010102(words[i]); EngineTests::doNotOptimize(decodedTangents[0]); },
+    [&]() { unpackUnorm1010102(words.data(), decodedTangents.data(), count); EngineTests::doNotOptimize(decodedTangents[0]); });
+  return 0;
+}
@@ -0,0 +1,273 @@
+// Packing.h: half floats against the F16C instructions over every input, round-trip
+// error of each format, and the array versions against the scalar ones. Built with the
+// machine's instruction set (F16C), with SSE only and with ENGINE_NO_SIMD.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/Packing.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  double
+  maxOf(double a, double b) {
+    return a > b ? a : b;
+  }
+
+  bool
+  isHalfNaN(uint16_t half) {
+    return (half & 0x7C00u) == 0x7C00u && (half & 0x03FFu) != 0;
+  }
+
+  /**
+   * @brief Same half, or both NaN with the same sign (F16C keeps NaN payload bits,
+   * the software conversion returns the canonical quiet NaN).
+   */
+  bool
+  sameHalf(uint16_t a, uint16_t b) {
+    return a == b || (isHalfNaN(a) && isHalfNaN(b) && (a & 0x8000u) == (b & 0x8000u));
+  }
+
+  bool
+  sameFloat(float a, float b) {
+    return floatAsBits(a) == floatAsBits(b) || (std::isnan(a) && std::isnan(b) && std::signbit(a) == std::signbit(b));
+  }
+
+  void
+  testHalfToFloatAllInputs() {
+    std::vector<uint16_t> halves(65536);
+    for (uint32_t i = 0; i < 65536; ++i) {
+      halves[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<float> batch(65536);
+    halfToFloat(halves.data(), batch.data(), halves.size());
+
+    bool scalarOk = true;
+    bool batchOk = true;
+    for (uint32_t i = 0; i < 65536; ++i) {
+      float scalar = halfToFloat(halves[i]);
+#if ENGINE_SIMD_F16C
+      float reference = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(static_cast<int>(i))));
+#else
+      // Without F16C: the half is exactly m * 2^(e - 25) for e > 0, m * 2^-24 for e = 0.
+      uint32_t exponent = (i >> 10) & 0x1Fu;
+      uint32_t mantissa = i & 0x3FFu;
+      float magnitude = exponent == 0x1Fu ? (mantissa ? NAN : INFINITY)
+                        : exponent == 0 ? std::ldexp(static_cast<float>(mantissa), -24)
+                                        : std::ldexp(static_cast<float>(mantissa | 0x400u), static_cast<int>(exponent) - 25);
+      float reference = (i & 0x8000u) ? -magnitude : magnitude;
+#endif
+      scalarOk = scalarOk && sameFloat(scalar, reference);
+      batchOk = batchOk && sameFloat(batch[i], reference);
+      if (std::isnan(reference)) {
+        // Quiet NaN, as from F16C.
+        scalarOk = scalarOk && (floatAsBits(scalar) & 0x00400000u) != 0;
+      }
+    }
+    ENGINE_CHECK(scalarOk);
+    ENGINE_CHECK(batchOk);
+  }
+
+  /**
+   * @brief Every one of the 2^32 floats, in 64K chunks, through the scalar, the SSE2 and
+   * the array conversion. The reference is F16C when the build has it, otherwise the
+   * scalar conversion; without SIMD there is nothing to compare, so it is skipped.
+   */
+  void
+  testFloatToHalfAllInputs() {
+#if ENGINE_SIMD_SSE2
+    const size_t chunk = 65536;
+    std::vector<float> values(chunk);
+    std::vector<uint16_t> batch(chunk);
+    uint64_t scalarMismatches = 0;
+    uint64_t batchMismatches = 0;
+    uint64_t sseMismatches = 0;
+    for (uint64_t base = 0; base < (1ull << 32); base += chunk) {
+      for (size_t i = 0; i < chunk; ++i) {
+        values[i] = bitsAsFloat(static_cast<uint32_t>(base + i));
+      }
+      floatToHalf(values.data(), batch.data(), chunk);
+      for (size_t i = 0; i < chunk; i += 4) {
+#if ENGINE_SIMD_F16C
+        __m128i reference4 = _mm_cvtps_ph(_mm_loadu_ps(&values[i]), _MM_FROUND_TO_NEAREST_INT);
+        uint16_t reference[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(reference), reference4);
+#else
+        uint16_t reference[4] = { floatToHalf(values[i]), floatToHalf(values[i + 1]),
+                                  floatToHalf(values[i + 2]), floatToHalf(values[i + 3]) };
+#endif
+        uint16_t sse[8];
+        storeLow16x4(sse, floatToHalf4(_mm_loadu_ps(&values[i])));
+        for (size_t lane = 0; lane < 4; ++lane) {
+          scalarMismatches += sameHalf(floatToHalf(values[i + lane]), reference[lane]) ? 0 : 1;
+          batchMismatches += sameHalf(batch[i + lane], reference[lane]) ? 0 : 1;
+          sseMismatches += sameHalf(sse[lane], reference[lane]) ? 0 : 1;
+        }
+      }
+    }
+    std::printf("floatToHalf over 2^32 inputs against %s: %llu scalar, %llu SSE2, %llu array mismatches\n",
+                ENGINE_SIMD_F16C ? "F16C" : "the scalar conversion",
+                static_cast<unsigned long long>(scalarMismatches), static_cast<unsigned long long>(sseMismatches),
+                static_cast<unsigned long long>(batchMismatches));
+    ENGINE_CHECK(scalarMismatches == 0);
+    ENGINE_CHECK(sseMismatches == 0);
+    ENGINE_CHECK(batchMismatches == 0);
+#endif
+  }
+
+  void
+  testRoundTripErrors() {
+    // Half: relative error at most 2^-11 across the normal range.
+    double halfError = 0.0;
+    for (uint32_t bits = 0x38800000u; bits < 0x477FE000u; bits += 37) {
+      float value = bitsAsFloat(bits);
+      double error = std::fabs(static_cast<double>(halfToFloat(floatToHalf(value))) - value) / value;
+      halfError = error > halfError ? error : halfError;
+    }
+    std::printf("half round trip: max relative error %.3g\n", halfError);
+    ENGINE_CHECK(halfError <= std::ldexp(1.0, -11));
+
+    // Normalized integers: at most half a step (plus float rounding of the scale).
+    double unorm8 = 0.0, snorm8 = 0.0, unorm16 = 0.0, snorm16 = 0.0;
+    for (int i = 0; i <= 1000000; ++i) {
+      float u = static_cast<float>(i) / 1000000.0f;
+      float s = u * 2.0f - 1.0f;
+      unorm8 = maxOf(unorm8, std::fabs(unpackUnorm8(packUnorm8(u)) - u));
+      snorm8 = maxOf(snorm8, std::fabs(unpackSnorm8(packSnorm8(s)) - s));
+      unorm16 = maxOf(unorm16, std::fabs(unpackUnorm16(packUnorm16(u)) - u));
+      snorm16 = maxOf(snorm16, std::fabs(unpackSnorm16(packSnorm16(s)) - s));
+    }
+    std::printf("unorm8 %.3g, snorm8 %.3g, unorm16 %.3g, snorm16 %.3g max absolute error\n",
+                unorm8, snorm8, unorm16, snorm16);
+    ENGINE_CHECK(unorm8 <= 0.5 / 255.0 + 1e-7);
+    ENGINE_CHECK(snorm8 <= 0.5 / 127.0 + 1e-7);
+    ENGINE_CHECK(unorm16 <= 0.5 / 65535.0 + 1e-7);
+    ENGINE_CHECK(snorm16 <= 0.5 / 32767.0 + 1e-7);
+
+    // Out of range and NaN clamp.
+    ENGINE_CHECK(packUnorm8(2.0f) == 255 && packUnorm8(-1.0f) == 0 && packUnorm8(NAN) == 0);
+    ENGINE_CHECK(packSnorm16(-3.0f) == -32767 && packSnorm16(NAN) == -32767);
+    ENGINE_CHECK(unpackSnorm8(-128) == -1.0f);
+
+    // Octahedral normals: below 0.04 degrees.
+    std::mt19937 rng(21);
+    std::normal_distribution<float> gaussian;
+    double worstDegrees = 0.0;
+    for (int i = 0; i < 1000000; ++i) {
+      Vector3 normal = Vector3(gaussian(rng), gaussian(rng), gaussian(rng)).normalize();
+      Vector3 decoded = unpackOctahedral16(packOctahedral16(normal));
+      double cosine = static_cast<double>(normal.x) * decoded.x + static_cast<double>(normal.y) * decoded.y +
+                      static_cast<double>(normal.z) * decoded.z;
+      double degrees = std::acos(cosine < 1.0 ? cosine : 1.0) * 180.0 / 3.14159265358979323846;
+      worstDegrees = degrees > worstDegrees ? degrees : worstDegrees;
+    }
+    std::printf("octahedral16: max %.4f degrees\n", worstDegrees);
+    ENGINE_CHECK(worstDegrees < 0.04);
+
+    // 10-10-10-2.
+    double error1010102 = 0.0;
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (int i = 0; i < 100000; ++i) {
+      Vector4 value(unit(rng), unit(rng), unit(rng), unit(rng));
+      Vector4 decoded = unpackUnorm1010102(packUnorm1010102(value));
+      error1010102 = maxOf(error1010102, std::fabs(decoded.x - value.x));
+      error1010102 = maxOf(error1010102, std::fabs(decoded.y - value.y));
+      error1010102 = maxOf(error1010102, std::fabs(decoded.z - value.z));
+      ENGINE_CHECK(std::fabs(decoded.w - value.w) <= 0.5 / 3.0 + 1e-7);
+    }
+    ENGINE_CHECK(error1010102 <= 0.5 / 1023.0 + 1e-7);
+  }
+
+  /**
+   * @brief Array versions against the scalar ones, for counts that end in every tail.
+   */
+  void
+  testArraysMatchScalar() {
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> wide(-1.5f, 1.5f);
+    std::normal_distribution<float> gaussian;
+    for (size_t count : { size_t(1), size_t(7), size_t(15), size_t(16), size_t(33), size_t(1000) }) {
+      std::vector<float> values(count);
+      for (float& value : values) {
+        value = wide(rng);
+      }
+      // Exact ties and specials.
+      const float specials[] = { 0.5f / 255.0f, 1.5f / 255.0f, NAN, -0.0f, INFINITY, -INFINITY, 65520.0f, 1e-8f };
+      for (size_t i = 0; i < count && i < sizeof(specials) / sizeof(specials[0]); ++i) {
+        values[i * 3 % count] = specials[i];
+      }
+
+      std::vector<uint16_t> halves(count);
+      std::vector<float> floats(count);
+      floatToHalf(values.data(), halves.data(), count);
+      halfToFloat(halves.data(), floats.data(), count);
+      std::vector<uint8_t> u8(count);
+      std::vector<int8_t> s8(count);
+      std::vector<uint16_t> u16(count);
+      std::vector<int16_t> s16(count);
+      packUnorm8(values.data(), u8.data(), count);
+      packSnorm8(values.data(), s8.data(), count);
+      packUnorm16(values.data(), u16.data(), count);
+      packSnorm16(values.data(), s16.data(), count);
+      std::vector<float> unpackedU8(count), unpackedS8(count), unpackedU16(count), unpackedS16(count);
+      unpackUnorm8(u8.data(), unpackedU8.data(), count);
+      unpackSnorm8(s8.data(), unpackedS8.data(), count);
+      unpackUnorm16(u16.data(), unpackedU16.data(), count);
+      unpackSnorm16(s16.data(), unpackedS16.data(), count);
+
+      bool ok = true;
+      for (size_t i = 0; i < count; ++i) {
+        ok = ok && sameHalf(halves[i], floatToHalf(values[i]));
+        ok = ok && sameFloat(floats[i], halfToFloat(halves[i]));
+        ok = ok && u8[i] == packUnorm8(values[i]) && s8[i] == packSnorm8(values[i]);
+        ok = ok && u16[i] == packUnorm16(values[i]) && s16[i] == packSnorm16(values[i]);
+        ok = ok && unpackedU8[i] == unpackUnorm8(u8[i]) && unpackedS8[i] == unpackSnorm8(s8[i]);
+        ok = ok && unpackedU16[i] == unpackUnorm16(u16[i]) && unpackedS16[i] == unpackSnorm16(s16[i]);
+      }
+      ENGINE_CHECK(ok);
+
+      std::vector<Vector3> normals(count);
+      for (Vector3& normal : normals) {
+        normal = Vector3(gaussian(rng), gaussian(rng), gaussian(rng)).normalize();
+      }
+      normals[0] = Vector3(0.0f, 0.0f, -1.0f);
+      std::vector<uint32_t> octahedral(count);
+      std::vector<Vector3> decoded(count);
+      packOctahedral16(normals.data(), octahedral.data(), count);
+      unpackOctahedral16(octahedral.data(), decoded.data(), count);
+      std::vector<Vector4> tangents(count);
+      for (size_t i = 0; i < count; ++i) {
+        tangents[i] = Vector4(values[i] * 0.5f + 0.5f, normals[i].x * 0.5f + 0.5f, normals[i].y * 0.5f + 0.5f,
+                              (i & 1) ? 1.0f : 0.0f);
+      }
+      std::vector<uint32_t> packed1010102(count);
+      std::vector<Vector4> unpacked1010102(count);
+      packUnorm1010102(tangents.data(), packed1010102.data(), count);
+      unpackUnorm1010102(packed1010102.data(), unpacked1010102.data(), count);
+
+      ok = true;
+      for (size_t i = 0; i < count; ++i) {
+        ok = ok && octahedral[i] == packOctahedral16(normals[i]);
+        Vector3 scalar = unpackOctahedral16(octahedral[i]);
+        ok = ok && std::fabs(decoded[i].x - scalar.x) <= 1e-6f && std::fabs(decoded[i].y - scalar.y) <= 1e-6f &&
+             std::fabs(decoded[i].z - scalar.z) <= 1e-6f;
+        ok = ok && packed1010102[i] == packUnorm1010102(tangents[i]);
+        Vector4 scalar4 = unpackUnorm1010102(packed1010102[i]);
+        ok = ok && unpacked1010102[i].x == scalar4.x && unpacked1010102[i].y == scalar4.y &&
+             unpacked1010102[i].z == scalar4.z && unpacked1010102[i].w == scalar4.w;
+      }
+      ENGINE_CHECK(ok);
+    }
+  }
+}
+
+int
+main() {
+  testHalfToFloatAllInputs();
+  testFloatToHalfAllInputs();
+  testRoundTripErrors();
+  testArraysMatchScalar();
+  return EngineTests::testResult();
+}
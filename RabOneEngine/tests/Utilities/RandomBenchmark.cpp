@@ -0,0 +1,94 @@
+// Throughput of the Random.h generators in numbers per nanosecond over 64K outputs:
+// the scalar generators against std::mt19937, and the BatchRandom fills against
+// loops over the scalar generators.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/Random.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const size_t kCount = 64 * 1024;
+  const int kRepeats = 200;
+
+  template <typename Fn>
+  void
+  report(const char* name, Fn fn) {
+    double ms = EngineTests::bestOfMs(kRepeats, fn);
+    std::printf("%-34s %6.2f per ns\n", name, static_cast<double>(kCount) / (ms * 1e6));
+  }
+}
+
+int
+main() {
+  std::vector<uint32_t> words(kCount);
+  std::vector<uint64_t> wideWords(kCount);
+  std::vector<float> floats(kCount);
+  std::vector<Vector3> vectors(kCount);
+  std::mt19937 mersenne(1);
+  Xoshiro256 xoshiro(1);
+  PCG32 pcg(1, 2);
+  BatchRandom batch(1);
+
+  std::printf("%s\n", ENGINE_SIMD_AVX2 ? "AVX2" : (ENGINE_SIMD_SSE2 ? "SSE2" : "scalar"));
+  report("std::mt19937 (32-bit)", [&]() {
+    for (size_t i = 0; i < kCount; ++i) words[i] = static_cast<uint32_t>(mersenne());
+    EngineTests::doNotOptimize(words[0]);
+  });
+  report("PCG32::next (32-bit)", [&]() {
+    for (size_t i = 0; i < kCount; ++i) words[i] = pcg.next();
+    EngineTests::doNotOptimize(words[0]);
+  });
+  report("Xoshiro256::next (64-bit)", [&]() {
+    for (size_t i = 0; i < kCount; ++i) wideWords[i] = xoshiro.next();
+    EngineTests::doNotOptimize(wideWords[0]);
+  });
+  report("BatchRandom::fillUInt (32-bit)", [&]() {
+    batch.fillUInt(words.data(), kCount);
+    EngineTests::doNotOptimize(words[0]);
+  });
+
+  report("std::uniform_real_distribution", [&]() {
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (size_t i = 0; i < kCount; ++i) floats[i] = unit(mersenne);
+    EngineTests::doNotOptimize(floats[0]);
+  });
+  report("PCG32::nextFloat", [&]() {
+    for (size_t i = 0; i < kCount; ++i) floats[i] = pcg.nextFloat();
+    EngineTests::doNotOptimize(floats[0]);
+  });
+  report("Xoshiro256::nextFloat", [&]() {
+    for (size_t i = 0; i < kCount; ++i) floats[i] = xoshiro.nextFloat();
+    EngineTests::doNotOptimize(floats[0]);
+  });
+  report("BatchRandom::fillUniform", [&]() {
+    batch.fillUniform(floats.data(), kCount);
+    EngineTests::doNotOptimize(floats[0]);
+  });
+
+  report("unit vectors, Xoshiro256 + cos/sin", [&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      float z = xoshiro.nextFloat(-1.0f, 1.0f);
+      float azimuth = xoshiro.nextFloat(0.0f, 6.2831853f);
+      float r = std::sqrt(1.0f - z * z);
+      vectors[i] = Vector3(r * std::cos(azimuth), r * std::sin(azimuth), z);
+    }
+    EngineTests::doNotOptimize(vectors[0]);
+  });
+  report("BatchRandom::fillUnitVectors", [&]() {
+    batch.fillUnitVectors(vectors.data(), kCount);
+    EngineTests::doNotOptimize(vectors[0]);
+  });
+  report("BatchRandom::fillPointsInSphere", [&]() {
+    batch.fillPointsInSphere(vectors.data(), kCount, Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    EngineTests::doNotOptimize(vectors[0]);
+  });
+  report("BatchRandom::fillPointsInBox", [&]() {
+    batch.fillPointsInBox(vectors.data(), kCount, Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f));
+    EngineTests::doNotOptimize(vectors[0]);
+  });
+  return 0;
+}
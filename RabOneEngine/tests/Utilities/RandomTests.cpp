@@ -0,0 +1,292 @@
+// Known-answer and statistical sanity checks for Random.h: reference outputs of
+// SplitMix64 and PCG32, chi-square tests of the integer and float outputs, and the
+// length and distribution of BatchRandom's unit vectors. Also built with
+// ENGINE_NO_SIMD and without AVX, which must give the same BatchRandom sequences.
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/Random.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const size_t kSamples = 1 << 20;
+
+  /**
+   * @brief Pearson's chi-square statistic of bucket counts against a uniform distribution.
+   */
+  double
+  chiSquare(const std::vector<size_t>& counts, size_t total) {
+    double expected = static_cast<double>(total) / static_cast<double>(counts.size());
+    double sum = 0.0;
+    for (size_t count : counts) {
+      double difference = static_cast<double>(count) - expected;
+      sum += difference * difference / expected;
+    }
+    return sum;
+  }
+
+  /**
+   * @brief Loose upper bound for a chi-square statistic with the given degrees of
+   * freedom: the mean plus six standard deviations. The seeds are fixed, so a
+   * failure means a real bias rather than bad luck.
+   */
+  double
+  chiSquareLimit(size_t degreesOfFreedom) {
+    double k = static_cast<double>(degreesOfFreedom);
+    return k + 6.0 * std::sqrt(2.0 * k);
+  }
+
+  template <typename Generator>
+  bool
+  uniformIntegers(Generator generator) {
+    std::vector<size_t> counts(64, 0);
+    for (size_t i = 0; i < kSamples; ++i) {
+      ++counts[generator.nextUInt(64)];
+    }
+    // Lemire's method must stay unbiased for a bound that does not divide 2^32.
+    std::vector<size_t> oddCounts(3, 0);
+    for (size_t i = 0; i < kSamples; ++i) {
+      ++oddCounts[generator.nextUInt(3)];
+    }
+    return chiSquare(counts, kSamples) < chiSquareLimit(63) && chiSquare(oddCounts, kSamples) < chiSquareLimit(2);
+  }
+
+  template <typename Generator>
+  bool
+  uniformFloats(Generator generator) {
+    std::vector<size_t> counts(100, 0);
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    bool inRange = true;
+    for (size_t i = 0; i < kSamples; ++i) {
+      float u = generator.nextFloat();
+      inRange = inRange && u >= 0.0f && u < 1.0f;
+      ++counts[static_cast<size_t>(u * 100.0f)];
+      sum += u;
+      sumSquares += static_cast<double>(u) * u;
+    }
+    double n = static_cast<double>(kSamples);
+    double mean = sum / n;
+    double variance = sumSquares / n - mean * mean;
+    return inRange && std::fabs(mean - 0.5) < 6.0 * std::sqrt(1.0 / (12.0 * n)) &&
+           std::fabs(variance - 1.0 / 12.0) < 1e-3 && chiSquare(counts, kSamples) < chiSquareLimit(99);
+  }
+
+  void
+  testKnownAnswers() {
+    // SplitMix64 from state 0 (Vigna's reference implementation).
+    uint64_t state = 0;
+    ENGINE_CHECK(splitMix64(state) == 0xE220A8397B1DCDAFull);
+
+    // pcg32-global-demo: pcg32_srandom_r(&rng, 42, 54).
+    PCG32 pcg(42, 54);
+    const uint32_t expected[6] = { 0xa15c02b7u, 0x7b47f409u, 0xba1d3330u, 0x83d2f293u, 0xbfa4784bu, 0xcbed606eu };
+    bool same = true;
+    for (uint32_t value : expected) {
+      same = same && pcg.next() == value;
+    }
+    ENGINE_CHECK(same);
+    static_assert(PCG32(42, 54).next() == 0xa15c02b7u, "PCG32 is usable in constant expressions");
+
+    // advance() skips exactly delta steps, and 2^64 - n steps goes back n.
+    PCG32 stepped(42, 54);
+    for (int i = 0; i < 1000; ++i) {
+      stepped.next();
+    }
+    PCG32 skipped(42, 54);
+    skipped.advance(1000);
+    ENGINE_CHECK(skipped.next() == stepped.next());
+    skipped.advance(0ull - 5ull);
+    PCG32 reference(42, 54);
+    reference.advance(996);
+    ENGINE_CHECK(skipped.next() == reference.next());
+
+    // The first xoshiro256** output is determined by the SplitMix64-expanded seed.
+    uint64_t seed = 7;
+    splitMix64(seed);
+    uint64_t s1 = splitMix64(seed);
+    uint64_t times5 = s1 * 5;
+    ENGINE_CHECK(Xoshiro256(7).next() == ((times5 << 7) | (times5 >> 57)) * 9);
+
+    // jump() moves to a stream that shares no early outputs with the original.
+    Xoshiro256 original(11);
+    Xoshiro256 jumped = original;
+    jumped.jump();
+    std::vector<uint64_t> first(4096);
+    std::vector<uint64_t> second(4096);
+    for (size_t i = 0; i < first.size(); ++i) {
+      first[i] = original.next();
+      second[i] = jumped.next();
+    }
+    std::sort(first.begin(), first.end());
+    std::sort(second.begin(), second.end());
+    std::vector<uint64_t> shared;
+    std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(shared));
+    ENGINE_CHECK(shared.empty());
+  }
+
+  void
+  testGenerators() {
+    ENGINE_CHECK(uniformIntegers(Xoshiro256(1)));
+    ENGINE_CHECK(uniformIntegers(PCG32(1, 2)));
+    ENGINE_CHECK(uniformFloats(Xoshiro256(3)));
+    ENGINE_CHECK(uniformFloats(PCG32(3, 4)));
+
+    // Both work as UniformRandomBitGenerators with <random> and <algorithm>.
+    Xoshiro256 xoshiro(5);
+    std::uniform_int_distribution<int> die(1, 6);
+    int roll = die(xoshiro);
+    ENGINE_CHECK(roll >= 1 && roll <= 6);
+    std::vector<int> deck = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    PCG32 pcg(5, 6);
+    std::shuffle(deck.begin(), deck.end(), pcg);
+    std::vector<int> sorted = deck;
+    std::sort(sorted.begin(), sorted.end());
+    ENGINE_CHECK(sorted == std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+
+    float ranged = PCG32(9, 9).nextFloat(-2.0f, 3.0f);
+    ENGINE_CHECK(ranged >= -2.0f && ranged < 3.0f);
+  }
+
+  void
+  testBatchSequence() {
+    // BatchRandom is four jump()-separated Xoshiro256 streams read as 32-bit words
+    // (lane 0 low, lane 0 high, lane 1 low, ...) on every instruction set.
+    Xoshiro256 lanes[4] = { Xoshiro256(13), Xoshiro256(13), Xoshiro256(13), Xoshiro256(13) };
+    for (int lane = 1; lane < 4; ++lane) {
+      lanes[lane] = lanes[lane - 1];
+      lanes[lane].jump();
+    }
+    std::vector<uint32_t> expected;
+    for (int step = 0; step < 64; ++step) {
+      for (Xoshiro256& lane : lanes) {
+        uint64_t value = lane.next();
+        expected.push_back(static_cast<uint32_t>(value));
+        expected.push_back(static_cast<uint32_t>(value >> 32));
+      }
+    }
+
+    BatchRandom batch(13);
+    std::vector<uint32_t> words(200);
+    batch.fillUInt(words.data(), words.size());
+    ENGINE_CHECK(std::equal(words.begin(), words.end(), expected.begin()));
+    // 200 words are exactly 25 steps, so the floats start at word 200.
+    std::vector<float> floats(13);
+    batch.fillUniform(floats.data(), floats.size());
+    bool same = true;
+    for (size_t i = 0; i < floats.size(); ++i) {
+      same = same && floats[i] == uintToUnitFloat(expected[200 + i]);
+    }
+    ENGINE_CHECK(same);
+    // The 13 floats took two steps and dropped the last three words, and the AVX2
+    // loop, which keeps the state in registers, stored it back.
+    batch.fillUInt(words.data(), 8);
+    ENGINE_CHECK(std::equal(words.begin(), words.begin() + 8, expected.begin() + 216));
+
+    std::vector<float> uniform(kSamples);
+    BatchRandom(17).fillUniform(uniform.data(), uniform.size(), -3.0f, 5.0f);
+    std::vector<size_t> counts(64, 0);
+    bool inRange = true;
+    double sum = 0.0;
+    for (float u : uniform) {
+      inRange = inRange && u >= -3.0f && u < 5.0f;
+      ++counts[std::min<size_t>(63, static_cast<size_t>((u + 3.0f) * 8.0f))];
+      sum += u;
+    }
+    ENGINE_CHECK(inRange);
+    ENGINE_CHECK(std::fabs(sum / static_cast<double>(kSamples) - 1.0) < 6.0 * 8.0 / std::sqrt(12.0 * kSamples));
+    ENGINE_CHECK(chiSquare(counts, kSamples) < chiSquareLimit(63));
+  }
+
+  void
+  testUnitVectors() {
+    std::vector<Vector3> vectors(kSamples + 3);
+    BatchRandom(19).fillUnitVectors(vectors.data(), vectors.size());
+
+    // Uniform on the sphere: unit length, z uniform in [-1, 1) (Archimedes), the
+    // azimuth uniform, and the mean at the origin.
+    float lengthError = 0.0f;
+    std::vector<size_t> zCounts(64, 0);
+    std::vector<size_t> azimuthCounts(64, 0);
+    double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+    for (const Vector3& v : vectors) {
+      float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+      lengthError = std::max(lengthError, std::fabs(length - 1.0f));
+      ++zCounts[std::min<size_t>(63, static_cast<size_t>((v.z + 1.0f) * 32.0f))];
+      float azimuth = std::atan2(v.y, v.x) + 3.14159265f;
+      ++azimuthCounts[std::min<size_t>(63, static_cast<size_t>(azimuth * (64.0f / 6.2831853f)))];
+      sumX += v.x;
+      sumY += v.y;
+      sumZ += v.z;
+    }
+    double n = static_cast<double>(vectors.size());
+    // Each coordinate has variance 1/3, so its mean has deviation sqrt(1 / 3n).
+    double meanLimit = 6.0 * std::sqrt(1.0 / (3.0 * n));
+    ENGINE_CHECK(lengthError <= 1e-6f);
+    ENGINE_CHECK(chiSquare(zCounts, vectors.size()) < chiSquareLimit(63));
+    ENGINE_CHECK(chiSquare(azimuthCounts, vectors.size()) < chiSquareLimit(63));
+    ENGINE_CHECK(std::fabs(sumX / n) < meanLimit && std::fabs(sumY / n) < meanLimit && std::fabs(sumZ / n) < meanLimit);
+  }
+
+  void
+  testShapes() {
+    const size_t count = 100003;
+    std::vector<Vector3> points(count);
+    Vector3 center(1.0f, -2.0f, 3.0f);
+
+    // In a sphere of radius 2, one point in eight lies within radius 1.
+    BatchRandom(23).fillPointsInSphere(points.data(), count, center, 2.0f);
+    bool inside = true;
+    size_t inner = 0;
+    for (const Vector3& p : points) {
+      Vector3 d = p - center;
+      float distance = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+      inside = inside && distance <= 2.0f * (1.0f + 1e-6f);
+      inner += distance < 1.0f ? 1 : 0;
+    }
+    double fraction = static_cast<double>(inner) / count;
+    ENGINE_CHECK(inside);
+    ENGINE_CHECK(std::fabs(fraction - 0.125) < 6.0 * std::sqrt(0.125 * 0.875 / count));
+
+    Vector3 minimum(-1.0f, 0.0f, 2.0f);
+    Vector3 maximum(1.0f, 4.0f, 2.5f);
+    BatchRandom(29).fillPointsInBox(points.data(), count, minimum, maximum);
+    inside = true;
+    for (const Vector3& p : points) {
+      inside = inside && p.x >= minimum.x && p.x < maximum.x && p.y >= minimum.y && p.y < maximum.y &&
+               p.z >= minimum.z && p.z < maximum.z;
+    }
+    ENGINE_CHECK(inside);
+
+    // In a disk of radius 2, one point in four lies within radius 1.
+    std::vector<Vector2> disk(count);
+    Vector2 diskCenter(5.0f, -5.0f);
+    BatchRandom(31).fillPointsInDisk(disk.data(), count, diskCenter, 2.0f);
+    inside = true;
+    inner = 0;
+    for (const Vector2& p : disk) {
+      float dx = p.x - diskCenter.x;
+      float dy = p.y - diskCenter.y;
+      float distance = std::sqrt(dx * dx + dy * dy);
+      inside = inside && distance <= 2.0f * (1.0f + 1e-6f);
+      inner += distance < 1.0f ? 1 : 0;
+    }
+    fraction = static_cast<double>(inner) / count;
+    ENGINE_CHECK(inside);
+    ENGINE_CHECK(std::fabs(fraction - 0.25) < 6.0 * std::sqrt(0.25 * 0.75 / count));
+  }
+}
+
+int
+main() {
+  testKnownAnswers();
+  testGenerators();
+  testBatchSequence();
+  testUnitVectors();
+  testShapes();
+  return EngineTests::testResult();
+}
@@ -0,0 +1,86 @@
+// sqrt, rsqrt and Vector3 normalization over 16K elements, in ns per element:
+// the batched EngineUtilities functions against plain loops.
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  const size_t kCount = 16 * 1024;
+  const int kRepeats = 200;
+
+  template <typename Fn>
+  double
+  nsPerElement(Fn fn) {
+    return EngineTests::bestOfMs(kRepeats, fn) * 1e6 / static_cast<double>(kCount);
+  }
+}
+
+int
+main() {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> positive(1e-3f, 1e4f);
+  std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+  std::vector<float> values(kCount);
+  std::vector<float> results(kCount);
+  std::vector<Vector3> vectors(kCount);
+  std::vector<Vector3> normals(kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    values[i] = positive(rng);
+    vectors[i] = Vector3(component(rng), component(rng), component(rng));
+  }
+
+  double stdSqrt = nsPerElement([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      results[i] = std::sqrt(values[i]);
+    }
+    EngineTests::doNotOptimize(results[0]);
+  });
+  double scalarSqrt = nsPerElement([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      results[i] = EngineUtilities::sqrt(values[i]);
+    }
+    EngineTests::doNotOptimize(results[0]);
+  });
+  double batchSqrt = nsPerElement([&]() {
+    EngineUtilities::sqrt(values.data(), results.data(), kCount);
+    EngineTests::doNotOptimize(results[0]);
+  });
+  std::printf("sqrt       std::sqrt %.2f  scalar %.2f  batch %.2f ns\n", stdSqrt, scalarSqrt, batchSqrt);
+
+  double division = nsPerElement([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      results[i] = 1.0f / std::sqrt(values[i]);
+    }
+    EngineTests::doNotOptimize(results[0]);
+  });
+  double scalarRsqrt = nsPerElement([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      results[i] = rsqrt(values[i]);
+    }
+    EngineTests::doNotOptimize(results[0]);
+  });
+  double batchRsqrt = nsPerElement([&]() {
+    rsqrt(values.data(), results.data(), kCount);
+    EngineTests::doNotOptimize(results[0]);
+  });
+  std::printf("rsqrt      1/sqrt %.2f  scalar %.2f  batch %.2f ns\n", division, scalarRsqrt, batchRsqrt);
+
+  double memberNormalize = nsPerElement([&]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      normals[i] = vectors[i].normalize();
+    }
+    EngineTests::doNotOptimize(normals[0]);
+  });
+  double batchNormalize = nsPerElement([&]() {
+    normalize(vectors.data(), normals.data(), kCount);
+    EngineTests::doNotOptimize(normals[0]);
+  });
+  std::printf("normalize  Vector3::normalize %.2f  batch %.2f ns\n", memberNormalize, batchNormalize);
+  return 0;
+}
@@ -0,0 +1,105 @@
+// sqrt/rsqrt and the batched sqrt/rsqrt/normalize against the scalar definitions.
+// Also built with ENGINE_NO_SIMD to cover the scalar fallback.
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Engine Utilities/Utilities/EngineMath.h"
+#include "Engine Utilities/Vectors/Vector3.h"
+#include "MathAccuracy.h"
+#include "TestHarness.h"
+
+using namespace EngineUtilities;
+
+namespace {
+  void
+  testScalar() {
+    // sqrt is correctly rounded: identical to std::sqrt on a sample of every positive float.
+    bool sqrtExact = true;
+    double rsqrtError = 0.0;
+    for (uint32_t bits = 0x00800000u; bits < 0x7F800000u; bits += 97) {
+      float x = EngineTests::floatFromBits(bits);
+      sqrtExact = sqrtExact && EngineUtilities::sqrt(x) == std::sqrt(x);
+      double expected = 1.0 / std::sqrt(static_cast<double>(x));
+      double error = std::fabs(static_cast<double>(rsqrt(x)) - expected) / expected;
+      rsqrtError = error > rsqrtError ? error : rsqrtError;
+    }
+    ENGINE_CHECK(sqrtExact);
+    ENGINE_CHECK(rsqrtError < 5e-7);
+    ENGINE_CHECK(EngineUtilities::sqrt(-4.0f) == 0.0f);
+    ENGINE_CHECK(EngineUtilities::sqrt(0.0f) == 0.0f);
+
+    // Compile-time evaluation goes through constexprSqrt.
+    constexpr float four = EngineUtilities::sqrt(16.0f);
+    static_assert(four == 4.0f, "constexpr sqrt");
+  }
+
+  void
+  testBatches() {
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> positive(1e-3f, 1e4f);
+    // Odd counts exercise the 8-wide, 4-wide and scalar tails.
+    for (size_t count : { size_t(0), size_t(1), size_t(3), size_t(7), size_t(12), size_t(37), size_t(1000) }) {
+      std::vector<float> values(count);
+      for (float& value : values) {
+        value = positive(rng);
+      }
+      if (count > 2) {
+        values[1] = -2.0f;
+      }
+      std::vector<float> roots(count);
+      EngineUtilities::sqrt(values.data(), roots.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        ENGINE_CHECK(roots[i] == EngineUtilities::sqrt(values[i]));
+      }
+      if (count > 2) {
+        values[1] = 2.0f;
+      }
+      std::vector<float> inverse(count);
+      rsqrt(values.data(), inverse.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        double expected = 1.0 / std::sqrt(static_cast<double>(values[i]));
+        ENGINE_CHECK(std::fabs(inverse[i] - expected) / expected < 5e-7);
+      }
+      // In place.
+      EngineUtilities::sqrt(values.data(), values.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        ENGINE_CHECK(values[i] == roots[i] || i == 1);
+      }
+    }
+  }
+
+  void
+  testNormalize() {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    for (size_t count : { size_t(1), size_t(4), size_t(5), size_t(8), size_t(13), size_t(1001) }) {
+      std::vector<Vector3> vectors(count);
+      for (Vector3& v : vectors) {
+        v = Vector3(component(rng), component(rng), component(rng));
+      }
+      vectors[0] = Vector3(0.0f, 0.0f, 0.0f);
+      std::vector<Vector3> results(count);
+      normalize(vectors.data(), results.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        Vector3 expected = vectors[i].normalize();
+        ENGINE_CHECK(std::fabs(results[i].x - expected.x) < 1e-6f);
+        ENGINE_CHECK(std::fabs(results[i].y - expected.y) < 1e-6f);
+        ENGINE_CHECK(std::fabs(results[i].z - expected.z) < 1e-6f);
+      }
+      ENGINE_CHECK(results[0].x == 0.0f && results[0].y == 0.0f && results[0].z == 0.0f);
+
+      normalize(vectors.data(), vectors.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        ENGINE_CHECK(vectors[i].x == results[i].x && vectors[i].y == results[i].y && vectors[i].z == results[i].z);
+      }
+    }
+  }
+}
+
+int
+main() {
+  testScalar();
+  testBatches();
+  testNormalize();
+  return EngineTests::testResult();
+}